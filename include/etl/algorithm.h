@@ -81,6 +81,27 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename T, size_t Extent>
+  class span;
+
+  template <typename TIterator, typename T, size_t Extent>
+  void merge_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer);
+
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer, TCompare compare);
 }
 
 //*****************************************************************************
@@ -236,7 +257,7 @@ namespace etl
   {
     while (sb != se)
     {
-      *db = etl::move(*sb);
+      *db = ETL_MOVE(*sb);
       ++db;
       ++sb;
     }
@@ -261,7 +282,7 @@ namespace etl
   {
     while (sb != se)
     {
-      *(--de) = etl::move(*(--se));
+      *(--de) = ETL_MOVE(*(--se));
     }
 
     return de;
@@ -340,6 +361,56 @@ namespace etl
     return etl::lower_bound(first, last, value, compare());
   }
 
+  //***************************************************************************
+  // lower_bound_branchless
+  /// A lower_bound for random access iterators, such as pointers to contiguous
+  /// data, where the next position is calculated from the result of the
+  /// comparison rather than branched to. The range is always halved, so the
+  /// loop count only depends on the size of the range and no comparison can be
+  /// mispredicted.
+  //***************************************************************************
+  template<typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator lower_bound_branchless(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    difference_t count = etl::distance(first, last);
+
+    if (count == 0)
+    {
+      return first;
+    }
+
+    // The result is always in the range [first, first + count].
+    while (count > 1)
+    {
+      const difference_t half = count / 2;
+
+      TIterator itr = first;
+      etl::advance(itr, half - 1);
+
+      // Multiplying, rather than selecting, stops the compiler from making a branch.
+      first += static_cast<difference_t>(compare(*itr, value)) * half;
+      count -= half;
+    }
+
+    first += compare(*first, value) ? 1 : 0;
+
+    return first;
+  }
+
+  template<typename TIterator, typename TValue>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  TIterator lower_bound_branchless(TIterator first, TIterator last, const TValue& value)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return etl::lower_bound_branchless(first, last, value, compare());
+  }
+
   //***************************************************************************
   // upper_bound
   //***************************************************************************
@@ -837,12 +908,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = ETL_MOVE(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = ETL_MOVE(value);
     }
 
     // Adjust Heap Helper
@@ -859,18 +930,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = ETL_MOVE(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
     }
 
     // Is Heap Helper
@@ -903,10 +974,10 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
   // Pop Heap
@@ -925,7 +996,7 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
   // Push Heap
@@ -953,7 +1024,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -1072,7 +1143,8 @@ namespace etl
     ETL_CONSTEXPR14
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
-      TIterator next = middle;
+      TIterator next   = middle;
+      TIterator result = last;
 
       while (first != next)
       {
@@ -1085,6 +1157,12 @@ namespace etl
 
         if (next == last)
         {
+          // The first time round, this is the new position of the first item.
+          if (result == last)
+          {
+            result = first;
+          }
+
           next = middle;
         }
         else if (first == middle)
@@ -1093,7 +1171,7 @@ namespace etl
         }
       }
 
-      return first;
+      return result;
     }
 
     //*********************************
@@ -1104,13 +1182,13 @@ namespace etl
       typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
       // Save the first item.
-      value_type temp(etl::move(*first));
+      value_type temp(ETL_MOVE(*first));
 
       // Move the rest.
       TIterator result = etl::move(etl::next(first), last, first);
 
       // Restore the first item in its rotated position.
-      *result = etl::move(temp);
+      *result = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1125,13 +1203,13 @@ namespace etl
 
       // Save the last item.
       TIterator previous = etl::prev(last);
-      value_type temp(etl::move(*previous));
+      value_type temp(ETL_MOVE(*previous));
 
       // Move the rest.
       TIterator result = etl::move_backward(first, previous, last);
 
       // Restore the last item in its rotated position.
-      *first = etl::move(temp);
+      *first = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1143,6 +1221,16 @@ namespace etl
   ETL_CONSTEXPR14
   TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
+    if (first == middle)
+    {
+      return last;
+    }
+
+    if (middle == last)
+    {
+      return first;
+    }
+
     if (etl::next(first) == middle)
     {
       return private_algorithm::rotate_left_by_one(first, last);
@@ -1784,48 +1872,94 @@ namespace etl
   }
 
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Random access iterators use intro_sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, true>)
+    {
+      etl::intro_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Other iterators use shell_sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, false>)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses intro_sort for random access iterators, otherwise shell_sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses intro_sort for random access iterators, otherwise shell_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Random access iterators use merge_sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, true>)
+    {
+      etl::merge_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Other iterators use insertion_sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, false>)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses an in place merge_sort for random access iterators, otherwise insertion_sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses an in place merge_sort for random access iterators, otherwise insertion_sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -1873,6 +2007,35 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses merge_sort with a caller supplied scratch buffer instead of allocating.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\param buffer Scratch space. The contents are unspecified afterwards.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses merge_sort with a caller supplied scratch buffer instead of allocating.
+  /// Requires random access iterators.
+  ///\param buffer Scratch space. The contents are unspecified afterwards.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer)
+  {
+    etl::merge_sort(first, last, buffer);
+  }
+
   //***************************************************************************
   /// Accumulates values.
   ///\ingroup algorithm
@@ -2833,6 +2996,838 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Tuning constants for intro_sort.
+    //*************************************************************************
+    struct intro_sort_constants
+    {
+      static ETL_CONSTANT size_t Insertion_Sort_Threshold     = 24U;
+      static ETL_CONSTANT size_t Ninther_Threshold            = 128U;
+      static ETL_CONSTANT size_t Partial_Insertion_Sort_Limit = 8U;
+      static ETL_CONSTANT size_t Block_Size                   = 64U;
+    };
+
+    //*************************************************************************
+    /// Selects the branchless block partition for arithmetic types sorted
+    /// with a simple less or greater comparison.
+    //*************************************************************************
+    template <typename TCompare, typename T>
+    struct intro_sort_use_branchless : etl::integral_constant<bool, false>
+    {
+    };
+
+    template <typename T>
+    struct intro_sort_use_branchless<etl::less<T>, T> : etl::integral_constant<bool, etl::is_arithmetic<T>::value>
+    {
+    };
+
+    template <typename T>
+    struct intro_sort_use_branchless<etl::greater<T>, T> : etl::integral_constant<bool, etl::is_arithmetic<T>::value>
+    {
+    };
+
+#if ETL_USING_STL
+    template <typename T>
+    struct intro_sort_use_branchless<std::less<T>, T> : etl::integral_constant<bool, etl::is_arithmetic<T>::value>
+    {
+    };
+
+    template <typename T>
+    struct intro_sort_use_branchless<std::greater<T>, T> : etl::integral_constant<bool, etl::is_arithmetic<T>::value>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// Insertion sort for small partitions.
+    /// If 'guarded' is false then the element before 'first' must not be
+    /// greater than any element in the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_insertion(TIterator first, TIterator last, TCompare compare, bool guarded)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_t temp = ETL_MOVE(*sift);
+
+          if (guarded)
+          {
+            do
+            {
+              *sift-- = ETL_MOVE(*sift_1);
+            } while ((sift != first) && compare(temp, *--sift_1));
+          }
+          else
+          {
+            do
+            {
+              *sift-- = ETL_MOVE(*sift_1);
+            } while (compare(temp, *--sift_1));
+          }
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Attempts an insertion sort, giving up if more than a few elements
+    /// have to be moved.
+    /// Returns true if the range was sorted.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool intro_sort_partial_insertion(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      size_t moves = 0U;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_t temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+          moves += static_cast<size_t>(current - sift);
+        }
+
+        if (moves > intro_sort_constants::Partial_Insertion_Sort_Limit)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sorts two elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts three elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      intro_sort_2(a, b, compare);
+      intro_sort_2(b, c, compare);
+      intro_sort_2(a, b, compare);
+    }
+
+    //*************************************************************************
+    /// Places the pivot, stored in *first, at its final position.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    TIterator intro_sort_place_pivot(TIterator first, TIterator position, T& pivot)
+    {
+      *first    = ETL_MOVE(*position);
+      *position = ETL_MOVE(pivot);
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the right.
+    /// Returns the position of the pivot and whether the range was already
+    /// partitioned.
+    /// Branching version, for general comparisons.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> intro_sort_partition_right(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, false>)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = ETL_MOVE(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      // The median of three guarantees that a greater or equal element exists.
+      while (compare(*++left, pivot))
+      {
+      }
+
+      // If the first pair was in place then there is no guard on the right.
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (left >= right);
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(*++left, pivot))
+        {
+        }
+
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      return ETL_OR_STD::pair<TIterator, bool>(intro_sort_place_pivot(first, left - 1, pivot), already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Swaps the elements at the recorded offsets.
+    /// If the counts on each side are equal then a cyclic permutation would
+    /// lose an element, so plain swaps are used.
+    //*************************************************************************
+    template <typename TIterator>
+    void intro_sort_swap_offsets(TIterator            first,
+                                 TIterator            last,
+                                 const unsigned char* offsets_left,
+                                 const unsigned char* offsets_right,
+                                 size_t               count,
+                                 bool                 use_swaps)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (use_swaps)
+      {
+        for (size_t i = 0U; i < count; ++i)
+        {
+          etl::iter_swap(first + offsets_left[i], last - offsets_right[i]);
+        }
+      }
+      else if (count > 0U)
+      {
+        TIterator left  = first + offsets_left[0];
+        TIterator right = last - offsets_right[0];
+
+        value_t temp = ETL_MOVE(*left);
+        *left = ETL_MOVE(*right);
+
+        for (size_t i = 1U; i < count; ++i)
+        {
+          left   = first + offsets_left[i];
+          *right = ETL_MOVE(*left);
+          right  = last - offsets_right[i];
+          *left  = ETL_MOVE(*right);
+        }
+
+        *right = ETL_MOVE(temp);
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the right.
+    /// Branchless block partitioning version, for arithmetic types.
+    /// The results of the comparisons are recorded as offsets in blocks and
+    /// the misplaced elements are then swapped, avoiding unpredictable
+    /// branches in the inner loops.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> intro_sort_partition_right(TIterator first, TIterator last, TCompare compare, etl::integral_constant<bool, true>)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      const size_t Block_Size = intro_sort_constants::Block_Size;
+
+      value_t pivot = ETL_MOVE(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(*++left, pivot))
+      {
+      }
+
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (left >= right);
+
+      if (!already_partitioned)
+      {
+        etl::iter_swap(left, right);
+        ++left;
+
+        unsigned char offsets_left[Block_Size];
+        unsigned char offsets_right[Block_Size];
+
+        TIterator offsets_left_base  = left;
+        TIterator offsets_right_base = right;
+
+        size_t n_left      = 0U;
+        size_t n_right     = 0U;
+        size_t start_left  = 0U;
+        size_t start_right = 0U;
+
+        while (left < right)
+        {
+          // Decide how many unknown elements to examine on each side.
+          const size_t n_unknown   = static_cast<size_t>(right - left);
+          const size_t left_split  = (n_left == 0U) ? ((n_right == 0U) ? (n_unknown / 2U) : n_unknown) : 0U;
+          const size_t right_split = (n_right == 0U) ? (n_unknown - left_split) : 0U;
+
+          const size_t left_count  = (left_split >= Block_Size) ? Block_Size : left_split;
+          const size_t right_count = (right_split >= Block_Size) ? Block_Size : right_split;
+
+          // Record the offsets of elements that belong on the right.
+          for (size_t i = 0U; i < left_count; ++i)
+          {
+            offsets_left[n_left] = static_cast<unsigned char>(i);
+            n_left += !compare(*left, pivot);
+            ++left;
+          }
+
+          // Record the offsets of elements that belong on the left.
+          for (size_t i = 0U; i < right_count; ++i)
+          {
+            offsets_right[n_right] = static_cast<unsigned char>(i + 1U);
+            n_right += compare(*--right, pivot);
+          }
+
+          const size_t n = (n_left < n_right) ? n_left : n_right;
+
+          intro_sort_swap_offsets(offsets_left_base, offsets_right_base, offsets_left + start_left, offsets_right + start_right, n, (n_left == n_right));
+
+          n_left      -= n;
+          n_right     -= n;
+          start_left  += n;
+          start_right += n;
+
+          if (n_left == 0U)
+          {
+            start_left        = 0U;
+            offsets_left_base = left;
+          }
+
+          if (n_right == 0U)
+          {
+            start_right        = 0U;
+            offsets_right_base = right;
+          }
+        }
+
+        // Move any remaining misplaced elements to the boundary.
+        if (n_left != 0U)
+        {
+          const unsigned char* p_offsets = offsets_left + start_left;
+
+          while (n_left-- != 0U)
+          {
+            etl::iter_swap(offsets_left_base + p_offsets[n_left], --right);
+          }
+
+          left = right;
+        }
+
+        if (n_right != 0U)
+        {
+          const unsigned char* p_offsets = offsets_right + start_right;
+
+          while (n_right-- != 0U)
+          {
+            etl::iter_swap(offsets_right_base - p_offsets[n_right], left);
+            ++left;
+          }
+        }
+      }
+
+      return ETL_OR_STD::pair<TIterator, bool>(intro_sort_place_pivot(first, left - 1, pivot), already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot *first.
+    /// Elements equal to the pivot go to the left.
+    /// Used when the pivot equals the element before the range, in which case
+    /// the left partition is entirely made up of equal elements and needs no
+    /// further sorting.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator intro_sort_partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      value_t pivot = ETL_MOVE(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(pivot, *--right))
+      {
+      }
+
+      if ((right + 1) == last)
+      {
+        while ((left < right) && !compare(pivot, *++left))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(pivot, *--right))
+        {
+        }
+
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      return intro_sort_place_pivot(first, right, pivot);
+    }
+
+    //*************************************************************************
+    /// Breaks up patterns that caused an unbalanced partition by swapping a
+    /// few elements from the quartiles to the ends.
+    //*************************************************************************
+    template <typename TIterator>
+    void intro_sort_break_patterns(TIterator first, TIterator last, size_t size)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (size >= intro_sort_constants::Insertion_Sort_Threshold)
+      {
+        const difference_t quarter = static_cast<difference_t>(size / 4U);
+
+        etl::iter_swap(first, first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (size > intro_sort_constants::Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2, last - (quarter + 1));
+          etl::iter_swap(last - 3, last - (quarter + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The main intro_sort loop.
+    /// Recurses on the left partition and loops on the right.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare, typename TBranchless>
+    void intro_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost, TBranchless branchless)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const size_t size = static_cast<size_t>(last - first);
+
+        if (size < intro_sort_constants::Insertion_Sort_Threshold)
+        {
+          intro_sort_insertion(first, last, compare, leftmost);
+          return;
+        }
+
+        // Choose the pivot as the median of three, or the pseudo median of nine for larger ranges.
+        const difference_t half = static_cast<difference_t>(size / 2U);
+
+        if (size > intro_sort_constants::Ninther_Threshold)
+        {
+          intro_sort_3(first, first + half, last - 1, compare);
+          intro_sort_3(first + 1, first + (half - 1), last - 2, compare);
+          intro_sort_3(first + 2, first + (half + 1), last - 3, compare);
+          intro_sort_3(first + (half - 1), first + half, first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          intro_sort_3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot equals the element before this range then the elements
+        // equal to the pivot can be put to the left and skipped.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = intro_sort_partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> result = intro_sort_partition_right(first, last, compare, branchless);
+
+        TIterator  pivot_position      = result.first;
+        const bool already_partitioned = result.second;
+
+        const size_t left_size  = static_cast<size_t>(pivot_position - first);
+        const size_t right_size = static_cast<size_t>(last - (pivot_position + 1));
+
+        if ((left_size < (size / 8U)) || (right_size < (size / 8U)))
+        {
+          // Too many bad partitions; fall back to a guaranteed O(n log n) sort.
+          if (--bad_allowed == 0)
+          {
+            etl::make_heap(first, last, compare);
+            etl::sort_heap(first, last, compare);
+            return;
+          }
+
+          intro_sort_break_patterns(first, pivot_position, left_size);
+          intro_sort_break_patterns(pivot_position + 1, last, right_size);
+        }
+        else
+        {
+          // A balanced partition that needed no swaps suggests that the range may already be sorted.
+          if (already_partitioned &&
+              intro_sort_partial_insertion(first, pivot_position, compare) &&
+              intro_sort_partial_insertion(pivot_position + 1, last, compare))
+          {
+            return;
+          }
+        }
+
+        intro_sort_loop(first, pivot_position, compare, bad_allowed, leftmost, branchless);
+
+        first    = pivot_position + 1;
+        leftmost = false;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  /// Quicksort with median of three (or nine) pivots, insertion sort for small
+  /// partitions and a fallback to heap sort to guarantee O(n log n).
+  /// Sorted, reverse sorted and few unique inputs are detected and sorted in
+  /// close to linear time.
+  /// Arithmetic types compared with etl::less or etl::greater use a branchless
+  /// block partition.
+  /// Requires random access iterators. Not stable.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    size_t size = static_cast<size_t>(etl::distance(first, last));
+
+    if (size < 2U)
+    {
+      return;
+    }
+
+    // The number of unbalanced partitions allowed before switching to heap sort.
+    int bad_allowed = 0;
+
+    while (size > 1U)
+    {
+      ++bad_allowed;
+      size >>= 1U;
+    }
+
+    private_algorithm::intro_sort_loop(first, last, compare, bad_allowed, true,
+                                       etl::integral_constant<bool, private_algorithm::intro_sort_use_branchless<TCompare, value_t>::value>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a pattern defeating introsort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Tuning constants for merge_sort.
+    //*************************************************************************
+    struct merge_sort_constants
+    {
+      static ETL_CONSTANT size_t Run_Length = 16U;
+    };
+
+    //*************************************************************************
+    /// Merges [first, middle) and [middle, last), moving the left half into
+    /// the buffer and merging forwards.
+    /// The buffer must hold at least (middle - first) elements.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void merge_sort_merge_left(TIterator first, TIterator middle, TIterator last, TPointer buffer, TCompare compare)
+    {
+      TPointer buffer_end = etl::move(first, middle, buffer);
+
+      while ((buffer != buffer_end) && (middle != last))
+      {
+        // Take from the left half unless the right is strictly less, to keep the sort stable.
+        if (compare(*middle, *buffer))
+        {
+          *first = ETL_MOVE(*middle);
+          ++middle;
+        }
+        else
+        {
+          *first = ETL_MOVE(*buffer);
+          ++buffer;
+        }
+
+        ++first;
+      }
+
+      etl::move(buffer, buffer_end, first);
+    }
+
+    //*************************************************************************
+    /// Merges [first, middle) and [middle, last), moving the right half into
+    /// the buffer and merging backwards.
+    /// The buffer must hold at least (last - middle) elements.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void merge_sort_merge_right(TIterator first, TIterator middle, TIterator last, TPointer buffer, TCompare compare)
+    {
+      TPointer buffer_end = etl::move(middle, last, buffer);
+
+      while ((buffer != buffer_end) && (first != middle))
+      {
+        // Take from the right half unless the left is strictly greater, to keep the sort stable.
+        if (compare(*(buffer_end - 1), *(middle - 1)))
+        {
+          *--last = ETL_MOVE(*--middle);
+        }
+        else
+        {
+          *--last = ETL_MOVE(*--buffer_end);
+        }
+      }
+
+      etl::move_backward(buffer, buffer_end, last);
+    }
+
+    //*************************************************************************
+    /// Merges [first, middle) and [middle, last).
+    /// Uses the buffer if the smaller half will fit, otherwise splits the
+    /// halves, rotates the middle sections into place and merges each side.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void merge_sort_merge(TIterator first, TIterator middle, TIterator last, TPointer buffer, size_t buffer_size, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const size_t length1 = static_cast<size_t>(middle - first);
+        const size_t length2 = static_cast<size_t>(last - middle);
+
+        if ((length1 == 0U) || (length2 == 0U))
+        {
+          return;
+        }
+
+        // Already in order?
+        if (!compare(*middle, *(middle - 1)))
+        {
+          return;
+        }
+
+        if ((length1 <= length2) && (length1 <= buffer_size))
+        {
+          merge_sort_merge_left(first, middle, last, buffer, compare);
+          return;
+        }
+
+        if (length2 <= buffer_size)
+        {
+          merge_sort_merge_right(first, middle, last, buffer, compare);
+          return;
+        }
+
+        if ((length1 + length2) == 2U)
+        {
+          etl::iter_swap(first, middle);
+          return;
+        }
+
+        TIterator cut1;
+        TIterator cut2;
+
+        if (length1 > length2)
+        {
+          cut1 = first + static_cast<difference_t>(length1 / 2U);
+          cut2 = etl::lower_bound(middle, last, *cut1, compare);
+        }
+        else
+        {
+          cut2 = middle + static_cast<difference_t>(length2 / 2U);
+          cut1 = etl::upper_bound(first, middle, *cut2, compare);
+        }
+
+        TIterator new_middle = etl::rotate(cut1, middle, cut2);
+
+        // Recurse on the smaller side and loop on the larger to bound the stack depth.
+        if ((new_middle - first) < (last - new_middle))
+        {
+          merge_sort_merge(first, cut1, new_middle, buffer, buffer_size, compare);
+          first  = new_middle;
+          middle = cut2;
+        }
+        else
+        {
+          merge_sort_merge(new_middle, cut2, last, buffer, buffer_size, compare);
+          middle = cut1;
+          last   = new_middle;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Bottom up merge sort.
+    /// Runs are sorted with an insertion sort and then repeatedly merged.
+    //*************************************************************************
+    template <typename TIterator, typename TPointer, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TPointer buffer, size_t buffer_size, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const size_t size = static_cast<size_t>(last - first);
+
+      for (size_t i = 0U; i < size; i += merge_sort_constants::Run_Length)
+      {
+        const size_t run_end = ((size - i) < merge_sort_constants::Run_Length) ? size : (i + merge_sort_constants::Run_Length);
+
+        intro_sort_insertion(first + static_cast<difference_t>(i), first + static_cast<difference_t>(run_end), compare, true);
+      }
+
+      for (size_t width = merge_sort_constants::Run_Length; width < size; width *= 2U)
+      {
+        for (size_t i = 0U; (i + width) < size; i += (2U * width))
+        {
+          const size_t middle = i + width;
+          const size_t end    = ((size - middle) < width) ? size : (middle + width);
+
+          merge_sort_merge(first + static_cast<difference_t>(i),
+                           first + static_cast<difference_t>(middle),
+                           first + static_cast<difference_t>(end),
+                           buffer,
+                           buffer_size,
+                           compare);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a stable merge sort, without extra memory.
+  /// Merges are performed in place using rotations.
+  /// O(n log(n)^2) moves, O(n log(n)) comparisons.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::pointer pointer_t;
+
+    private_algorithm::merge_sort(first, last, pointer_t(ETL_NULLPTR), 0U, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a stable merge sort, without extra memory.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a stable merge sort, with a scratch buffer.
+  /// A buffer of at least half the length of the range gives O(n log(n)).
+  /// Smaller buffers are used wherever a merge will fit in them.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\param buffer Scratch space. The contents are unspecified afterwards.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer, TCompare compare)
+  {
+    private_algorithm::merge_sort(first, last, buffer.data(), buffer.size(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a stable merge sort, with a scratch buffer.
+  ///\param buffer Scratch space. The contents are unspecified afterwards.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void merge_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer)
+  {
+    etl::merge_sort(first, last, buffer, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
@@ -49,6 +49,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "span.h"
 #include "file_error_numbers.h"
+#include "private/spsc_atomic_wait.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -281,6 +282,9 @@ namespace etl
         else
         {
           ETL_ASSERT_AND_RETURN((windex == 0) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
+
+          // The readable data at the end now stops at the old write index.
+          last.store(write_index, etl::memory_order_release);
         }
         
         // Always update write index
@@ -405,6 +409,7 @@ namespace etl
     {
       size_type rindex = etl::distance(p_buffer, reserve.data());
       apply_read_reserve(rindex, reserve.size());
+      notify_producer();
     }
 
     //*************************************************************************
@@ -439,8 +444,45 @@ namespace etl
     {
       size_type windex = etl::distance(p_buffer, reserve.data());
       apply_write_reserve(windex, reserve.size());
+      notify_consumer();
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    /// Reserves a memory area for reading (up to the max_reserve_size), waiting
+    /// for data if the buffer is empty.
+    /// Spins for a while, then sleeps until the writer commits.
+    /// Waits for up to 'timeout_us' microseconds; by default, forever.
+    /// Returns an empty span if the buffer was still empty at the timeout.
+    //*************************************************************************
+    span<T> read_reserve_wait(size_type max_reserve_size = numeric_limits<size_type>::max(),
+                              uint32_t  timeout_us       = etl::private_spsc_atomic_wait::waiter::Forever)
+    {
+      read_reserve_operation operation = { *this, max_reserve_size, span<T>() };
+
+      consumer_waiter.wait(operation, timeout_us);
+
+      return operation.reserve;
+    }
+
+    //*************************************************************************
+    /// Reserves a memory area for writing up to the max_reserve_size, waiting
+    /// for space if the buffer is full.
+    /// Spins for a while, then sleeps until the reader commits.
+    /// Waits for up to 'timeout_us' microseconds; by default, forever.
+    /// Returns an empty span if the buffer was still full at the timeout.
+    //*************************************************************************
+    span<T> write_reserve_wait(size_type max_reserve_size,
+                               uint32_t  timeout_us = etl::private_spsc_atomic_wait::waiter::Forever)
+    {
+      write_reserve_operation operation = { *this, max_reserve_size, span<T>() };
+
+      producer_waiter.wait(operation, timeout_us);
+
+      return operation.reserve;
     }
 
+#endif
     //*************************************************************************
     /// Clears the buffer, destructing any elements that haven't been read.
     //*************************************************************************
@@ -457,6 +499,7 @@ namespace etl
       // the whole buffer available for a single block,
       // but it requires synchronization between the writer and reader threads
       reset();
+      notify_producer();
     }
 
   protected:
@@ -470,6 +513,62 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Wakes the reader if it is waiting in read_reserve_wait.
+    //*************************************************************************
+    void notify_consumer()
+    {
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+      consumer_waiter.notify();
+#endif
+    }
+
+    //*************************************************************************
+    /// Wakes the writer if it is waiting in write_reserve_wait.
+    //*************************************************************************
+    void notify_producer()
+    {
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+      producer_waiter.notify();
+#endif
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    /// The operation that read_reserve_wait re-tries.
+    //*************************************************************************
+    struct read_reserve_operation
+    {
+      bool operator()()
+      {
+        reserve = buffer.read_reserve(max_reserve_size);
+
+        return reserve.size() != 0U;
+      }
+
+      ibip_buffer_spsc_atomic& buffer;
+      size_type                max_reserve_size;
+      span<T>                  reserve;
+    };
+
+    //*************************************************************************
+    /// The operation that write_reserve_wait re-tries.
+    //*************************************************************************
+    struct write_reserve_operation
+    {
+      bool operator()()
+      {
+        reserve = buffer.write_reserve(max_reserve_size);
+
+        return reserve.size() != 0U;
+      }
+
+      ibip_buffer_spsc_atomic& buffer;
+      size_type                max_reserve_size;
+      span<T>                  reserve;
+    };
+#endif
+
     // Disable copy construction and assignment.
     ibip_buffer_spsc_atomic(const ibip_buffer_spsc_atomic&) ETL_DELETE;
     ibip_buffer_spsc_atomic& operator =(const ibip_buffer_spsc_atomic&) ETL_DELETE;
@@ -480,6 +579,11 @@ namespace etl
 #endif
 
     T* const p_buffer;
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    etl::private_spsc_atomic_wait::waiter producer_waiter; ///< Where write_reserve_wait sleeps.
+    etl::private_spsc_atomic_wait::waiter consumer_waiter; ///< Where read_reserve_wait sleeps.
+#endif
   };
 
   //***************************************************************************
@@ -0,0 +1,2302 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "pool.h"
+#include "generic_pool.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// A map with the capacity defined at compile time, implemented as a B+tree.
+/// The elements are stored in order in leaf nodes of a few cache lines each,
+/// and the leaves are linked, so a search reads O(log N) nodes rather than
+/// O(log N) individual elements, and iteration reads memory in order.
+/// Has the same interface as etl::map, but inserting or erasing an element
+/// may move other elements, and so invalidates iterators and references.
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+//*****************************************************************************
+/// The target size, in bytes, of a btree_map node.
+/// Nodes hold at least four elements or keys, whatever their size.
+//*****************************************************************************
+#if !defined(ETL_BTREE_MAP_NODE_SIZE)
+  #define ETL_BTREE_MAP_NODE_SIZE (4 * ETL_CACHE_LINE_SIZE)
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_exception : public etl::exception
+  {
+  public:
+
+    btree_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_full : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:full", ETL_BTREE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the btree_map.
+  ///\ingroup btree_map
+  //***************************************************************************
+  class btree_map_out_of_bounds : public etl::btree_map_exception
+  {
+  public:
+
+    btree_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_map_exception(ETL_ERROR_TEXT("btree_map:bounds", ETL_BTREE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_btree_map
+  {
+    //*************************************************************************
+    /// A leaf node, holding the elements in order.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct leaf_node
+    {
+      typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+
+      static ETL_CONSTANT size_t Header_Size = (2U * sizeof(void*)) + sizeof(size_t);
+      static ETL_CONSTANT size_t Fit         = (ETL_BTREE_MAP_NODE_SIZE > Header_Size) ? (ETL_BTREE_MAP_NODE_SIZE - Header_Size) / sizeof(value_type) : 0U;
+      static ETL_CONSTANT size_t Capacity    = (Fit < 4U) ? 4U : Fit;
+      static ETL_CONSTANT size_t Minimum     = Capacity / 2U; ///< The fewest elements in a leaf that is not the root.
+
+      leaf_node* prev;
+      leaf_node* next;
+      size_t     count;
+      etl::uninitialized_buffer_of<value_type, Capacity> values;
+    };
+
+    template <typename TKey, typename TMapped>
+    ETL_CONSTANT size_t leaf_node<TKey, TMapped>::Header_Size;
+
+    template <typename TKey, typename TMapped>
+    ETL_CONSTANT size_t leaf_node<TKey, TMapped>::Fit;
+
+    template <typename TKey, typename TMapped>
+    ETL_CONSTANT size_t leaf_node<TKey, TMapped>::Capacity;
+
+    template <typename TKey, typename TMapped>
+    ETL_CONSTANT size_t leaf_node<TKey, TMapped>::Minimum;
+
+    //*************************************************************************
+    /// An internal node, holding 'count' separating keys and 'count' + 1
+    /// children. Every key in children[i] is less than keys[i], and every key
+    /// in children[i + 1] is not less than keys[i].
+    //*************************************************************************
+    template <typename TKey>
+    struct internal_node
+    {
+      static ETL_CONSTANT size_t Header_Size = sizeof(size_t) + sizeof(void*);
+      static ETL_CONSTANT size_t Fit         = (ETL_BTREE_MAP_NODE_SIZE > Header_Size) ? (ETL_BTREE_MAP_NODE_SIZE - Header_Size) / (sizeof(TKey) + sizeof(void*)) : 0U;
+      static ETL_CONSTANT size_t Capacity    = (Fit < 4U) ? 4U : Fit;
+      static ETL_CONSTANT size_t Minimum     = (Capacity + 1U) / 2U; ///< The fewest children of a node that is not the root.
+
+      size_t count;
+      etl::uninitialized_buffer_of<TKey, Capacity> keys;
+      void*  children[Capacity + 1U];
+    };
+
+    template <typename TKey>
+    ETL_CONSTANT size_t internal_node<TKey>::Header_Size;
+
+    template <typename TKey>
+    ETL_CONSTANT size_t internal_node<TKey>::Fit;
+
+    template <typename TKey>
+    ETL_CONSTANT size_t internal_node<TKey>::Capacity;
+
+    template <typename TKey>
+    ETL_CONSTANT size_t internal_node<TKey>::Minimum;
+  }
+
+  //***************************************************************************
+  /// The size, alignment and number of the nodes needed by a btree_map.
+  /// Used to define the pool for a btree_map_ext.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  struct btree_map_pool_size
+  {
+  private:
+
+    typedef private_btree_map::leaf_node<TKey, TMapped> leaf_type;
+    typedef private_btree_map::internal_node<TKey>      internal_type;
+
+    static ETL_CONSTANT size_t Largest_Node = (sizeof(leaf_type) > sizeof(internal_type)) ? sizeof(leaf_type) : sizeof(internal_type);
+
+    // Every leaf but the root is at least half full, and every internal node but the root has at least
+    // internal_type::Minimum children, so the number of nodes in each level reduces geometrically.
+    static ETL_CONSTANT size_t Leaf_Count     = (MAX_SIZE_ <= leaf_type::Capacity) ? 1U : (MAX_SIZE_ / leaf_type::Minimum) + 1U;
+    static ETL_CONSTANT size_t Internal_Count = (MAX_SIZE_ <= leaf_type::Capacity) ? 0U : (Leaf_Count / (internal_type::Minimum - 1U)) + 1U;
+
+  public:
+
+    /// The size of a node, in whole cache lines.
+    static ETL_CONSTANT size_t Node_Size      = ((Largest_Node + ETL_CACHE_LINE_SIZE - 1U) / ETL_CACHE_LINE_SIZE) * ETL_CACHE_LINE_SIZE;
+    static ETL_CONSTANT size_t Node_Alignment = (etl::alignment_of<leaf_type>::value > etl::alignment_of<internal_type>::value) ? etl::alignment_of<leaf_type>::value : etl::alignment_of<internal_type>::value;
+    static ETL_CONSTANT size_t Node_Count     = Leaf_Count + Internal_Count;
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Largest_Node;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Leaf_Count;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Internal_Count;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Node_Size;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Node_Alignment;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t btree_map_pool_size<TKey, TMapped, MAX_SIZE_>::Node_Count;
+
+  //***************************************************************************
+  /// The base class for specifically sized btree_maps.
+  /// Can be used as a reference type for all btree_maps containing a specific type.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map
+  {
+  public:
+
+    typedef TKey                                  key_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef value_type&                           reference;
+    typedef const value_type&                     const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&                          rvalue_reference;
+#endif
+    typedef value_type*                           pointer;
+    typedef const value_type*                     const_pointer;
+    typedef size_t                                size_type;
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const_reference lhs, const_reference rhs) const
+      {
+        return (kcompare(lhs.first, rhs.first));
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+  protected:
+
+    typedef private_btree_map::leaf_node<TKey, TMapped> leaf_type;
+    typedef private_btree_map::internal_node<TKey>      internal_type;
+
+    /// Defines the key value parameter type
+    typedef const TKey& key_parameter_t;
+
+    //*************************************************************************
+    /// The position of an element in a leaf.
+    /// The index may be equal to the leaf's count, if a search ends after the
+    /// last element of a leaf.
+    //*************************************************************************
+    struct leaf_position
+    {
+      leaf_position()
+        : p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      leaf_position(leaf_type* p_leaf_, size_type index_)
+        : p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      leaf_type* p_leaf;
+      size_type  index;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator(const iterator& other)
+        : p_map(other.p_map)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator =(const iterator& other)
+      {
+        p_map  = other.p_map;
+        p_leaf = other.p_leaf;
+        index  = other.index;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return p_leaf->values.begin()[index];
+      }
+
+      pointer operator &() const
+      {
+        return &(p_leaf->values.begin()[index]);
+      }
+
+      pointer operator ->() const
+      {
+        return &(p_leaf->values.begin()[index]);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(ibtree_map& map, const leaf_position& position)
+        : p_map(&map)
+        , p_leaf(position.p_leaf)
+        , index(position.index)
+      {
+      }
+
+      // Pointer to the map associated with this iterator.
+      ibtree_map* p_map;
+
+      // Pointer to the leaf for this iterator. ETL_NULLPTR for end().
+      leaf_type* p_leaf;
+
+      // The index of the element in the leaf.
+      size_type index;
+    };
+
+    friend class iterator;
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree_map;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename ibtree_map::iterator& other)
+        : p_map(other.p_map)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator(const const_iterator& other)
+        : p_map(other.p_map)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_map->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->prev;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator =(const const_iterator& other)
+      {
+        p_map  = other.p_map;
+        p_leaf = other.p_leaf;
+        index  = other.index;
+        return *this;
+      }
+
+      const_reference operator *() const
+      {
+        return p_leaf->values.begin()[index];
+      }
+
+      const_pointer operator &() const
+      {
+        return &(p_leaf->values.begin()[index]);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(p_leaf->values.begin()[index]);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const ibtree_map& map, const leaf_position& position)
+        : p_map(&map)
+        , p_leaf(position.p_leaf)
+        , index(position.index)
+      {
+      }
+
+      // Pointer to the map associated with this iterator.
+      const ibtree_map* p_map;
+
+      // Pointer to the leaf for this iterator. ETL_NULLPTR for end().
+      const leaf_type* p_leaf;
+
+      // The index of the element in the leaf.
+      size_type index;
+    };
+
+    friend class const_iterator;
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, leaf_position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, leaf_position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, leaf_position());
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, leaf_position());
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the btree_map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, leaf_position(p_first, 0U));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the btree_map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, leaf_position());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If the key does not exist then one is inserted with a default value.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      leaf_position position = lower_position(key);
+
+      if (!is_match(position, key))
+      {
+        // Doesn't exist, so create a new one.
+        if (full())
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(btree_map_full));
+        }
+
+        ::new (open_gap(position, key)) value_type(key, mapped_type());
+      }
+
+      return position.p_leaf->values.begin()[position.index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_type& at(const K& key)
+    {
+      iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::btree_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const mapped_type& at(const K& key) const
+    {
+      const_iterator i_element = find(key);
+
+      ETL_ASSERT(i_element != end(), ETL_ERROR(btree_map_out_of_bounds));
+
+      return i_element->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the btree_map.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        destroy_subtree(p_root, height);
+      }
+
+      p_root  = ETL_NULLPTR;
+      p_first = ETL_NULLPTR;
+      p_last  = ETL_NULLPTR;
+      height  = 0U;
+
+      ETL_SUBTRACT_DEBUG_COUNT(current_size);
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(key_parameter_t key) const
+    {
+      return is_match(lower_position(key), key) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return is_match(lower_position(key), key) ? 1U : 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      leaf_position first = lower_position(key);
+      leaf_position last  = upper_of(first, key);
+
+      return ETL_OR_STD::make_pair(iterator(*this, normalise(first)), iterator(*this, normalise(last)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      leaf_position first = lower_position(key);
+      leaf_position last  = upper_of(first, key);
+
+      return ETL_OR_STD::make_pair(iterator(*this, normalise(first)), iterator(*this, normalise(last)));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      leaf_position first = lower_position(key);
+      leaf_position last  = upper_of(first, key);
+
+      return ETL_OR_STD::make_pair(const_iterator(*this, normalise(first)), const_iterator(*this, normalise(last)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      leaf_position first = lower_position(key);
+      leaf_position last  = upper_of(first, key);
+
+      return ETL_OR_STD::make_pair(const_iterator(*this, normalise(first)), const_iterator(*this, normalise(last)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element after the one erased.
+    //*************************************************************************
+    iterator erase(iterator position)
+    {
+      return erase(const_iterator(position));
+    }
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the element after the one erased.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      leaf_position next;
+
+      erase_key(position->first, next);
+
+      return iterator(*this, next);
+    }
+
+    //*************************************************************************
+    // Erase the key specified.
+    //*************************************************************************
+    size_type erase(key_parameter_t key)
+    {
+      leaf_position next;
+
+      // Return 1 if key value was found and removed
+      return erase_key(key, next) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+#if ETL_USING_CPP11
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      leaf_position next;
+
+      // Return 1 if key value was found and removed
+      return erase_key(key, next) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    ///\return An iterator to the element after the last one erased.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Erasing may move the elements that 'last' refers to, so count them first.
+      size_type n = static_cast<size_type>(etl::distance(first, last));
+
+      iterator itr(*this, leaf_position(const_cast<leaf_type*>(first.p_leaf), first.index));
+
+      while (n-- != 0U)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      leaf_position position = lower_position(key);
+
+      return is_match(position, key) ? iterator(*this, position) : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      leaf_position position = lower_position(key);
+
+      return is_match(position, key) ? iterator(*this, position) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      leaf_position position = lower_position(key);
+
+      return is_match(position, key) ? const_iterator(*this, position) : end();
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      leaf_position position = lower_position(key);
+
+      return is_match(position, key) ? const_iterator(*this, position) : end();
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      leaf_position position = lower_position(value.first);
+
+      if (is_match(position, value.first))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, position), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(btree_map_full));
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      ::new (open_gap(position, value.first)) value_type(value);
+
+      return ETL_OR_STD::make_pair(iterator(*this, position), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      leaf_position position = lower_position(value.first);
+
+      if (is_match(position, value.first))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, position), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(btree_map_full));
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      ::new (open_gap(position, value.first)) value_type(etl::move(value));
+
+      return ETL_OR_STD::make_pair(iterator(*this, position), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the btree_map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the btree_map starting at the position recommended.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the btree_map.
+    /// If asserts or exceptions are enabled, emits btree_map_full if the btree_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator(*this, normalise(lower_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, normalise(lower_position(key)));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, normalise(lower_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, normalise(lower_position(key)));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator(*this, normalise(upper_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, normalise(upper_position(key)));
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator(*this, normalise(upper_position(key)));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, normalise(upper_position(key)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (const ibtree_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_map& operator = (ibtree_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Check if the btree_map contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return is_match(lower_position(key), key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return is_match(lower_position(key), key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the size of the btree_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the btree_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the btree_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the btree_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the btree_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& node_pool, size_t max_size_)
+      : p_node_pool(&node_pool)
+      , p_root(ETL_NULLPTR)
+      , p_first(ETL_NULLPTR)
+      , p_last(ETL_NULLPTR)
+      , height(0U)
+      , current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another btree_map, which are already in order.
+    //*************************************************************************
+    void move_container(ibtree_map&& rhs)
+    {
+      clear();
+
+      iterator from = rhs.begin();
+
+      while (from != rhs.end())
+      {
+        insert(etl::move(*from));
+        ++from;
+      }
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Compares the key of an element with a key.
+    //*************************************************************************
+    struct element_less
+    {
+      explicit element_less(const key_compare& compare_)
+        : kcompare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator ()(const value_type& element, const K& key) const
+      {
+        return kcompare(element.first, key);
+      }
+
+      const key_compare& kcompare;
+    };
+
+    //*************************************************************************
+    /// Finds the first element with a key that is greater than a key.
+    //*************************************************************************
+    struct element_not_greater
+    {
+      explicit element_not_greater(const key_compare& compare_)
+        : kcompare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator ()(const value_type& element, const K& key) const
+      {
+        return !kcompare(key, element.first);
+      }
+
+      const key_compare& kcompare;
+    };
+
+    //*************************************************************************
+    /// Finds the first separating key that is greater than a key.
+    //*************************************************************************
+    struct key_not_greater
+    {
+      explicit key_not_greater(const key_compare& compare_)
+        : kcompare(compare_)
+      {
+      }
+
+      template <typename K>
+      bool operator ()(const key_type& separator, const K& key) const
+      {
+        return !kcompare(key, separator);
+      }
+
+      const key_compare& kcompare;
+    };
+
+    //*************************************************************************
+    /// The index of the child of an internal node that holds the key.
+    //*************************************************************************
+    template <typename K>
+    size_type child_index(const internal_type& node, const K& key) const
+    {
+      const key_type* p_keys = node.keys.begin();
+
+      return static_cast<size_type>(etl::lower_bound_branchless(p_keys, p_keys + node.count, key, key_not_greater(compare)) - p_keys);
+    }
+
+    //*************************************************************************
+    /// Finds the leaf that holds the key, or ETL_NULLPTR if the btree_map is empty.
+    //*************************************************************************
+    template <typename K>
+    leaf_type* find_leaf(const K& key) const
+    {
+      void* p_node = p_root;
+
+      for (size_type level = height; level != 0U; --level)
+      {
+        const internal_type& node = *static_cast<const internal_type*>(p_node);
+
+        p_node = node.children[child_index(node, key)];
+      }
+
+      return static_cast<leaf_type*>(p_node);
+    }
+
+    //*************************************************************************
+    /// The position of the first element not less than the key, in the leaf
+    /// that would hold the key.
+    //*************************************************************************
+    template <typename K>
+    leaf_position lower_position(const K& key) const
+    {
+      leaf_type* p_leaf = find_leaf(key);
+
+      if (p_leaf == ETL_NULLPTR)
+      {
+        return leaf_position();
+      }
+
+      const value_type* p_values = p_leaf->values.begin();
+
+      return leaf_position(p_leaf, static_cast<size_type>(etl::lower_bound_branchless(p_values, p_values + p_leaf->count, key, element_less(compare)) - p_values));
+    }
+
+    //*************************************************************************
+    /// The position of the first element greater than the key, in the leaf
+    /// that would hold the key.
+    //*************************************************************************
+    template <typename K>
+    leaf_position upper_position(const K& key) const
+    {
+      leaf_type* p_leaf = find_leaf(key);
+
+      if (p_leaf == ETL_NULLPTR)
+      {
+        return leaf_position();
+      }
+
+      const value_type* p_values = p_leaf->values.begin();
+
+      return leaf_position(p_leaf, static_cast<size_type>(etl::lower_bound_branchless(p_values, p_values + p_leaf->count, key, element_not_greater(compare)) - p_values));
+    }
+
+    //*************************************************************************
+    /// The upper bound of a key, from its lower bound.
+    //*************************************************************************
+    template <typename K>
+    leaf_position upper_of(const leaf_position& lower, const K& key) const
+    {
+      return is_match(lower, key) ? leaf_position(lower.p_leaf, lower.index + 1U) : lower;
+    }
+
+    //*************************************************************************
+    /// Checks if the lower bound position is an element with the key.
+    //*************************************************************************
+    template <typename K>
+    bool is_match(const leaf_position& position, const K& key) const
+    {
+      return (position.p_leaf != ETL_NULLPTR) &&
+             (position.index != position.p_leaf->count) &&
+             !compare(key, position.p_leaf->values.begin()[position.index].first);
+    }
+
+    //*************************************************************************
+    /// A position after the last element of a leaf becomes the first element
+    /// of the next leaf, or end().
+    //*************************************************************************
+    static leaf_position normalise(const leaf_position& position)
+    {
+      if ((position.p_leaf != ETL_NULLPTR) && (position.index == position.p_leaf->count))
+      {
+        return leaf_position(position.p_leaf->next, 0U);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Moves an object to uninitialised memory and destroys the original.
+    //*************************************************************************
+    template <typename T>
+    static void relocate(T* p_to, T* p_from)
+    {
+      ::new (p_to) T(ETL_MOVE(*p_from));
+      p_from->~T();
+    }
+
+    //*************************************************************************
+    /// Moves n objects to uninitialised memory that does not overlap them.
+    //*************************************************************************
+    template <typename T>
+    static void relocate_n(T* p_from, size_type n, T* p_to)
+    {
+      for (size_type i = 0U; i != n; ++i)
+      {
+        relocate(p_to + i, p_from + i);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if a node at the level is full.
+    //*************************************************************************
+    static bool is_full(const void* p_node, size_type level)
+    {
+      if (level == 0U)
+      {
+        return static_cast<const leaf_type*>(p_node)->count == leaf_type::Capacity;
+      }
+      else
+      {
+        return static_cast<const internal_type*>(p_node)->count == internal_type::Capacity;
+      }
+    }
+
+    //*************************************************************************
+    /// Allocates an empty leaf.
+    //*************************************************************************
+    leaf_type* create_leaf()
+    {
+      leaf_type* p_leaf = p_node_pool->template allocate<leaf_type>();
+
+      p_leaf->prev  = ETL_NULLPTR;
+      p_leaf->next  = ETL_NULLPTR;
+      p_leaf->count = 0U;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    /// Allocates an empty internal node.
+    //*************************************************************************
+    internal_type* create_internal()
+    {
+      internal_type* p_node = p_node_pool->template allocate<internal_type>();
+
+      p_node->count = 0U;
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Makes room for a new element at the lower bound position of the key,
+    /// which is updated if a leaf has to be split.
+    ///\return The uninitialised memory for the new element.
+    //*************************************************************************
+    template <typename K>
+    value_type* open_gap(leaf_position& position, const K& key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        leaf_type* p_leaf = create_leaf();
+
+        p_root   = p_leaf;
+        p_first  = p_leaf;
+        p_last   = p_leaf;
+        position = leaf_position(p_leaf, 0U);
+      }
+      else if (position.p_leaf->count == leaf_type::Capacity)
+      {
+        position = split_to_leaf(key);
+      }
+
+      leaf_type&  leaf     = *position.p_leaf;
+      value_type* p_values = leaf.values.begin();
+
+      for (size_type i = leaf.count; i != position.index; --i)
+      {
+        relocate(p_values + i, p_values + i - 1U);
+      }
+
+      ++leaf.count;
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return p_values + position.index;
+    }
+
+    //*************************************************************************
+    /// Searches for the key from the root, splitting every full node on the
+    /// way, so that a split never has to be passed back up the tree.
+    ///\return The lower bound position of the key, in a leaf that is not full.
+    //*************************************************************************
+    template <typename K>
+    leaf_position split_to_leaf(const K& key)
+    {
+      if (is_full(p_root, height))
+      {
+        // The tree grows at the root.
+        internal_type* p_new_root = create_internal();
+
+        p_new_root->children[0] = p_root;
+        p_root = p_new_root;
+        ++height;
+
+        split_child(*p_new_root, 0U, height - 1U);
+      }
+
+      void* p_node = p_root;
+
+      for (size_type level = height; level != 0U; --level)
+      {
+        internal_type& node  = *static_cast<internal_type*>(p_node);
+        size_type      index = child_index(node, key);
+
+        if (is_full(node.children[index], level - 1U))
+        {
+          split_child(node, index, level - 1U);
+
+          if (!compare(key, node.keys.begin()[index]))
+          {
+            ++index;
+          }
+        }
+
+        p_node = node.children[index];
+      }
+
+      leaf_type&        leaf     = *static_cast<leaf_type*>(p_node);
+      const value_type* p_values = leaf.values.begin();
+
+      return leaf_position(&leaf, static_cast<size_type>(etl::lower_bound_branchless(p_values, p_values + leaf.count, key, element_less(compare)) - p_values));
+    }
+
+    //*************************************************************************
+    /// Splits the full child of a node that is not full, moving the upper half
+    /// to a new node on its right.
+    //*************************************************************************
+    void split_child(internal_type& parent, size_type index, size_type child_level)
+    {
+      if (child_level == 0U)
+      {
+        leaf_type& left  = *static_cast<leaf_type*>(parent.children[index]);
+        leaf_type& right = *create_leaf();
+
+        const size_type keep = left.count / 2U;
+
+        relocate_n(left.values.begin() + keep, left.count - keep, right.values.begin());
+        right.count = left.count - keep;
+        left.count  = keep;
+
+        right.prev = &left;
+        right.next = left.next;
+
+        if (left.next != ETL_NULLPTR)
+        {
+          left.next->prev = &right;
+        }
+        else
+        {
+          p_last = &right;
+        }
+
+        left.next = &right;
+
+        insert_child(parent, index, right.values.begin()[0].first, &right);
+      }
+      else
+      {
+        internal_type& left  = *static_cast<internal_type*>(parent.children[index]);
+        internal_type& right = *create_internal();
+
+        const size_type middle = left.count / 2U;
+
+        // The keys after the middle key, and the children to the right of them, move to the right node.
+        right.count = left.count - middle - 1U;
+        relocate_n(left.keys.begin() + middle + 1U, right.count, right.keys.begin());
+        etl::copy(left.children + middle + 1U, left.children + left.count + 1U, right.children);
+
+        // The middle key moves up to the parent.
+        key_type* p_middle = left.keys.begin() + middle;
+        insert_child(parent, index, *p_middle, &right);
+        p_middle->~key_type();
+
+        left.count = middle;
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a separating key at the index and a child after it.
+    //*************************************************************************
+    void insert_child(internal_type& parent, size_type index, const key_type& key, void* p_child)
+    {
+      key_type* p_keys = parent.keys.begin();
+
+      for (size_type i = parent.count; i != index; --i)
+      {
+        relocate(p_keys + i, p_keys + i - 1U);
+      }
+
+      etl::copy_backward(parent.children + index + 1U, parent.children + parent.count + 1U, parent.children + parent.count + 2U);
+
+      ::new (p_keys + index) key_type(key);
+      parent.children[index + 1U] = p_child;
+      ++parent.count;
+    }
+
+    //*************************************************************************
+    /// Removes the separating key at the index, which has already been
+    /// destroyed or moved, and the child after it.
+    //*************************************************************************
+    void close_gap(internal_type& parent, size_type index)
+    {
+      key_type* p_keys = parent.keys.begin();
+
+      for (size_type i = index + 1U; i != parent.count; ++i)
+      {
+        relocate(p_keys + i - 1U, p_keys + i);
+      }
+
+      etl::copy(parent.children + index + 2U, parent.children + parent.count + 1U, parent.children + index + 1U);
+      --parent.count;
+    }
+
+    //*************************************************************************
+    /// Erases the key.
+    ///\param key  The key to erase.
+    ///\param next Set to the position of the element after the erased one.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    template <typename K>
+    bool erase_key(const K& key, leaf_position& next)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      const size_type old_size = current_size;
+
+      erase_from(p_root, height, key, next);
+
+      if (current_size == old_size)
+      {
+        return false;
+      }
+
+      if (height == 0U)
+      {
+        leaf_type* p_leaf = static_cast<leaf_type*>(p_root);
+
+        if (p_leaf->count == 0U)
+        {
+          p_node_pool->release(p_leaf);
+          p_root  = ETL_NULLPTR;
+          p_first = ETL_NULLPTR;
+          p_last  = ETL_NULLPTR;
+          next    = leaf_position();
+        }
+      }
+      else
+      {
+        internal_type* p_node = static_cast<internal_type*>(p_root);
+
+        if (p_node->count == 0U)
+        {
+          // The tree shrinks at the root.
+          p_root = p_node->children[0];
+          --height;
+          p_node_pool->release(p_node);
+        }
+      }
+
+      next = normalise(next);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the key from the subtree, and rebalances the children that are
+    /// left with too few elements.
+    /// The key is not used after the element has been destroyed, so may refer
+    /// to the element itself.
+    ///\return <b>true</b> if the node is left with too few elements or children.
+    //*************************************************************************
+    template <typename K>
+    bool erase_from(void* p_node, size_type level, const K& key, leaf_position& next)
+    {
+      if (level == 0U)
+      {
+        leaf_type&  leaf     = *static_cast<leaf_type*>(p_node);
+        value_type* p_values = leaf.values.begin();
+
+        const size_type index = static_cast<size_type>(etl::lower_bound_branchless(p_values, p_values + leaf.count, key, element_less(compare)) - p_values);
+
+        if ((index == leaf.count) || compare(key, p_values[index].first))
+        {
+          // Not found.
+          return false;
+        }
+
+        p_values[index].~value_type();
+
+        for (size_type i = index + 1U; i != leaf.count; ++i)
+        {
+          relocate(p_values + i - 1U, p_values + i);
+        }
+
+        --leaf.count;
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT;
+
+        next = leaf_position(&leaf, index);
+
+        return leaf.count < leaf_type::Minimum;
+      }
+      else
+      {
+        internal_type&  node  = *static_cast<internal_type*>(p_node);
+        const size_type index = child_index(node, key);
+
+        if (erase_from(node.children[index], level - 1U, key, next))
+        {
+          if (level == 1U)
+          {
+            rebalance_leaf(node, index, next);
+          }
+          else
+          {
+            rebalance_internal(node, index);
+          }
+        }
+
+        return (node.count + 1U) < internal_type::Minimum;
+      }
+    }
+
+    //*************************************************************************
+    /// Gives a leaf with too few elements one from a sibling, or merges it
+    /// with one.
+    ///\param next The position after an erased element in the leaf, which is
+    /// kept pointing at the same element.
+    //*************************************************************************
+    void rebalance_leaf(internal_type& parent, size_type index, leaf_position& next)
+    {
+      leaf_type& leaf    = *static_cast<leaf_type*>(parent.children[index]);
+      leaf_type* p_left  = (index != 0U)           ? static_cast<leaf_type*>(parent.children[index - 1U]) : ETL_NULLPTR;
+      leaf_type* p_right = (index != parent.count) ? static_cast<leaf_type*>(parent.children[index + 1U]) : ETL_NULLPTR;
+
+      value_type* p_values = leaf.values.begin();
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > leaf_type::Minimum))
+      {
+        // Take the last element of the left sibling.
+        for (size_type i = leaf.count; i != 0U; --i)
+        {
+          relocate(p_values + i, p_values + i - 1U);
+        }
+
+        relocate(p_values, p_left->values.begin() + p_left->count - 1U);
+        --p_left->count;
+        ++leaf.count;
+        ++next.index;
+
+        parent.keys.begin()[index - 1U] = p_values[0].first;
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > leaf_type::Minimum))
+      {
+        // Take the first element of the right sibling.
+        value_type* p_right_values = p_right->values.begin();
+
+        relocate(p_values + leaf.count, p_right_values);
+
+        for (size_type i = 1U; i != p_right->count; ++i)
+        {
+          relocate(p_right_values + i - 1U, p_right_values + i);
+        }
+
+        --p_right->count;
+        ++leaf.count;
+
+        parent.keys.begin()[index] = p_right_values[0].first;
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        next = leaf_position(p_left, p_left->count + next.index);
+        merge_leaves(parent, index - 1U);
+      }
+      else
+      {
+        merge_leaves(parent, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the child after the index into the child at the index.
+    //*************************************************************************
+    void merge_leaves(internal_type& parent, size_type index)
+    {
+      leaf_type& left  = *static_cast<leaf_type*>(parent.children[index]);
+      leaf_type& right = *static_cast<leaf_type*>(parent.children[index + 1U]);
+
+      relocate_n(right.values.begin(), right.count, left.values.begin() + left.count);
+      left.count += right.count;
+
+      left.next = right.next;
+
+      if (right.next != ETL_NULLPTR)
+      {
+        right.next->prev = &left;
+      }
+      else
+      {
+        p_last = &left;
+      }
+
+      parent.keys.begin()[index].~key_type();
+      close_gap(parent, index);
+
+      p_node_pool->release(&right);
+    }
+
+    //*************************************************************************
+    /// Gives an internal node with too few children one from a sibling, or
+    /// merges it with one.
+    //*************************************************************************
+    void rebalance_internal(internal_type& parent, size_type index)
+    {
+      internal_type& node    = *static_cast<internal_type*>(parent.children[index]);
+      internal_type* p_left  = (index != 0U)           ? static_cast<internal_type*>(parent.children[index - 1U]) : ETL_NULLPTR;
+      internal_type* p_right = (index != parent.count) ? static_cast<internal_type*>(parent.children[index + 1U]) : ETL_NULLPTR;
+
+      key_type* p_keys = node.keys.begin();
+
+      if ((p_left != ETL_NULLPTR) && ((p_left->count + 1U) > internal_type::Minimum))
+      {
+        // The separating key comes down, and the last key of the left sibling goes up.
+        for (size_type i = node.count; i != 0U; --i)
+        {
+          relocate(p_keys + i, p_keys + i - 1U);
+        }
+
+        etl::copy_backward(node.children, node.children + node.count + 1U, node.children + node.count + 2U);
+
+        relocate(p_keys, parent.keys.begin() + index - 1U);
+        relocate(parent.keys.begin() + index - 1U, p_left->keys.begin() + p_left->count - 1U);
+        node.children[0] = p_left->children[p_left->count];
+
+        --p_left->count;
+        ++node.count;
+      }
+      else if ((p_right != ETL_NULLPTR) && ((p_right->count + 1U) > internal_type::Minimum))
+      {
+        // The separating key comes down, and the first key of the right sibling goes up.
+        key_type* p_right_keys = p_right->keys.begin();
+
+        relocate(p_keys + node.count, parent.keys.begin() + index);
+        relocate(parent.keys.begin() + index, p_right_keys);
+        node.children[node.count + 1U] = p_right->children[0];
+
+        for (size_type i = 1U; i != p_right->count; ++i)
+        {
+          relocate(p_right_keys + i - 1U, p_right_keys + i);
+        }
+
+        etl::copy(p_right->children + 1U, p_right->children + p_right->count + 1U, p_right->children);
+
+        --p_right->count;
+        ++node.count;
+      }
+      else if (p_left != ETL_NULLPTR)
+      {
+        merge_internals(parent, index - 1U);
+      }
+      else
+      {
+        merge_internals(parent, index);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the child after the index into the child at the index, with the
+    /// separating key between them.
+    //*************************************************************************
+    void merge_internals(internal_type& parent, size_type index)
+    {
+      internal_type& left  = *static_cast<internal_type*>(parent.children[index]);
+      internal_type& right = *static_cast<internal_type*>(parent.children[index + 1U]);
+
+      relocate(left.keys.begin() + left.count, parent.keys.begin() + index);
+      relocate_n(right.keys.begin(), right.count, left.keys.begin() + left.count + 1U);
+      etl::copy(right.children, right.children + right.count + 1U, left.children + left.count + 1U);
+      left.count += right.count + 1U;
+
+      close_gap(parent, index);
+
+      p_node_pool->release(&right);
+    }
+
+    //*************************************************************************
+    /// Destroys the elements and keys of a subtree, and releases its nodes.
+    //*************************************************************************
+    void destroy_subtree(void* p_node, size_type level)
+    {
+      if (level == 0U)
+      {
+        leaf_type& leaf = *static_cast<leaf_type*>(p_node);
+
+        etl::destroy(leaf.values.begin(), leaf.values.begin() + leaf.count);
+      }
+      else
+      {
+        internal_type& node = *static_cast<internal_type*>(p_node);
+
+        for (size_type i = 0U; i <= node.count; ++i)
+        {
+          destroy_subtree(node.children[i], level - 1U);
+        }
+
+        etl::destroy(node.keys.begin(), node.keys.begin() + node.count);
+      }
+
+      p_node_pool->release(p_node);
+    }
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    etl::ipool* p_node_pool;  ///< The pool of leaf and internal nodes.
+    void*       p_root;       ///< A leaf if the height is zero, otherwise an internal node.
+    leaf_type*  p_first;      ///< The first leaf.
+    leaf_type*  p_last;       ///< The last leaf.
+    size_type   height;       ///< The number of levels of internal nodes.
+    size_type   current_size;
+    key_compare compare;
+
+    const size_type CAPACITY;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_map()
+    {
+    }
+#else
+  protected:
+    ~ibtree_map()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated btree_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare>            base;
+    typedef etl::btree_map_pool_size<TKey, TValue, MAX_SIZE_> pool_size;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base(node_pool, MAX_SIZE)
+      , node_pool(reinterpret_cast<typename pool_type::element*>(node_buffer.raw), pool_size::Node_Count)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base(node_pool, MAX_SIZE)
+      , node_pool(reinterpret_cast<typename pool_type::element*>(node_buffer.raw), pool_size::Node_Count)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base(node_pool, MAX_SIZE)
+      , node_pool(reinterpret_cast<typename pool_type::element*>(node_buffer.raw), pool_size::Node_Count)
+    {
+      if (this != &other)
+      {
+        base::move_container(etl::move(other));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base(node_pool, MAX_SIZE)
+      , node_pool(reinterpret_cast<typename pool_type::element*>(node_buffer.raw), pool_size::Node_Count)
+    {
+      base::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base::value_type> init)
+      : base(node_pool, MAX_SIZE)
+      , node_pool(reinterpret_cast<typename pool_type::element*>(node_buffer.raw), pool_size::Node_Count)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator = (const btree_map& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator = (btree_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typedef etl::generic_pool_ext<pool_size::Node_Size, pool_size::Node_Alignment> pool_type;
+
+    /// The storage for the nodes, aligned so that each node starts a cache line.
+    etl::uninitialized_buffer<pool_size::Node_Size, pool_size::Node_Count, (ETL_CACHE_LINE_SIZE > pool_size::Node_Alignment) ? ETL_CACHE_LINE_SIZE : pool_size::Node_Alignment> node_buffer;
+
+    /// The pool of nodes used for the btree_map.
+    pool_type node_pool;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  btree_map(TPairs...) -> btree_map<etl::remove_const_t<typename etl::nth_type_t<0, TPairs...>::first_type>,
+                                    typename etl::nth_type_t<0, TPairs...>::second_type,
+                                    sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_btree_map(TPairs&&... pairs) -> etl::btree_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+#endif
+
+  //*************************************************************************
+  /// A btree_map that uses an external pool of nodes.
+  /// The pool must hold btree_map_pool_size<TKey, TMapped, MAX_SIZE>::Node_Count
+  /// items of at least btree_map_pool_size<TKey, TMapped, MAX_SIZE>::Node_Size bytes.
+  //*************************************************************************
+  template <typename TKey, typename TValue, typename TCompare = etl::less<TKey> >
+  class btree_map_ext : public etl::ibtree_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param node_pool The pool of nodes.
+    ///\param max_size  The maximum number of elements.
+    //*************************************************************************
+    btree_map_ext(etl::ipool& node_pool, size_t max_size)
+      : base(node_pool, max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map_ext(const btree_map_ext& other, etl::ipool& node_pool, size_t max_size)
+      : base(node_pool, max_size)
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map_ext(btree_map_ext&& other, etl::ipool& node_pool, size_t max_size)
+      : base(node_pool, max_size)
+    {
+      if (this != &other)
+      {
+        base::move_container(etl::move(other));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map_ext(TIterator first, TIterator last, etl::ipool& node_pool, size_t max_size)
+      : base(node_pool, max_size)
+    {
+      base::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map_ext()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map_ext& operator = (const btree_map_ext& rhs)
+    {
+      base::operator=(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map_ext& operator = (btree_map_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    btree_map_ext(const btree_map_ext&) ETL_DELETE;
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator <=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_map.
+  ///\param rhs Reference to the second btree_map.
+  ///\return <b>true</b> if the first btree_map is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator >=(const etl::ibtree_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,562 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+#define ETL_CALLBACK_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "function.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "placement_new.h"
+#include "delegate.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+#if defined(ETL_IN_UNIT_TEST) && ETL_NOT_USING_STL
+  #define ETL_DISABLE_TIMER_UPDATES
+  #define ETL_ENABLE_TIMER_UPDATES
+  #define ETL_TIMER_UPDATES_ENABLED true
+
+  #undef ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+  #undef ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+#else
+  #if !defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && !defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK not defined
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK) && defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+    #error Only define one of ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK or ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK
+  #endif
+
+  #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    #define ETL_DISABLE_TIMER_UPDATES (++process_semaphore)
+    #define ETL_ENABLE_TIMER_UPDATES  (--process_semaphore)
+    #define ETL_TIMER_UPDATES_ENABLED (process_semaphore.load() == 0)
+  #endif
+#endif
+
+#if defined(ETL_CALLBACK_TIMER_USE_INTERRUPT_LOCK)
+  #if !defined(ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS) || !defined(ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS)
+    #error ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS and/or ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS not defined
+  #endif
+
+  #define ETL_DISABLE_TIMER_UPDATES ETL_CALLBACK_TIMER_DISABLE_INTERRUPTS
+  #define ETL_ENABLE_TIMER_UPDATES  ETL_CALLBACK_TIMER_ENABLE_INTERRUPTS
+  #define ETL_TIMER_UPDATES_ENABLED true
+#endif
+
+namespace etl
+{
+  //*************************************************************************
+  /// The configuration of a timer wheel timer.
+  struct callback_timer_wheel_data
+  {
+    typedef etl::delegate<void(void)> callback_type;
+
+    enum callback_type_id
+    {
+      C_CALLBACK,
+      IFUNCTION,
+      DELEGATE
+    };
+
+    //*******************************************
+    callback_timer_wheel_data()
+      : p_callback(ETL_NULLPTR),
+        period(0),
+        id(etl::timer::id::NO_TIMER),
+        repeating(true),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+    //*******************************************
+    /// C function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer::id::type id_,
+                              void                 (*p_callback_)(),
+                              uint32_t             period_,
+                              bool                 repeating_)
+      : p_callback(reinterpret_cast<void*>(p_callback_)),
+        period(period_),
+        id(id_),
+        repeating(repeating_),
+        cbk_type(C_CALLBACK)
+    {
+    }
+
+    //*******************************************
+    /// ETL function callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer::id::type  id_,
+                              etl::ifunction<void>& callback_,
+                              uint32_t              period_,
+                              bool                  repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        id(id_),
+        repeating(repeating_),
+        cbk_type(IFUNCTION)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*******************************************
+    /// ETL delegate callback
+    //*******************************************
+    callback_timer_wheel_data(etl::timer::id::type id_,
+                              callback_type&       callback_,
+                              uint32_t             period_,
+                              bool                 repeating_)
+      : p_callback(reinterpret_cast<void*>(&callback_)),
+        period(period_),
+        id(id_),
+        repeating(repeating_),
+        cbk_type(DELEGATE)
+    {
+    }
+#endif
+
+    void*                 p_callback;
+    uint32_t              period;
+    etl::timer::id::type  id;
+    bool                  repeating;
+    callback_type_id      cbk_type;
+
+  private:
+
+    // Disabled.
+    callback_timer_wheel_data(const callback_timer_wheel_data& other);
+    callback_timer_wheel_data& operator =(const callback_timer_wheel_data& other);
+  };
+
+  //***************************************************************************
+  /// Interface for callback timer wheel.
+  /// Has the same interface and callback semantics as etl::icallback_timer,
+  /// but keeps the active timers in a hierarchical timing wheel rather than a
+  /// sorted list. Starting and stopping a timer take constant time, whatever
+  /// the number of active timers, and a tick costs time in proportion to the
+  /// number of timers that expire.
+  /// Timers that expire in the same tick are called in the same order as
+  /// etl::icallback_timer; the most recently started first.
+  /// One difference: a repeating timer with a period of zero is rescheduled for
+  /// the next tick, where etl::icallback_timer would call it repeatedly without
+  /// returning from tick.
+  //***************************************************************************
+  class icallback_timer_wheel
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(void     (*p_callback_)(),
+                                        uint32_t period_,
+                                        bool     repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) callback_timer_wheel_data(id, p_callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(etl::ifunction<void>& callback_,
+                                        uint32_t              period_,
+                                        bool                  repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) callback_timer_wheel_data(id, callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+
+#if ETL_USING_CPP11
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(callback_type& callback_,
+                                        uint32_t       period_,
+                                        bool           repeating_)
+    {
+      etl::timer::id::type id = find_free_timer();
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) callback_timer_wheel_data(id, callback_, period_, repeating_);
+        ++registered_timers;
+      }
+
+      return id;
+    }
+#endif
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        callback_timer_wheel_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (active_wheel.is_active(timer.id))
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          // Reset in-place.
+          new (&timer) callback_timer_wheel_data();
+          --registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ETL_DISABLE_TIMER_UPDATES;
+      active_wheel.clear();
+      ETL_ENABLE_TIMER_UPDATES;
+
+      for (int i = 0; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) callback_timer_wheel_data();
+      }
+
+      registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (ETL_TIMER_UPDATES_ENABLED)
+        {
+          expired_handler handler(*this);
+
+          active_wheel.tick(count, handler);
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::INACTIVE)
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            if (active_wheel.is_active(timer.id))
+            {
+              active_wheel.remove(timer.id);
+            }
+
+            active_wheel.insert(timer.id, immediate_ ? 0 : timer.period);
+            ETL_ENABLE_TIMER_UPDATES;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        callback_timer_wheel_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (active_wheel.is_active(timer.id))
+          {
+            ETL_DISABLE_TIMER_UPDATES;
+            active_wheel.remove(timer.id);
+            ETL_ENABLE_TIMER_UPDATES;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_wheel(callback_timer_wheel_data* const        timer_array_,
+                          etl::private_timer_wheel::node* const   node_array_,
+                          const uint_least8_t                     MAX_TIMERS_)
+      : timer_array(timer_array_),
+        active_wheel(node_array_, MAX_TIMERS_),
+        enabled(false),
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+        process_semaphore(0),
+#endif
+        registered_timers(0),
+        MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Called by the wheel for each timer as it expires.
+    //*******************************************
+    struct expired_handler
+    {
+      expired_handler(icallback_timer_wheel& owner_)
+        : owner(owner_)
+      {
+      }
+
+      void operator ()(etl::timer::id::type id)
+      {
+        owner.expired(id);
+      }
+
+      icallback_timer_wheel& owner;
+    };
+
+    friend struct expired_handler;
+
+    //*******************************************
+    /// Reinserts a repeating timer and calls the callback.
+    /// A repeating timer with a period of zero is rescheduled for the next tick.
+    //*******************************************
+    void expired(etl::timer::id::type id)
+    {
+      callback_timer_wheel_data& timer = timer_array[id];
+
+      if (timer.repeating)
+      {
+        // Reinsert the timer.
+        active_wheel.insert(timer.id, (timer.period == 0U) ? 1U : timer.period);
+      }
+
+      if (timer.p_callback != ETL_NULLPTR)
+      {
+        if (timer.cbk_type == callback_timer_wheel_data::C_CALLBACK)
+        {
+          // Call the C callback.
+          reinterpret_cast<void(*)()>(timer.p_callback)();
+        }
+        else if (timer.cbk_type == callback_timer_wheel_data::IFUNCTION)
+        {
+          // Call the function wrapper callback.
+          (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+        }
+#if ETL_USING_CPP11
+        else if (timer.cbk_type == callback_timer_wheel_data::DELEGATE)
+        {
+          // Call the delegate callback.
+          (*reinterpret_cast<callback_type*>(timer.p_callback))();
+        }
+#endif
+      }
+    }
+
+    //*******************************************
+    /// Finds an unregistered timer.
+    //*******************************************
+    etl::timer::id::type find_free_timer() const
+    {
+      if (registered_timers < MAX_TIMERS)
+      {
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          if (timer_array[i].id == etl::timer::id::NO_TIMER)
+          {
+            return i;
+          }
+        }
+      }
+
+      return etl::timer::id::NO_TIMER;
+    }
+
+    // The array of timer data structures.
+    callback_timer_wheel_data* const timer_array;
+
+    // The wheel of active timers.
+    etl::private_timer_wheel::wheel active_wheel;
+
+    volatile bool enabled;
+#if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
+    volatile etl::timer_semaphore_t process_semaphore;
+#endif
+    volatile uint_least8_t registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The callback timer wheel
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_>
+  class callback_timer_wheel : public etl::icallback_timer_wheel
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_wheel()
+      : icallback_timer_wheel(timer_array, node_array, MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    callback_timer_wheel_data       timer_array[MAX_TIMERS_];
+    etl::private_timer_wheel::node  node_array[MAX_TIMERS_];
+  };
+}
+
+#undef ETL_DISABLE_TIMER_UPDATES
+#undef ETL_ENABLE_TIMER_UPDATES
+#undef ETL_TIMER_UPDATES_ENABLED
+
+#endif
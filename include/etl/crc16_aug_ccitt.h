@@ -75,6 +75,8 @@ namespace etl
   typedef etl::crc16_aug_ccitt_t<256U> crc16_aug_ccitt_t256;
   typedef etl::crc16_aug_ccitt_t<16U>  crc16_aug_ccitt_t16;
   typedef etl::crc16_aug_ccitt_t<4U>   crc16_aug_ccitt_t4;
+  typedef etl::crc16_aug_ccitt_t<2048U> crc16_aug_ccitt_t8x256;
+  typedef etl::crc16_aug_ccitt_t<4096U> crc16_aug_ccitt_t16x256;
   typedef crc16_aug_ccitt_t256         crc16_aug_ccitt;
 }
 #endif
@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc16_dect_r_t<256U> crc16_dect_r_t256;
   typedef etl::crc16_dect_r_t<16U>  crc16_dect_r_t16;
   typedef etl::crc16_dect_r_t<4U>   crc16_dect_r_t4;
+  typedef etl::crc16_dect_r_t<2048U> crc16_dect_r_t8x256;
+  typedef etl::crc16_dect_r_t<4096U> crc16_dect_r_t16x256;
   typedef crc16_dect_r_t256         crc16_dectr;
 }
 #endif
@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc16_modbus_t<256U> crc16_modbus_t256;
   typedef etl::crc16_modbus_t<16U>  crc16_modbus_t16;
   typedef etl::crc16_modbus_t<4U>   crc16_modbus_t4;
+  typedef etl::crc16_modbus_t<2048U> crc16_modbus_t8x256;
+  typedef etl::crc16_modbus_t<4096U> crc16_modbus_t16x256;
   typedef crc16_modbus_t256         crc16_modbus;
 }
 #endif
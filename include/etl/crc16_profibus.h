@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc16_profibus_t<256U> crc16_profibus_t256;
   typedef etl::crc16_profibus_t<16U>  crc16_profibus_t16;
   typedef etl::crc16_profibus_t<4U>   crc16_profibus_t4;
+  typedef etl::crc16_profibus_t<2048U> crc16_profibus_t8x256;
+  typedef etl::crc16_profibus_t<4096U> crc16_profibus_t16x256;
   typedef crc16_profibus_t256         crc16_profibus;
 }
 #endif
@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc16_teledisk_t<256U> crc16_teledisk_t256;
   typedef etl::crc16_teledisk_t<16U>  crc16_teledisk_t16;
   typedef etl::crc16_teledisk_t<4U>   crc16_teledisk_t4;
+  typedef etl::crc16_teledisk_t<2048U> crc16_teledisk_t8x256;
+  typedef etl::crc16_teledisk_t<4096U> crc16_teledisk_t16x256;
   typedef crc16_teledisk_t256         crc16_teledisk;
 }
 #endif
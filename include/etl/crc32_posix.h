@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc32_posix_t<256U> crc32_posix_t256;
   typedef etl::crc32_posix_t<16U>  crc32_posix_t16;
   typedef etl::crc32_posix_t<4U>   crc32_posix_t4;
+  typedef etl::crc32_posix_t<2048U> crc32_posix_t8x256;
+  typedef etl::crc32_posix_t<4096U> crc32_posix_t16x256;
   typedef crc32_posix_t256         crc32_posix;
 }
 #endif
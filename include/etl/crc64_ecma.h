@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc64_ecma_t<256U> crc64_ecma_t256;
   typedef etl::crc64_ecma_t<16U>  crc64_ecma_t16;
   typedef etl::crc64_ecma_t<4U>   crc64_ecma_t4;
+  typedef etl::crc64_ecma_t<2048U> crc64_ecma_t8x256;
+  typedef etl::crc64_ecma_t<4096U> crc64_ecma_t16x256;
   typedef crc64_ecma_t256         crc64_ecma;
 }
 #endif
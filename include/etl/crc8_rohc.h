@@ -73,6 +73,8 @@ namespace etl
   typedef etl::crc8_rohc_t<256U> crc8_rohc_t256;
   typedef etl::crc8_rohc_t<16U>  crc8_rohc_t16;
   typedef etl::crc8_rohc_t<4U>   crc8_rohc_t4;
+  typedef etl::crc8_rohc_t<2048U> crc8_rohc_t8x256;
+  typedef etl::crc8_rohc_t<4096U> crc8_rohc_t16x256;
   typedef crc8_rohc_t256         crc8_rohc;
 }
 
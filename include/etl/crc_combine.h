@@ -0,0 +1,175 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CRC_COMBINE_INCLUDED
+#define ETL_CRC_COMBINE_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include "private/crc_implementation.h"
+
+#include <stdint.h>
+
+///\defgroup crc_combine CRC combination of independently calculated blocks.
+/// The CRC of a buffer may be calculated as a number of independent chunks,
+/// possibly on different threads, and the results combined.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for CRC combination.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  class crc_combine_exception : public etl::exception
+  {
+  public:
+
+    crc_combine_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid chunk count exception.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  class crc_combine_invalid_chunks : public etl::crc_combine_exception
+  {
+  public:
+
+    crc_combine_invalid_chunks(string_type file_name_, numeric_type line_number_)
+      : crc_combine_exception(ETL_ERROR_TEXT("crc_combine:chunks", ETL_CRC_COMBINE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Combines the CRCs of two consecutive blocks.
+  ///\tparam TCrc     The CRC type. i.e. etl::crc32
+  ///\param crc_a     The CRC of the first block.
+  ///\param crc_b     The CRC of the second block.
+  ///\param length_b  The length of the second block, in bytes.
+  ///\return The CRC of the first block followed by the second.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    return TCrc::combine(crc_a, crc_b, length_b);
+  }
+
+  //***************************************************************************
+  /// Gets a chunk of a buffer that is split in to a number of chunks.
+  /// All of the chunks are the same size, except the last, which also holds the remainder.
+  ///\param data             The buffer.
+  ///\param index            The index of the chunk.
+  ///\param number_of_chunks The number of chunks.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  inline etl::span<const uint8_t> crc_chunk(etl::span<const uint8_t> data, size_t index, size_t number_of_chunks)
+  {
+    ETL_ASSERT_AND_RETURN_VALUE((number_of_chunks != 0U) && (index < number_of_chunks), ETL_ERROR(crc_combine_invalid_chunks), etl::span<const uint8_t>());
+
+    const size_t chunk_size = data.size() / number_of_chunks;
+    const size_t offset     = index * chunk_size;
+    const size_t length     = (index == (number_of_chunks - 1U)) ? (data.size() - offset) : chunk_size;
+
+    return data.subspan(offset, length);
+  }
+
+  //***************************************************************************
+  /// Combines the CRCs of the chunks of a buffer, as split by etl::crc_chunk.
+  ///\tparam TCrc       The CRC type. i.e. etl::crc32
+  ///\param chunk_crcs  The CRCs of each chunk, in order.
+  ///\param data_length The total length of the buffer.
+  ///\return The CRC of the whole buffer.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine_chunks(etl::span<const typename TCrc::value_type> chunk_crcs, size_t data_length)
+  {
+    typedef typename TCrc::value_type value_type;
+
+    ETL_ASSERT_AND_RETURN_VALUE(!chunk_crcs.empty(), ETL_ERROR(crc_combine_invalid_chunks), TCrc().value());
+
+    const size_t number_of_chunks = chunk_crcs.size();
+    const size_t chunk_size       = data_length / number_of_chunks;
+
+    value_type crc = chunk_crcs[0];
+
+    for (size_t i = 1U; i < number_of_chunks; ++i)
+    {
+      const size_t length = (i == (number_of_chunks - 1U)) ? (data_length - (i * chunk_size)) : chunk_size;
+
+      crc = TCrc::combine(crc, chunk_crcs[i], length);
+    }
+
+    return crc;
+  }
+
+  //***************************************************************************
+  /// Calculates the CRC of a buffer as a number of independent chunks, then
+  /// combines them. The chunk CRCs are stored in 'chunk_crcs', which also
+  /// determines the number of chunks.
+  /// This is the sequential reference for the threaded use of etl::crc_chunk
+  /// and etl::crc_combine_chunks.
+  ///\tparam TCrc      The CRC type. i.e. etl::crc32
+  ///\param data       The buffer.
+  ///\param chunk_crcs The storage for the CRCs of each chunk.
+  ///\return The CRC of the whole buffer.
+  ///\ingroup crc_combine
+  //***************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_chunked(etl::span<const uint8_t> data, etl::span<typename TCrc::value_type> chunk_crcs)
+  {
+    typedef typename TCrc::value_type value_type;
+
+    ETL_ASSERT_AND_RETURN_VALUE(!chunk_crcs.empty(), ETL_ERROR(crc_combine_invalid_chunks), TCrc().value());
+
+    const size_t number_of_chunks = chunk_crcs.size();
+
+    for (size_t i = 0U; i < number_of_chunks; ++i)
+    {
+      const etl::span<const uint8_t> chunk = etl::crc_chunk(data, i, number_of_chunks);
+
+      chunk_crcs[i] = TCrc(chunk.begin(), chunk.end()).value();
+    }
+
+    return etl::crc_combine_chunks<TCrc>(etl::span<const value_type>(chunk_crcs.begin(), chunk_crcs.end()), data.size());
+  }
+}
+
+#endif
@@ -0,0 +1,1551 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_FLAT_MAP_INCLUDED
+#define ETL_DENSE_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "span.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_flat_map dense_flat_map
+/// A flat map with the capacity defined at compile time, that stores the keys
+/// in one sorted array and the mapped values in another, in the same order.
+/// A search only reads the dense array of keys, and iterating the keys or the
+/// values reads memory in order.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+/// As there are no stored key/value pairs, the iterators return a pair of
+/// references, like std::flat_map.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the dense_flat_map.
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  class dense_flat_map_exception : public etl::exception
+  {
+  public:
+
+    dense_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the dense_flat_map.
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  class dense_flat_map_full : public etl::dense_flat_map_exception
+  {
+  public:
+
+    dense_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : dense_flat_map_exception(ETL_ERROR_TEXT("dense_flat_map:full", ETL_DENSE_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the dense_flat_map.
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  class dense_flat_map_out_of_bounds : public etl::dense_flat_map_exception
+  {
+  public:
+
+    dense_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : dense_flat_map_exception(ETL_ERROR_TEXT("dense_flat_map:bounds", ETL_DENSE_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_dense_flat_map
+  {
+    //*************************************************************************
+    /// A reference to a key and its mapped value.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct reference_pair
+    {
+      reference_pair(const TKey& first_, TMapped& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      //***********************************************************************
+      /// Converts to a key/value pair, such as value_type.
+      //***********************************************************************
+      template <typename TFirst, typename TSecond>
+      operator ETL_OR_STD::pair<TFirst, TSecond>() const
+      {
+        return ETL_OR_STD::pair<TFirst, TSecond>(first, second);
+      }
+
+      const TKey& first;
+      TMapped&    second;
+    };
+
+    //*************************************************************************
+    /// Returned by the iterator's operator ->, as there is no stored pair to
+    /// point to.
+    //*************************************************************************
+    template <typename TReference>
+    class arrow_proxy
+    {
+    public:
+
+      explicit arrow_proxy(const TReference& reference_)
+        : reference(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &reference;
+      }
+
+    private:
+
+      TReference reference;
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized dense_flat_maps.
+  /// Can be used as a reference type for all dense_flat_maps containing a
+  /// specific type.
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class idense_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<TKey, TMapped> value_type;
+    typedef TKey                            key_type;
+    typedef TMapped                         mapped_type;
+    typedef TKeyCompare                     key_compare;
+    typedef size_t                          size_type;
+    typedef ptrdiff_t                       difference_type;
+
+    typedef etl::private_dense_flat_map::reference_pair<TKey, TMapped>       reference;
+    typedef etl::private_dense_flat_map::reference_pair<TKey, const TMapped> const_reference;
+    typedef etl::private_dense_flat_map::arrow_proxy<reference>              pointer;
+    typedef etl::private_dense_flat_map::arrow_proxy<const_reference>        const_pointer;
+
+  protected:
+
+    typedef const key_type& key_parameter_t;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, pointer, reference>
+    {
+    public:
+
+      friend class idense_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      reference operator *() const
+      {
+        return reference(*p_key, *p_mapped);
+      }
+
+      pointer operator ->() const
+      {
+        return pointer(reference(*p_key, *p_mapped));
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return reference(p_key[n], p_mapped[n]);
+      }
+
+      iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend iterator operator +(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(difference_type n, const iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend iterator operator -(const iterator& lhs, difference_type n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      iterator(TKey* p_key_, TMapped* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      TKey*    p_key;
+      TMapped* p_mapped;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class idense_flat_map;
+
+      const_iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename idense_flat_map::iterator& other)
+        : p_key(other.p_key)
+        , p_mapped(other.p_mapped)
+      {
+      }
+
+      const_reference operator *() const
+      {
+        return const_reference(*p_key, *p_mapped);
+      }
+
+      const_pointer operator ->() const
+      {
+        return const_pointer(const_reference(*p_key, *p_mapped));
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return const_reference(p_key[n], p_mapped[n]);
+      }
+
+      const_iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend const_iterator operator +(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend const_iterator operator +(difference_type n, const const_iterator& rhs)
+      {
+        return rhs + n;
+      }
+
+      friend const_iterator operator -(const const_iterator& lhs, difference_type n)
+      {
+        const_iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      const_iterator(const TKey* p_key_, const TMapped* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      const TKey*    p_key;
+      const TMapped* p_mapped;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the dense_flat_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(p_keys, p_values);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the dense_flat_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(p_keys, p_values);
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the dense_flat_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(p_keys + current_size, p_values + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the dense_flat_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(p_keys + current_size, p_values + current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the dense_flat_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the dense_flat_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns an reverse iterator to the reverse beginning of the dense_flat_map.
+    //*********************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the dense_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the dense_flat_map.
+    //*********************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the dense_flat_map.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the dense_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the dense_flat_map.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns the sorted keys.
+    //*********************************************************************
+    etl::span<const key_type> keys() const
+    {
+      return etl::span<const key_type>(p_keys, current_size);
+    }
+
+    //*********************************************************************
+    /// Returns the mapped values, in the same order as the keys.
+    //*********************************************************************
+    etl::span<mapped_type> values()
+    {
+      return etl::span<mapped_type>(p_values, current_size);
+    }
+
+    //*********************************************************************
+    /// Returns the mapped values, in the same order as the keys.
+    //*********************************************************************
+    etl::span<const mapped_type> values() const
+    {
+      return etl::span<const mapped_type>(p_values, current_size);
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If the key does not exist then one is inserted with a default value.
+    ///\param key The key.
+    //*********************************************************************
+    mapped_type& operator [](key_parameter_t key)
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index == current_size) || compare(key, p_keys[index]))
+      {
+        // Not found.
+        if (full())
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_map_full));
+        }
+
+        open_gap(index);
+        ::new (p_keys + index) key_type(key);
+        ::new (p_values + index) mapped_type();
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return p_values[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::dense_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    //*********************************************************************
+    mapped_type& at(key_parameter_t key)
+    {
+      size_type index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_type& at(const K& key)
+    {
+      size_type index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::dense_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    //*********************************************************************
+    const mapped_type& at(key_parameter_t key) const
+    {
+      size_type index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const mapped_type& at(const K& key) const
+    {
+      size_type index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(dense_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      size_type index = lower_bound_index(value.first);
+
+      if ((index != current_size) && !compare(value.first, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) key_type(value.first);
+      ::new (p_values + index) mapped_type(value.second);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      size_type index = lower_bound_index(value.first);
+
+      if ((index != current_size) && !compare(value.first, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) key_type(etl::move(value.first));
+      ::new (p_values + index) mapped_type(etl::move(value.second));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      return insert(value_type(value.first, value.second));
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const value_type& value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, value_type&& value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the dense_flat_map.
+    /// If asserts or exceptions are enabled, emits dense_flat_map_full if the dense_flat_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the arguments.
+    //*************************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(key_parameter_t key, Args && ... args)
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index != current_size) && !compare(key, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) key_type(key);
+      ::new (p_values + index) mapped_type(etl::forward<Args>(args)...);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the map.
+    /// The mapped value is constructed in place from the argument.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(key_parameter_t key, const T1& value1)
+    {
+      size_type index = lower_bound_index(key);
+
+      if ((index != current_size) && !compare(key, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) key_type(key);
+      ::new (p_values + index) mapped_type(value1);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(iterator i_element)
+    {
+      return erase(const_iterator(i_element));
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      size_type index = index_of(i_element);
+
+      erase_range(index, index + 1U);
+
+      return iterator_at(index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_type index = index_of(first);
+
+      erase_range(index, index_of(last));
+
+      return iterator_at(index);
+    }
+
+    //*************************************************************************
+    /// Clears the dense_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_keys, p_keys + current_size);
+      etl::destroy(p_values, p_values + current_size);
+
+      ETL_SUBTRACT_DEBUG_COUNT(current_size);
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return iterator_at(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return iterator_at(find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_iterator_at(find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_iterator_at(find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the map contains the key.
+    //*************************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != current_size;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(key_parameter_t key)
+    {
+      return iterator_at(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator_at(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(key_parameter_t key) const
+    {
+      return const_iterator_at(lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator_at(lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(key_parameter_t key)
+    {
+      return iterator_at(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator_at(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(key_parameter_t key) const
+    {
+      return const_iterator_at(upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator_at(upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<iterator, iterator>(iterator_at(first), iterator_at(last));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      size_type first = lower_bound_index(key);
+      size_type last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(const_iterator_at(first), const_iterator_at(last));
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    idense_flat_map& operator = (const idense_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_container(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    idense_flat_map& operator = (idense_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the dense_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the dense_flat_map.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the dense_flat_map.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the dense_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the dense_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    idense_flat_map(key_type* p_keys_, mapped_type* p_values_, size_type capacity_)
+      : p_keys(p_keys_)
+      , p_values(p_values_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the elements of another dense_flat_map, which are already in order.
+    //*************************************************************************
+    void copy_container(const idense_flat_map& rhs)
+    {
+      clear();
+
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(dense_flat_map_full));
+
+      etl::uninitialized_copy(rhs.p_keys, rhs.p_keys + rhs.current_size, p_keys);
+      etl::uninitialized_copy(rhs.p_values, rhs.p_values + rhs.current_size, p_values);
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another dense_flat_map, which are already in order.
+    //*************************************************************************
+    void move_container(idense_flat_map&& rhs)
+    {
+      clear();
+
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(dense_flat_map_full));
+
+      etl::uninitialized_move(rhs.p_keys, rhs.p_keys + rhs.current_size, p_keys);
+      etl::uninitialized_move(rhs.p_values, rhs.p_values + rhs.current_size, p_values);
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The index of the first key not less than 'key'.
+    //*********************************************************************
+    template <typename K>
+    size_type lower_bound_index(const K& key) const
+    {
+      return static_cast<size_type>(etl::lower_bound(p_keys, p_keys + current_size, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than 'key'.
+    //*********************************************************************
+    template <typename K>
+    size_type upper_bound_index(const K& key) const
+    {
+      return static_cast<size_type>(etl::upper_bound(p_keys, p_keys + current_size, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// The index of the key, or size() if it is not found.
+    //*********************************************************************
+    template <typename K>
+    size_type find_index(const K& key) const
+    {
+      size_type index = lower_bound_index(key);
+
+      return ((index != current_size) && !compare(key, p_keys[index])) ? index : current_size;
+    }
+
+    //*********************************************************************
+    iterator iterator_at(size_type index)
+    {
+      return iterator(p_keys + index, p_values + index);
+    }
+
+    //*********************************************************************
+    const_iterator const_iterator_at(size_type index) const
+    {
+      return const_iterator(p_keys + index, p_values + index);
+    }
+
+    //*********************************************************************
+    size_type index_of(const_iterator itr) const
+    {
+      return static_cast<size_type>(itr.p_key - p_keys);
+    }
+
+    //*********************************************************************
+    /// Moves the elements from 'index' up by one, and leaves no objects at
+    /// 'index', so that a key and value may be constructed there.
+    /// There must be room for one more element.
+    //*********************************************************************
+    void open_gap(size_type index)
+    {
+      if (index != current_size)
+      {
+        ::new (p_keys + current_size) key_type(ETL_MOVE(p_keys[current_size - 1U]));
+        ::new (p_values + current_size) mapped_type(ETL_MOVE(p_values[current_size - 1U]));
+
+        etl::move_backward(p_keys + index, p_keys + current_size - 1U, p_keys + current_size);
+        etl::move_backward(p_values + index, p_values + current_size - 1U, p_values + current_size);
+
+        p_keys[index].~key_type();
+        p_values[index].~mapped_type();
+      }
+    }
+
+    //*********************************************************************
+    /// Erases the elements from 'first' to 'last'.
+    //*********************************************************************
+    void erase_range(size_type first, size_type last)
+    {
+      const size_type n = last - first;
+
+      etl::move(p_keys + last, p_keys + current_size, p_keys + first);
+      etl::move(p_values + last, p_values + current_size, p_values + first);
+
+      etl::destroy(p_keys + current_size - n, p_keys + current_size);
+      etl::destroy(p_values + current_size - n, p_values + current_size);
+
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+    }
+
+    // Disable copy construction.
+    idense_flat_map(const idense_flat_map&);
+
+    key_type* const    p_keys;       ///< The keys, sorted.
+    mapped_type* const p_values;     ///< The mapped values, in the same order as the keys.
+    size_type          current_size;
+    key_compare        compare;
+
+    const size_type CAPACITY;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_DENSE_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~idense_flat_map()
+    {
+    }
+#else
+  protected:
+    ~idense_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first dense_flat_map.
+  ///\param rhs Reference to the second dense_flat_map.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys().begin(), lhs.keys().end(), rhs.keys().begin()) &&
+           etl::equal(lhs.values().begin(), lhs.values().end(), rhs.values().begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first dense_flat_map.
+  ///\param rhs Reference to the second dense_flat_map.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::idense_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A dense_flat_map implementation that uses fixed size buffers.
+  ///\tparam TKey      The key type.
+  ///\tparam TValue    The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup dense_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class dense_flat_map : public etl::idense_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::idense_flat_map<TKey, TValue, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_flat_map()
+      : base(key_buffer, value_buffer, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dense_flat_map(const dense_flat_map& other)
+      : base(key_buffer, value_buffer, MAX_SIZE)
+    {
+      base::copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    dense_flat_map(dense_flat_map&& other)
+      : base(key_buffer, value_buffer, MAX_SIZE)
+    {
+      if (&other != this)
+      {
+        base::move_container(etl::move(other));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_flat_map(TIterator first, TIterator last)
+      : base(key_buffer, value_buffer, MAX_SIZE)
+    {
+      base::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    dense_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(key_buffer, value_buffer, MAX_SIZE)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~dense_flat_map()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dense_flat_map& operator = (const dense_flat_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    dense_flat_map& operator = (dense_flat_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::uninitialized_buffer_of<TKey, MAX_SIZE_> key_buffer;
+
+    /// The mapped values.
+    etl::uninitialized_buffer_of<TValue, MAX_SIZE_> value_buffer;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t dense_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  /// The keys are stored apart from the mapped values, so a const key type
+  /// in the pairs is deduced as a non-const key.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  dense_flat_map(TPairs...) -> dense_flat_map<etl::remove_const_t<typename etl::nth_type_t<0, TPairs...>::first_type>,
+                                              typename etl::nth_type_t<0, TPairs...>::second_type,
+                                              sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename... TPairs>
+  constexpr auto make_dense_flat_map(TPairs&&... pairs) -> etl::dense_flat_map<TKey, TMapped, sizeof...(TPairs), TKeyCompare>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,910 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_FLAT_SET_INCLUDED
+#define ETL_DENSE_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_flat_set dense_flat_set
+/// A flat set with the capacity defined at compile time, that stores the keys
+/// directly in one sorted array, rather than as pointers to a pool.
+/// A search only reads the dense array of keys, and iteration reads memory in
+/// order.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the dense_flat_set.
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  class dense_flat_set_exception : public etl::exception
+  {
+  public:
+
+    dense_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the dense_flat_set.
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  class dense_flat_set_full : public etl::dense_flat_set_exception
+  {
+  public:
+
+    dense_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : dense_flat_set_exception(ETL_ERROR_TEXT("dense_flat_set:full", ETL_DENSE_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized dense_flat_sets.
+  /// Can be used as a reference type for all dense_flat_sets containing a
+  /// specific type.
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare = etl::less<T> >
+  class idense_flat_set
+  {
+  public:
+
+    typedef T                 key_type;
+    typedef T                 value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    /// The keys may not be modified through an iterator, as that could break the order.
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+  protected:
+
+    typedef const value_type& parameter_t;
+
+  public:
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the dense_flat_set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return p_keys;
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the dense_flat_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return p_keys + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the dense_flat_set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return p_keys;
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the dense_flat_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return p_keys + current_size;
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the dense_flat_set.
+    //*********************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a reverse iterator to the end + 1 of the dense_flat_set.
+    //*********************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the dense_flat_set.
+    //*********************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*********************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the dense_flat_set.
+    //*********************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*********************************************************************
+    /// Returns a pointer to the sorted keys.
+    //*********************************************************************
+    const_pointer data() const
+    {
+      return p_keys;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(parameter_t value)
+    {
+      size_type index = lower_bound_index(value);
+
+      if ((index != current_size) && !compare(value, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(p_keys + index, false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_set_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) value_type(value);
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(p_keys + index, true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      size_type index = lower_bound_index(value);
+
+      if ((index != current_size) && !compare(value, p_keys[index]))
+      {
+        // Already there.
+        return ETL_OR_STD::pair<iterator, bool>(p_keys + index, false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_flat_set_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      open_gap(index);
+      ::new (p_keys + index) value_type(etl::move(value));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(p_keys + index, true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, parameter_t value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the dense_flat_set.
+    /// If asserts or exceptions are enabled, emits dense_flat_set_full if the dense_flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    /// The value is constructed first, as it is needed for the search.
+    //*************************************************************************
+    template <typename ... Args>
+    ETL_OR_STD::pair<iterator, bool> emplace(Args && ... args)
+    {
+      return insert(value_type(etl::forward<Args>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1)
+    {
+      return insert(value_type(value1));
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the set.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    ETL_OR_STD::pair<iterator, bool> emplace(const T1& value1, const T2& value2)
+    {
+      return insert(value_type(value1, value2));
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(parameter_t key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t erase(K&& key)
+    {
+      size_type index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      size_type index = static_cast<size_type>(i_element - p_keys);
+
+      erase_range(index, index + 1U);
+
+      return p_keys + index;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      size_type index = static_cast<size_type>(first - p_keys);
+
+      erase_range(index, static_cast<size_type>(last - p_keys));
+
+      return p_keys + index;
+    }
+
+    //*************************************************************************
+    /// Clears the dense_flat_set.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_keys, p_keys + current_size);
+
+      ETL_SUBTRACT_DEBUG_COUNT(current_size);
+      current_size = 0U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(parameter_t key) const
+    {
+      return p_keys + find_index(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return p_keys + find_index(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(parameter_t key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the set contains the key.
+    //*************************************************************************
+    bool contains(parameter_t key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != current_size;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(parameter_t key) const
+    {
+      return p_keys + lower_bound_index(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return p_keys + lower_bound_index(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(parameter_t key) const
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return etl::upper_bound(begin(), end(), key, compare);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(parameter_t key) const
+    {
+      const_iterator first = lower_bound(key);
+      const_iterator last  = ((first != end()) && !compare(key, *first)) ? first + 1 : first;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(first, last);
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two values.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    idense_flat_set& operator = (const idense_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        copy_container(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    idense_flat_set& operator = (idense_flat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        move_container(etl::move(rhs));
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current size of the dense_flat_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the dense_flat_set.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the dense_flat_set.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the dense_flat_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the dense_flat_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    idense_flat_set(value_type* p_keys_, size_type capacity_)
+      : p_keys(p_keys_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the elements of another dense_flat_set, which are already in order.
+    //*************************************************************************
+    void copy_container(const idense_flat_set& rhs)
+    {
+      clear();
+
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(dense_flat_set_full));
+
+      etl::uninitialized_copy(rhs.p_keys, rhs.p_keys + rhs.current_size, p_keys);
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another dense_flat_set, which are already in order.
+    //*************************************************************************
+    void move_container(idense_flat_set&& rhs)
+    {
+      clear();
+
+      ETL_ASSERT(rhs.size() <= CAPACITY, ETL_ERROR(dense_flat_set_full));
+
+      etl::uninitialized_move(rhs.p_keys, rhs.p_keys + rhs.current_size, p_keys);
+      current_size = rhs.current_size;
+      ETL_ADD_DEBUG_COUNT(current_size);
+
+      rhs.clear();
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The index of the first key not less than 'key'.
+    //*********************************************************************
+    template <typename K>
+    size_type lower_bound_index(const K& key) const
+    {
+      return static_cast<size_type>(etl::lower_bound(p_keys, p_keys + current_size, key, compare) - p_keys);
+    }
+
+    //*********************************************************************
+    /// The index of the key, or size() if it is not found.
+    //*********************************************************************
+    template <typename K>
+    size_type find_index(const K& key) const
+    {
+      size_type index = lower_bound_index(key);
+
+      return ((index != current_size) && !compare(key, p_keys[index])) ? index : current_size;
+    }
+
+    //*********************************************************************
+    /// Moves the elements from 'index' up by one, and leaves no object at
+    /// 'index', so that a key may be constructed there.
+    /// There must be room for one more element.
+    //*********************************************************************
+    void open_gap(size_type index)
+    {
+      if (index != current_size)
+      {
+        ::new (p_keys + current_size) value_type(ETL_MOVE(p_keys[current_size - 1U]));
+
+        etl::move_backward(p_keys + index, p_keys + current_size - 1U, p_keys + current_size);
+
+        p_keys[index].~value_type();
+      }
+    }
+
+    //*********************************************************************
+    /// Erases the elements from 'first' to 'last'.
+    //*********************************************************************
+    void erase_range(size_type first, size_type last)
+    {
+      const size_type n = last - first;
+
+      etl::move(p_keys + last, p_keys + current_size, p_keys + first);
+      etl::destroy(p_keys + current_size - n, p_keys + current_size);
+
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n);
+    }
+
+    // Disable copy construction.
+    idense_flat_set(const idense_flat_set&);
+
+    value_type* const p_keys;  ///< The keys, sorted.
+    size_type         current_size;
+    key_compare       compare;
+
+    const size_type CAPACITY;
+
+    /// Internal debugging.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_DENSE_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~idense_flat_set()
+    {
+    }
+#else
+  protected:
+    ~idense_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first dense_flat_set.
+  ///\param rhs Reference to the second dense_flat_set.
+  ///\return <b>true</b> if the arrays are equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator ==(const etl::idense_flat_set<T, TKeyCompare>& lhs, const etl::idense_flat_set<T, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first dense_flat_set.
+  ///\param rhs Reference to the second dense_flat_set.
+  ///\return <b>true</b> if the arrays are not equal, otherwise <b>false</b>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, typename TKeyCompare>
+  bool operator !=(const etl::idense_flat_set<T, TKeyCompare>& lhs, const etl::idense_flat_set<T, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A dense_flat_set implementation that uses a fixed size buffer.
+  ///\tparam T         The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<T>
+  ///\ingroup dense_flat_set
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T> >
+  class dense_flat_set : public etl::idense_flat_set<T, TCompare>
+  {
+  private:
+
+    typedef etl::idense_flat_set<T, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_flat_set()
+      : base(buffer, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dense_flat_set(const dense_flat_set& other)
+      : base(buffer, MAX_SIZE)
+    {
+      base::copy_container(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    dense_flat_set(dense_flat_set&& other)
+      : base(buffer, MAX_SIZE)
+    {
+      if (&other != this)
+      {
+        base::move_container(etl::move(other));
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_flat_set(TIterator first, TIterator last)
+      : base(buffer, MAX_SIZE)
+    {
+      base::assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    dense_flat_set(std::initializer_list<T> init)
+      : base(buffer, MAX_SIZE)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~dense_flat_set()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dense_flat_set& operator = (const dense_flat_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    dense_flat_set& operator = (dense_flat_set&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::uninitialized_buffer_of<T, MAX_SIZE_> buffer;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t dense_flat_set<T, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  dense_flat_set(T...) -> dense_flat_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename... T>
+  constexpr auto make_dense_flat_set(T&&... keys) -> etl::dense_flat_set<TKey, sizeof...(T), TKeyCompare>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+#endif
+}
+
+#endif
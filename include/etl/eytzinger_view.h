@@ -0,0 +1,586 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_VIEW_INCLUDED
+#define ETL_EYTZINGER_VIEW_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "functional.h"
+#include "memory.h"
+#include "log.h"
+#include "binary.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "placement_new.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup eytzinger_view eytzinger_view
+/// A frozen, read-only search index over a sorted range of keys, such as the
+/// keys of a flat_map or reference_flat_set that is built once and then only
+/// searched.
+/// The keys are copied in Eytzinger (breadth first) order, so that the first
+/// levels of every search share the same few cache lines, and the children of
+/// a key are next to each other. The search is branchless, and fetches the
+/// keys that it will compare four levels further down ahead of time.
+/// Searches return the index of the key in the original sorted range.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the eytzinger_view.
+  ///\ingroup eytzinger_view
+  //***************************************************************************
+  class eytzinger_view_exception : public etl::exception
+  {
+  public:
+
+    eytzinger_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the eytzinger_view.
+  ///\ingroup eytzinger_view
+  //***************************************************************************
+  class eytzinger_view_full : public etl::eytzinger_view_exception
+  {
+  public:
+
+    eytzinger_view_full(string_type file_name_, numeric_type line_number_)
+      : eytzinger_view_exception(ETL_ERROR_TEXT("eytzinger_view:full", ETL_EYTZINGER_VIEW_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Unsorted exception for the eytzinger_view.
+  ///\ingroup eytzinger_view
+  //***************************************************************************
+  class eytzinger_view_unsorted : public etl::eytzinger_view_exception
+  {
+  public:
+
+    eytzinger_view_unsorted(string_type file_name_, numeric_type line_number_)
+      : eytzinger_view_exception(ETL_ERROR_TEXT("eytzinger_view:unsorted", ETL_EYTZINGER_VIEW_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_eytzinger_view
+  {
+    //*************************************************************************
+    /// Gets the key from a range of keys.
+    //*************************************************************************
+    struct key_identity
+    {
+      template <typename T>
+      const T& operator ()(const T& key) const
+      {
+        return key;
+      }
+    };
+
+    //*************************************************************************
+    /// Hints that the memory will be read soon.
+    //*************************************************************************
+    inline void prefetch(const void* p)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      __builtin_prefetch(p);
+#else
+      (void)p;
+#endif
+    }
+
+    //*************************************************************************
+    /// Recovers the last position at which a search went left, from the
+    /// position that it ended at, by removing the trailing right turns and
+    /// the final left turn.
+    //*************************************************************************
+    inline size_t last_left_turn(size_t position)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return position >> (static_cast<size_t>(__builtin_ctzll(~static_cast<unsigned long long>(position))) + 1U);
+#else
+      return position >> (static_cast<size_t>(etl::count_trailing_ones(position)) + 1U);
+#endif
+    }
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized eytzinger_views.
+  /// Can be used as a reference type for all eytzinger_views containing a
+  /// specific type.
+  ///\ingroup eytzinger_view
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class ieytzinger_view
+  {
+  public:
+
+    typedef TKey        key_type;
+    typedef TKeyCompare key_compare;
+    typedef size_t      size_type;
+
+  protected:
+
+    typedef const key_type& key_parameter_t;
+
+  public:
+
+    //*********************************************************************
+    /// Copies the keys from a sorted range.
+    /// If asserts or exceptions are enabled, emits eytzinger_view_full if the
+    /// range is too large, or eytzinger_view_unsorted if it is not sorted.
+    ///\param first The iterator to the first key.
+    ///\param last  The iterator to the last key + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      assign(first, last, private_eytzinger_view::key_identity());
+    }
+
+    //*********************************************************************
+    /// Copies the keys from a sorted range of elements, such as the key/value
+    /// pairs of a map.
+    /// If asserts or exceptions are enabled, emits eytzinger_view_full if the
+    /// range is too large, or eytzinger_view_unsorted if it is not sorted.
+    ///\param first   The iterator to the first element.
+    ///\param last    The iterator to the last element + 1.
+    ///\param get_key Returns the key of an element.
+    //*********************************************************************
+    template <typename TIterator, typename TGetKey>
+    void assign(TIterator first, TIterator last, TGetKey get_key)
+    {
+      clear();
+
+      const size_type n = static_cast<size_type>(etl::distance(first, last));
+
+      if (n > CAPACITY)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(eytzinger_view_full));
+        return;
+      }
+
+#if !defined(ETL_NO_CHECKS)
+      if (first != last)
+      {
+        TIterator previous = first;
+        TIterator itr      = first;
+
+        while (++itr != last)
+        {
+          if (compare(get_key(*itr), get_key(*previous)))
+          {
+            ETL_ASSERT_FAIL(ETL_ERROR(eytzinger_view_unsorted));
+            return;
+          }
+
+          previous = itr;
+        }
+      }
+#endif
+
+      current_size = n;
+
+      size_type index = 0U;
+      build(1U, first, get_key, index);
+
+      p_indexes[0] = current_size;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key.
+    ///\param key The key to search for.
+    ///\return The index in the sorted range of the first key that is not
+    /// less than 'key', or size() if there is none.
+    //*********************************************************************
+    size_type lower_bound(key_parameter_t key) const
+    {
+      return p_indexes[lower_bound_position(key)];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type lower_bound(const K& key) const
+    {
+      return p_indexes[lower_bound_position(key)];
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key.
+    ///\param key The key to search for.
+    ///\return The index in the sorted range of the first key that is
+    /// greater than 'key', or size() if there is none.
+    //*********************************************************************
+    size_type upper_bound(key_parameter_t key) const
+    {
+      return p_indexes[upper_bound_position(key)];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type upper_bound(const K& key) const
+    {
+      return p_indexes[upper_bound_position(key)];
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds a key.
+    ///\param key The key to search for.
+    ///\return The index of the key in the sorted range, or size() if it is
+    /// not found.
+    //*********************************************************************
+    size_type find(key_parameter_t key) const
+    {
+      return p_indexes[find_position(key)];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type find(const K& key) const
+    {
+      return p_indexes[find_position(key)];
+    }
+#endif
+
+    //*********************************************************************
+    /// Check if the view contains the key.
+    //*********************************************************************
+    bool contains(key_parameter_t key) const
+    {
+      return find_position(key) != 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_position(key) != 0U;
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts a key.
+    /// There may be more than one if the sorted range had duplicates.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return upper_bound(key) - lower_bound(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return upper_bound(key) - lower_bound(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Clears the eytzinger_view.
+    //*************************************************************************
+    void clear()
+    {
+      etl::destroy(p_keys + 1U, p_keys + current_size + 1U);
+
+      current_size = 0U;
+      p_indexes[0] = 0U;
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Gets the number of keys.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the eytzinger_view.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the eytzinger_view.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the eytzinger_view.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the eytzinger_view.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    /// The keys and indexes are stored from position 1. Position 0 is the
+    /// result of a search that finds nothing.
+    //*********************************************************************
+    ieytzinger_view(key_type* p_keys_, size_type* p_indexes_, size_type capacity_)
+      : p_keys(p_keys_)
+      , p_indexes(p_indexes_)
+      , current_size(0U)
+      , CAPACITY(capacity_)
+    {
+      p_indexes[0] = 0U;
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Copies the sorted keys to the tree at 'position' with an in-order walk.
+    //*********************************************************************
+    template <typename TIterator, typename TGetKey>
+    void build(size_type position, TIterator& itr, TGetKey get_key, size_type& index)
+    {
+      if (position <= current_size)
+      {
+        build(2U * position, itr, get_key, index);
+
+        ::new (p_keys + position) key_type(get_key(*itr));
+        p_indexes[position] = index;
+        ++itr;
+        ++index;
+
+        build((2U * position) + 1U, itr, get_key, index);
+      }
+    }
+
+    //*********************************************************************
+    /// Fetches the keys of the search four levels down from 'position'.
+    /// They are together in one cache line, if the keys are a power of two
+    /// in size.
+    //*********************************************************************
+    void prefetch_descendants(size_type position) const
+    {
+      static const size_type Stride = size_type(1U) << etl::log2<ETL_CACHE_LINE_SIZE / sizeof(key_type)>::value;
+
+      const size_type descendant = position * Stride;
+
+      private_eytzinger_view::prefetch(p_keys + ((descendant <= current_size) ? descendant : 0U));
+    }
+
+    //*********************************************************************
+    /// The position of the first key not less than 'key', or 0.
+    //*********************************************************************
+    template <typename K>
+    size_type lower_bound_position(const K& key) const
+    {
+      size_type position = 1U;
+
+      while (position <= current_size)
+      {
+        prefetch_descendants(position);
+        position = (2U * position) + static_cast<size_type>(compare(p_keys[position], key));
+      }
+
+      return private_eytzinger_view::last_left_turn(position);
+    }
+
+    //*********************************************************************
+    /// The position of the first key greater than 'key', or 0.
+    //*********************************************************************
+    template <typename K>
+    size_type upper_bound_position(const K& key) const
+    {
+      size_type position = 1U;
+
+      while (position <= current_size)
+      {
+        prefetch_descendants(position);
+        position = (2U * position) + static_cast<size_type>(!compare(key, p_keys[position]));
+      }
+
+      return private_eytzinger_view::last_left_turn(position);
+    }
+
+    //*********************************************************************
+    /// The position of the key, or 0.
+    //*********************************************************************
+    template <typename K>
+    size_type find_position(const K& key) const
+    {
+      const size_type position = lower_bound_position(key);
+
+      return ((position != 0U) && !compare(key, p_keys[position])) ? position : 0U;
+    }
+
+    // Disable copy construction.
+    ieytzinger_view(const ieytzinger_view&);
+    ieytzinger_view& operator =(const ieytzinger_view&);
+
+    key_type* const  p_keys;     ///< The keys in Eytzinger order.
+    size_type* const p_indexes;  ///< The index in the sorted range of each key.
+    size_type        current_size;
+    key_compare      compare;
+
+    const size_type CAPACITY;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_EYTZINGER_VIEW) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ieytzinger_view()
+    {
+    }
+#else
+  protected:
+    ~ieytzinger_view()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// An eytzinger_view with a fixed capacity.
+  ///\tparam TKey      The key type.
+  ///\tparam MAX_SIZE_ The maximum number of keys.
+  ///\tparam TCompare  The type to compare keys. Default = etl::less<TKey>
+  ///\ingroup eytzinger_view
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class eytzinger_view : public etl::ieytzinger_view<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::ieytzinger_view<TKey, TCompare> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    eytzinger_view()
+      : base(key_buffer, indexes, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a sorted range of keys.
+    ///\param first The iterator to the first key.
+    ///\param last  The iterator to the last key + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    eytzinger_view(TIterator first, TIterator last)
+      : base(key_buffer, indexes, MAX_SIZE)
+    {
+      base::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a sorted range of elements.
+    ///\param first   The iterator to the first element.
+    ///\param last    The iterator to the last element + 1.
+    ///\param get_key Returns the key of an element.
+    //*************************************************************************
+    template <typename TIterator, typename TGetKey>
+    eytzinger_view(TIterator first, TIterator last, TGetKey get_key)
+      : base(key_buffer, indexes, MAX_SIZE)
+    {
+      base::assign(first, last, get_key);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~eytzinger_view()
+    {
+      base::clear();
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Alignment = (ETL_CACHE_LINE_SIZE > etl::alignment_of<TKey>::value) ? ETL_CACHE_LINE_SIZE : etl::alignment_of<TKey>::value;
+
+    /// The keys, from position 1. Aligned to a cache line so that the
+    /// descendants fetched by a search are in one line.
+    etl::uninitialized_buffer<sizeof(TKey), MAX_SIZE_ + 1U, Alignment> key_buffer;
+
+    /// The index in the sorted range of each key, and size() at position 0.
+    size_t indexes[MAX_SIZE_ + 1U];
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t eytzinger_view<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t eytzinger_view<TKey, MAX_SIZE_, TCompare>::Alignment;
+}
+
+#endif
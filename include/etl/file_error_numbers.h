@@ -102,5 +102,15 @@ SOFTWARE.
 #define ETL_TO_ARITHMETIC_FILE_ID "69"
 #define ETL_EXPECTED_FILE_ID "70"
 #define ETL_ALIGNMENT_FILE_ID "71"
+#define ETL_CRC_COMBINE_FILE_ID "72"
+#define ETL_RADIX_FILE_ID "73"
+#define ETL_UNORDERED_FLAT_MAP_FILE_ID "74"
+#define ETL_UNORDERED_FLAT_SET_FILE_ID "75"
+#define ETL_MESSAGE_ROUTER_INBOX_FILE_ID "76"
+#define ETL_DENSE_FLAT_MAP_FILE_ID "77"
+#define ETL_DENSE_FLAT_SET_FILE_ID "78"
+#define ETL_EYTZINGER_VIEW_FILE_ID "79"
+#define ETL_BTREE_MAP_FILE_ID "80"
+#define ETL_QUEUE_MPMC_ATOMIC_FILE_ID "81"
 
 #endif
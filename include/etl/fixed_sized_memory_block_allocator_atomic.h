@@ -0,0 +1,183 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_SIZED_MEMORY_BLOCK_ALLOCATOR_ATOMIC_INCLUDED
+#define ETL_FIXED_SIZED_MEMORY_BLOCK_ALLOCATOR_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "log.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //*************************************************************************
+  /// The lock free fixed sized memory block pool.
+  /// The allocated memory blocks are all the same size.
+  /// Blocks may be allocated and released concurrently from any number of
+  /// threads, so a reference_counted_message_pool that uses it needs no lock.
+  /// The free blocks are kept in a stack of block indexes. The head index is
+  /// stored with a count of changes, in a size_t, so that a compare-exchange
+  /// of the head fails if the stack has changed in the meantime (the ABA
+  /// problem), even if the head index is the same.
+  /// The index takes the fewest bits that can hold Size, and the count has
+  /// the rest. The count wraps, so a thread that is held between reading the
+  /// head and its compare-exchange while exactly a multiple of
+  /// 2^(bits - index bits) other changes are made will still succeed wrongly.
+  /// With a 32 bit size_t and 64 blocks that is 2^25 changes.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  class fixed_sized_memory_block_allocator_atomic : public imemory_block_allocator
+  {
+  private:
+
+    // The low bits of the head are the index, the rest are the change count.
+    static ETL_CONSTANT size_t Index_Bits = etl::log2<VSize>::value + 1U;
+    static ETL_CONSTANT size_t Index_Mask = (size_t(1U) << Index_Bits) - 1U;
+    static ETL_CONSTANT size_t Count_Unit = size_t(1U) << Index_Bits;
+    static ETL_CONSTANT size_t No_Index   = Index_Mask;
+
+  public:
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment  = VAlignment;
+    static ETL_CONSTANT size_t Size       = VSize;
+
+    ETL_STATIC_ASSERT(Size > 0U, "Zero sized allocator");
+    ETL_STATIC_ASSERT(Index_Bits < etl::integral_limits<size_t>::bits, "Too many blocks for the index");
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    fixed_sized_memory_block_allocator_atomic()
+      : head(0U)
+    {
+      for (size_t i = 0U; i < (Size - 1U); ++i)
+      {
+        next[i].store(i + 1U, etl::memory_order_relaxed);
+      }
+
+      next[Size - 1U].store(No_Index, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    /// A structure that has at least the size Block_Size and alignment Alignment.
+    typedef typename etl::aligned_storage<Block_Size, Alignment>::type block;
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment <= Alignment) && (required_size <= Block_Size))
+      {
+        size_t old_head = head.load(etl::memory_order_acquire);
+
+        while ((old_head & Index_Mask) != No_Index)
+        {
+          const size_t index    = old_head & Index_Mask;
+          const size_t new_head = ((old_head & ~Index_Mask) + Count_Unit) | next[index].load(etl::memory_order_relaxed);
+
+          // 'next[index]' may be stale if another thread has taken the block,
+          // but then the change count will have changed and this will fail.
+          if (head.compare_exchange_weak(old_head, new_head, etl::memory_order_acquire, etl::memory_order_acquire))
+          {
+            return &blocks[index];
+          }
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (is_owner_of_block(pblock))
+      {
+        const size_t index = static_cast<size_t>(static_cast<const block*>(pblock) - blocks);
+
+        size_t old_head = head.load(etl::memory_order_relaxed);
+        size_t new_head;
+
+        do
+        {
+          next[index].store(old_head & Index_Mask, etl::memory_order_relaxed);
+          new_head = ((old_head & ~Index_Mask) + Count_Unit) | index;
+        } while (!head.compare_exchange_weak(old_head, new_head, etl::memory_order_release, etl::memory_order_relaxed));
+
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p     = static_cast<const char*>(pblock);
+      const char* first = reinterpret_cast<const char*>(blocks);
+      const char* last  = reinterpret_cast<const char*>(blocks + Size);
+
+      return (p >= first) && (p < last) && (((p - first) % sizeof(block)) == 0);
+    }
+
+    etl::atomic<size_t> head;        ///< The change count and the index of the first free block.
+    etl::atomic<size_t> next[Size];  ///< The index of the free block after each free block.
+    block               blocks[Size];
+  };
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Alignment;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator_atomic<VBlock_Size, VAlignment, VSize>::Size;
+}
+
+#endif
+#endif
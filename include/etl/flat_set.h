@@ -222,6 +222,19 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Assigns values, sorted, to the flat_set.
+    /// See insert_sorted.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      clear();
+      insert_sorted(first, last);
+    }
+
     //*********************************************************************
     /// Inserts a value to the flat_set.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set is already full.
@@ -315,6 +328,63 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted, to the flat_set.
+    /// The new values are merged with the existing ones in O(N + M), rather
+    /// than by M separate inserts that each shift the elements after them.
+    /// Values that are already in the flat_set, or repeated in the range,
+    /// are not inserted. A range that is not sorted, or that may not fit, is
+    /// inserted one value at a time.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      const size_t count = size_t(etl::distance(first, last));
+
+      if ((count > available()) || !is_sorted_range(first, last))
+      {
+        insert(first, last);
+        return;
+      }
+
+      lookup_t& lookup = refset_t::get_lookup();
+
+      // Move the existing elements to the back and merge forwards from the front.
+      const size_t existing_size = lookup.size();
+      lookup.resize(existing_size + count);
+      etl::copy_backward(lookup.begin(), lookup.begin() + existing_size, lookup.end());
+
+      typename lookup_t::iterator i_write = lookup.begin();
+      typename lookup_t::iterator i_read  = lookup.begin() + count;
+
+      while (first != last)
+      {
+        // Take the existing elements that go before the new one.
+        while ((i_read != lookup.end()) && compare(**i_read, *first))
+        {
+          *i_write++ = *i_read++;
+        }
+
+        // Not already in the flat_set or repeated in the range?
+        if (((i_read == lookup.end()) || compare(*first, **i_read)) &&
+            ((i_write == lookup.begin()) || compare(**(i_write - 1), *first)))
+        {
+          value_type* pvalue = storage.allocate<value_type>();
+          ::new (pvalue) value_type(*first);
+          ETL_INCREMENT_DEBUG_COUNT
+          *i_write++ = pvalue;
+        }
+
+        ++first;
+      }
+
+      i_write = etl::copy(i_read, lookup.end(), i_write);
+      lookup.erase(i_write, lookup.end());
+    }
+
     //*************************************************************************
     /// Emplaces a value to the set.
     //*************************************************************************
@@ -924,6 +994,30 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT
 
+    //*********************************************************************
+    /// Checks that the values of a range are in order.
+    //*********************************************************************
+    template <typename TIterator>
+    bool is_sorted_range(TIterator first, TIterator last) const
+    {
+      if (first != last)
+      {
+        TIterator next = first;
+
+        while (++next != last)
+        {
+          if (compare(*next, *first))
+          {
+            return false;
+          }
+
+          first = next;
+        }
+      }
+
+      return true;
+    }
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
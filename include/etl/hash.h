@@ -37,6 +37,10 @@ SOFTWARE.
 
 // The default hash calculation.
 #include "fnv_1.h"
+
+#if ETL_HAS_HASH_WYHASH
+  #include "wyhash.h"
+#endif
 #include "type_traits.h"
 #include "static_assert.h"
 
@@ -58,7 +62,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_HAS_HASH_WYHASH
+      uint32_t h = wyhash_32(begin, static_cast<size_t>(end - begin));
+#else
       uint32_t h = fnv_1a_32(begin, end);
+#endif
 
       return static_cast<size_t>(h ^ (h >> 16U));
     }
@@ -71,7 +79,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_HAS_HASH_WYHASH
+      return wyhash_32(begin, static_cast<size_t>(end - begin));
+#else
       return fnv_1a_32(begin, end);
+#endif
     }
 
 #if ETL_USING_64BIT_TYPES
@@ -83,7 +95,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_HAS_HASH_WYHASH
+      return static_cast<size_t>(wyhash_64(begin, static_cast<size_t>(end - begin)));
+#else
       return fnv_1a_64(begin, end);
+#endif
     }
 #endif
 
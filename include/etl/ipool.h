@@ -38,6 +38,7 @@ SOFTWARE.
 #include "utility.h"
 #include "memory.h"
 #include "placement_new.h"
+#include "span.h"
 
 #define ETL_POOL_CPP03_CODE 0
 
@@ -230,6 +231,257 @@ namespace etl
       release(p_object);
     }
 
+    //*************************************************************************
+    /// Allocate storage for items.size() objects from the pool.
+    /// The items are taken from the free list in one operation. If the free
+    /// items are the untouched end of the buffer then the items are contiguous,
+    /// and the free list is not read.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown, otherwise false is returned and no
+    /// items are allocated.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    bool allocate_n(etl::span<T*, Extent> items)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      const size_t n = items.size();
+
+      if (n > available())
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        return false;
+      }
+
+      if (is_untouched_tail_free())
+      {
+        char* p = allocate_tail(n);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          items[i] = reinterpret_cast<T*>(p);
+          p += Item_Size;
+        }
+      }
+      else
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          items[i] = reinterpret_cast<T*>(pop_item());
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for items.size() objects from the untouched end of
+    /// the pool's buffer, so that they are adjacent and in address order,
+    /// Item_Size bytes apart.
+    /// Returns false, and allocates nothing, if the untouched end of the buffer
+    /// is not free or is too small.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    bool allocate_n_contiguous(etl::span<T*, Extent> items)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      const size_t n = items.size();
+
+      if ((n > available()) || !is_untouched_tail_free())
+      {
+        return false;
+      }
+
+      char* p = allocate_tail(n);
+
+      for (size_t i = 0; i < n; ++i)
+      {
+        items[i] = reinterpret_cast<T*>(p);
+        p += Item_Size;
+      }
+
+      return true;
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for items.size() objects from the pool and create default.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown, otherwise false is returned.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    bool create_n(etl::span<T*, Extent> items)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T();
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for items.size() objects from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown, otherwise false is returned.
+    //*************************************************************************
+    template <typename T, size_t Extent, typename T1>
+    bool create_n(etl::span<T*, Extent> items, const T1& value1)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T(value1);
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    template <typename T, size_t Extent, typename T1, typename T2>
+    bool create_n(etl::span<T*, Extent> items, const T1& value1, const T2& value2)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T(value1, value2);
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    template <typename T, size_t Extent, typename T1, typename T2, typename T3>
+    bool create_n(etl::span<T*, Extent> items, const T1& value1, const T2& value2, const T3& value3)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T(value1, value2, value3);
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+
+    template <typename T, size_t Extent, typename T1, typename T2, typename T3, typename T4>
+    bool create_n(etl::span<T*, Extent> items, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T(value1, value2, value3, value4);
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for items.size() objects from the pool and create each
+    /// with the same constructor parameters.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown, otherwise false is returned.
+    //*************************************************************************
+    template <typename T, size_t Extent, typename... Args>
+    bool create_n(etl::span<T*, Extent> items, const Args&... args)
+    {
+      if (allocate_n(items))
+      {
+        for (size_t i = 0; i < items.size(); ++i)
+        {
+          ::new (items[i]) T(args...);
+        }
+
+        return true;
+      }
+
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the objects.
+    /// Undefined behaviour if the pool does not contain 'T's.
+    /// \param items The objects to be destroyed.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    void destroy_n(etl::span<T*, Extent> items)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      for (size_t i = 0; i < items.size(); ++i)
+      {
+        items[i]->~T();
+      }
+
+      release_n(items);
+    }
+
+    //*************************************************************************
+    /// Release objects in the pool.
+    /// The items are added to the free list in one operation, in the same
+    /// order, so that allocate_n will return them in that order.
+    /// If asserts or exceptions are enabled and an object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown, and none are released.
+    /// \param items The objects to be released.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    void release_n(etl::span<T*, Extent> items)
+    {
+      const size_t n = items.size();
+
+      if (n == 0)
+      {
+        return;
+      }
+
+      // Do they belong to us?
+      for (size_t i = 0; i < n; ++i)
+      {
+        ETL_ASSERT(is_in_pool(items[i]), ETL_ERROR(pool_object_not_in_pool));
+      }
+
+      // Link them together, and then to the current free items.
+      for (size_t i = 0; i < (n - 1); ++i)
+      {
+        *(uintptr_t*)uintptr_t(items[i]) = uintptr_t(items[i + 1]);
+      }
+
+      *(uintptr_t*)uintptr_t(items[n - 1]) = reinterpret_cast<uintptr_t>(p_next);
+
+      p_next = (char*)uintptr_t(items[0]);
+
+      items_allocated -= uint32_t(n);
+    }
+
     //*************************************************************************
     /// Release an object in the pool.
     /// If asserts or exceptions are enabled and the object does not belong to this
@@ -340,38 +592,78 @@ namespace etl
       // Any free space left?
       if (items_allocated < Max_Size)
       {
-        // Initialise another one if necessary.
-        if (items_initialised < Max_Size)
-        {
-          char* p = p_buffer + (items_initialised * Item_Size);
-          char* np = p + Item_Size;
-          *reinterpret_cast<char**>(p) = np;
-          ++items_initialised;
-        }
+        p_value = pop_item();
+      }
+      else
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+      }
 
-        // Get the address of new allocated item.
-        p_value = p_next;
+      return p_value;
+    }
 
-        ++items_allocated;
-        if (items_allocated < Max_Size)
-        {
-          // Set up the pointer to the next free item
-          p_next = *reinterpret_cast<char**>(p_next);
-        }
-        else
-        {
-          // No more left!
-          p_next = ETL_NULLPTR;
-        }
+    //*************************************************************************
+    /// Take the first item from the free list.
+    /// There must be a free item.
+    //*************************************************************************
+    char* pop_item()
+    {
+      // Initialise the next one if it has never been used.
+      if (is_untouched_tail_free())
+      {
+        char* np = p_next + Item_Size;
+        *reinterpret_cast<char**>(p_next) = np;
+        ++items_initialised;
+      }
+
+      // Get the address of new allocated item.
+      char* p_value = p_next;
+
+      ++items_allocated;
+      if (items_allocated < Max_Size)
+      {
+        // Set up the pointer to the next free item
+        p_next = *reinterpret_cast<char**>(p_next);
       }
       else
       {
-        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        // No more left!
+        p_next = ETL_NULLPTR;
       }
 
       return p_value;
     }
 
+    //*************************************************************************
+    /// Are the free items the part of the buffer that has never been used?
+    /// If so, they are contiguous.
+    /// Items are only initialised when they are first allocated, so the
+    /// untouched part of the buffer starts at items_initialised, and is only
+    /// reached once all released items have been allocated again.
+    //*************************************************************************
+    bool is_untouched_tail_free() const
+    {
+      return p_next == (p_buffer + (items_initialised * Item_Size));
+    }
+
+    //*************************************************************************
+    /// Take 'n' items from the untouched end of the buffer.
+    /// Returns the first of them.
+    //*************************************************************************
+    char* allocate_tail(size_t n)
+    {
+      char* p_value = p_next;
+
+      // The items are never linked, and the next free item is initialised
+      // when it is allocated.
+      items_initialised += uint32_t(n);
+      items_allocated   += uint32_t(n);
+
+      p_next = (items_allocated < Max_Size) ? p_value + (n * Item_Size) : ETL_NULLPTR;
+
+      return p_value;
+    }
+
     //*************************************************************************
     /// Release an item back to the pool.
     //*************************************************************************
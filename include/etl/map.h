@@ -47,6 +47,7 @@ SOFTWARE.
 #include "utility.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "bit.h"
 
 #include <stddef.h>
 
@@ -447,6 +448,55 @@ namespace etl
       swap->weight = detached->weight;
     }
 
+    //*************************************************************************
+    /// Unlinks the nodes of the tree at position into a list, in key order,
+    /// chained through children[kRight], in front of the list provided.
+    //*************************************************************************
+    static void flatten_tree(Node* position, Node*& list)
+    {
+      while (position)
+      {
+        flatten_tree(position->children[kRight], list);
+
+        Node* left = position->children[kLeft];
+        position->children[kRight] = list;
+        list = position;
+        position = left;
+      }
+    }
+
+    //*************************************************************************
+    /// Builds a balanced tree from the first count nodes of a list made by
+    /// flatten_tree, advancing the list past them.
+    /// The left subtree of each node is never smaller than the right.
+    //*************************************************************************
+    static Node* build_tree(Node*& list, size_type count)
+    {
+      if (count == 0)
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_type left_count  = count / 2;
+      const size_type right_count = count - left_count - 1;
+
+      Node* left = build_tree(list, left_count);
+      Node* node = list;
+      list = list->children[kRight];
+
+      node->mark_as_leaf();
+      node->children[kLeft]  = left;
+      node->children[kRight] = build_tree(list, right_count);
+
+      // A subtree of n nodes built this way is bit_width(n) high.
+      if (etl::bit_width(left_count) != etl::bit_width(right_count))
+      {
+        node->weight = uint_least8_t(kLeft);
+      }
+
+      return node;
+    }
+
     size_type current_size;   ///< The number of the used nodes.
     const size_type CAPACITY; ///< The maximum size of the map.
     Node* root_node;          ///< The node that acts as the map root.
@@ -1000,6 +1050,19 @@ namespace etl
       insert(first, last);
     }
 
+    //*********************************************************************
+    /// Assigns values, sorted by key, to the map.
+    /// See insert_sorted.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign_sorted(TIterator first, TIterator last)
+    {
+      initialise();
+      insert_sorted(first, last);
+    }
+
     //*************************************************************************
     /// Clears the map.
     //*************************************************************************
@@ -1267,6 +1330,89 @@ namespace etl
       }
     }
 
+    //*********************************************************************
+    /// Inserts a range of values, sorted by key, to the map.
+    /// The new values are merged with the existing ones and the tree is
+    /// rebuilt, balanced, in O(N + M), rather than by M separate inserts.
+    /// Keys that are already in the map, or repeated in the range, are not
+    /// inserted. If the range turns out not to be sorted then the rest of
+    /// it is inserted one value at a time.
+    /// If asserts or exceptions are enabled, emits map_full if the map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_sorted(TIterator first, TIterator last)
+    {
+      // The existing nodes, in key order.
+      Node* existing = ETL_NULLPTR;
+      flatten_tree(root_node, existing);
+      root_node = ETL_NULLPTR;
+
+      // The merged nodes.
+      Node*  merged    = ETL_NULLPTR;
+      Node** p_next    = &merged;
+      Node*  last_node = ETL_NULLPTR;
+
+      while (first != last)
+      {
+        if (full())
+        {
+          *p_next   = existing;
+          root_node = build_tree(merged, current_size);
+
+          ETL_ASSERT_FAIL(ETL_ERROR(map_full));
+          return;
+        }
+
+        Data_Node& node = allocate_data_node(*first);
+        ++first;
+
+        // Take the existing nodes that go before the new one.
+        while (existing && node_comp(imap::data_cast(*existing), node))
+        {
+          last_node = existing;
+          *p_next   = existing;
+          p_next    = &existing->children[kRight];
+          existing  = existing->children[kRight];
+        }
+
+        if ((last_node == ETL_NULLPTR) || node_comp(imap::data_cast(*last_node), node))
+        {
+          if (existing && !node_comp(node, imap::data_cast(*existing)))
+          {
+            // Already in the map.
+            destroy_data_node(node);
+          }
+          else
+          {
+            last_node = &node;
+            *p_next   = &node;
+            p_next    = &node.children[kRight];
+            ++current_size;
+          }
+        }
+        else if (!node_comp(node, imap::data_cast(*last_node)))
+        {
+          // Repeated in the range.
+          destroy_data_node(node);
+        }
+        else
+        {
+          // Not sorted.
+          *p_next   = existing;
+          root_node = build_tree(merged, current_size);
+
+          insert_node(root_node, node);
+          insert(first, last);
+          return;
+        }
+      }
+
+      *p_next   = existing;
+      root_node = build_tree(merged, current_size);
+    }
+
     //*********************************************************************
     /// Returns an iterator pointing to the first element in the container
     /// whose key is not considered to go before the key provided or end()
@@ -40,6 +40,8 @@ SOFTWARE.
 
 namespace etl
 {
+  class imessage_broker_indexed;
+
   //***************************************************************************
   /// Message broker
   //***************************************************************************
@@ -101,6 +103,7 @@ namespace etl
     public:
 
       friend class message_broker;
+      friend class etl::imessage_broker_indexed;
 
       //*******************************
       subscription(etl::imessage_router& router_)
@@ -0,0 +1,385 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_BROKER_INDEXED_INCLUDED
+#define ETL_MESSAGE_BROKER_INDEXED_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_broker.h"
+#include "algorithm.h"
+#include "static_assert.h"
+#include "span.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the indexed message broker.
+  /// Has the same interface and semantics as etl::message_broker, and uses the
+  /// same subscriptions, but keeps a table of message id/subscription pairs,
+  /// sorted by message id, that is updated on subscribe and unsubscribe.
+  /// A message is dispatched by a binary search for its id, followed by a walk
+  /// of only the matching subscriptions, rather than a search of every id list
+  /// of every subscription.
+  /// Subscribers to an id receive it in the order that they subscribed.
+  /// The id list of a subscription is read when it subscribes. Subscribe again
+  /// to pick up any change.
+  //***************************************************************************
+  class imessage_broker_indexed : public etl::imessage_router
+  {
+  public:
+
+    typedef etl::message_broker::subscription      subscription;
+    typedef etl::message_broker::message_id_span_t message_id_span_t;
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Subscribe to the broker.
+    /// Replaces any existing subscription for the same router.
+    /// Returns false, leaving the broker unchanged, if there is not enough
+    /// room for the subscription's message ids.
+    //*******************************************
+    bool subscribe(subscription& new_sub)
+    {
+      const etl::imessage_router* p_router = new_sub.get_router();
+      message_id_span_t           ids      = new_sub.message_id_list();
+
+      if ((entry_count - count_entries(p_router) + ids.size()) > MAX_ENTRIES)
+      {
+        return false;
+      }
+
+      remove_entries(p_router);
+
+      for (message_id_span_t::iterator itr = ids.begin(); itr != ids.end(); ++itr)
+      {
+        insert_entry(*itr, &new_sub);
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Unsubscribe from the broker.
+    //*******************************************
+    void unsubscribe(etl::imessage_router& router)
+    {
+      remove_entries(&router);
+    }
+
+    //*******************************************
+    virtual void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, msg);
+    }
+
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         const etl::imessage&     msg) ETL_OVERRIDE
+    {
+      dispatch(destination_router_id, msg.get_message_id(), msg);
+
+      // Always pass the message on to the successor.
+      if (has_successor())
+      {
+        etl::imessage_router& successor = get_successor();
+
+        successor.receive(destination_router_id, msg);
+      }
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id,
+                         etl::shared_message      shared_msg) ETL_OVERRIDE
+    {
+      dispatch(destination_router_id, shared_msg.get_message().get_message_id(), shared_msg);
+
+      // Always pass the message on to a successor.
+      if (has_successor())
+      {
+        get_successor().receive(destination_router_id, shared_msg);
+      }
+    }
+
+    using imessage_router::accepts;
+
+    //*******************************************
+    /// Message brokers accept all messages.
+    //*******************************************
+    virtual bool accepts(etl::message_id_t) const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*******************************************
+    void clear()
+    {
+      entry_count = 0;
+    }
+
+    //********************************************
+    ETL_DEPRECATED virtual bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    virtual bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    virtual bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //********************************************
+    bool empty() const
+    {
+      return entry_count == 0;
+    }
+
+    //********************************************
+    /// The number of message id/subscription pairs in the index.
+    //********************************************
+    size_t size() const
+    {
+      return entry_count;
+    }
+
+    //********************************************
+    /// The maximum number of message id/subscription pairs in the index.
+    //********************************************
+    size_t max_size() const
+    {
+      return MAX_ENTRIES;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_broker_indexed(etl::message_router_id_t id_,
+                            etl::message_id_t*       p_ids_,
+                            subscription**           p_subscriptions_,
+                            size_t                   max_entries_)
+      : imessage_router(id_)
+      , p_ids(p_ids_)
+      , p_subscriptions(p_subscriptions_)
+      , entry_count(0)
+      , MAX_ENTRIES(max_entries_)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_broker_indexed(etl::message_router_id_t id_,
+                            etl::imessage_router&    successor_,
+                            etl::message_id_t*       p_ids_,
+                            subscription**           p_subscriptions_,
+                            size_t                   max_entries_)
+      : imessage_router(id_, successor_)
+      , p_ids(p_ids_)
+      , p_subscriptions(p_subscriptions_)
+      , entry_count(0)
+      , MAX_ENTRIES(max_entries_)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+  private:
+
+    //*******************************************
+    /// Sends the message to the subscribers to 'id'.
+    //*******************************************
+    template <typename TMessage>
+    void dispatch(etl::message_router_id_t destination_router_id, etl::message_id_t id, const TMessage& msg)
+    {
+      const etl::message_id_t* p_begin = p_ids;
+      const etl::message_id_t* p_end   = p_ids + entry_count;
+      const etl::message_id_t* p_id    = etl::lower_bound(p_begin, p_end, id);
+
+      subscription* const* p_sub = p_subscriptions + (p_id - p_ids);
+
+      while ((p_id != p_end) && (*p_id == id))
+      {
+        etl::imessage_router* router = (*p_sub)->get_router();
+
+        if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
+            destination_router_id == router->get_message_router_id())
+        {
+          router->receive(msg);
+        }
+
+        ++p_id;
+        ++p_sub;
+      }
+    }
+
+    //*******************************************
+    /// Adds an entry after any others for the same id.
+    /// Ids repeated in a subscription's list are only added once.
+    //*******************************************
+    void insert_entry(etl::message_id_t id, subscription* p_sub)
+    {
+      size_t position = static_cast<size_t>(etl::upper_bound(p_ids, p_ids + entry_count, id) - p_ids);
+
+      // The subscription's own entries are always the last for their id.
+      if ((position != 0) && (p_ids[position - 1] == id) && (p_subscriptions[position - 1] == p_sub))
+      {
+        return;
+      }
+
+      for (size_t i = entry_count; i > position; --i)
+      {
+        p_ids[i]           = p_ids[i - 1];
+        p_subscriptions[i] = p_subscriptions[i - 1];
+      }
+
+      p_ids[position]           = id;
+      p_subscriptions[position] = p_sub;
+
+      ++entry_count;
+    }
+
+    //*******************************************
+    /// Removes the entries for the router, keeping the order of the rest.
+    //*******************************************
+    void remove_entries(const etl::imessage_router* p_router)
+    {
+      size_t kept = 0;
+
+      for (size_t i = 0; i < entry_count; ++i)
+      {
+        if (p_subscriptions[i]->get_router() != p_router)
+        {
+          p_ids[kept]           = p_ids[i];
+          p_subscriptions[kept] = p_subscriptions[i];
+          ++kept;
+        }
+      }
+
+      entry_count = kept;
+    }
+
+    //*******************************************
+    /// The number of entries for the router.
+    //*******************************************
+    size_t count_entries(const etl::imessage_router* p_router) const
+    {
+      size_t count = 0;
+
+      for (size_t i = 0; i < entry_count; ++i)
+      {
+        if (p_subscriptions[i]->get_router() == p_router)
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    etl::message_id_t* const p_ids;           ///< Sorted, so that a message's subscribers are found by binary search.
+    subscription** const     p_subscriptions; ///< In step with p_ids.
+    size_t                   entry_count;
+
+  public:
+
+    const size_t MAX_ENTRIES;
+  };
+
+  //***************************************************************************
+  /// The indexed message broker.
+  ///\tparam MAX_ENTRIES_ The maximum total number of message ids over all of
+  /// the subscriptions.
+  //***************************************************************************
+  template <size_t MAX_ENTRIES_>
+  class message_broker_indexed : public etl::imessage_broker_indexed
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_ENTRIES_ > 0, "Zero entries");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed()
+      : imessage_broker_indexed(etl::imessage_router::MESSAGE_BROKER, id_array, subscription_array, MAX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::imessage_router& successor_)
+      : imessage_broker_indexed(etl::imessage_router::MESSAGE_BROKER, successor_, id_array, subscription_array, MAX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_)
+      : imessage_broker_indexed(id_, id_array, subscription_array, MAX_ENTRIES_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_broker_indexed(id_, successor_, id_array, subscription_array, MAX_ENTRIES_)
+    {
+    }
+
+  private:
+
+    etl::message_id_t id_array[MAX_ENTRIES_];
+    subscription*     subscription_array[MAX_ENTRIES_];
+  };
+}
+
+#endif
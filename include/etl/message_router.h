@@ -382,6 +382,164 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  //***************************************************************************
+  // Routers with at least this many message types find the handler for a
+  // message with a table lookup, rather than by comparing the id with each
+  // message type's id in turn.
+  //***************************************************************************
+#if !defined(ETL_MESSAGE_ROUTER_DISPATCH_TABLE_THRESHOLD)
+  #define ETL_MESSAGE_ROUTER_DISPATCH_TABLE_THRESHOLD 8
+#endif
+
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// Maps message ids to handlers with an array indexed by 'id - Min_Id'.
+    /// Used when the ids are dense.
+    //*************************************************************************
+    template <typename THandler, size_t Number_Of_Ids, etl::message_id_t Min_Id, size_t Id_Range>
+    class dense_dispatch_table
+    {
+    public:
+
+      //*******************************
+      constexpr dense_dispatch_table(const etl::message_id_t (&ids)[Number_Of_Ids], const THandler (&handlers_)[Number_Of_Ids])
+        : handlers()
+      {
+        // In reverse, so that the first of any repeated ids wins.
+        for (size_t i = Number_Of_Ids; i != 0U; --i)
+        {
+          handlers[size_t(ids[i - 1U] - Min_Id)] = handlers_[i - 1U];
+        }
+      }
+
+      //*******************************
+      /// Returns the handler for the id, or ETL_NULLPTR.
+      //*******************************
+      THandler find(etl::message_id_t id) const
+      {
+        // Ids below Min_Id wrap to large values.
+        const size_t index = size_t(id - Min_Id);
+
+        return (index < Id_Range) ? handlers[index] : ETL_NULLPTR;
+      }
+
+    private:
+
+      THandler handlers[Id_Range];
+    };
+
+    //*************************************************************************
+    /// Maps message ids to handlers with a binary search of the sorted ids.
+    /// Used when the ids are sparse.
+    //*************************************************************************
+    template <typename THandler, size_t Number_Of_Ids>
+    class sorted_dispatch_table
+    {
+    public:
+
+      //*******************************
+      constexpr sorted_dispatch_table(const etl::message_id_t (&ids_)[Number_Of_Ids], const THandler (&handlers_)[Number_Of_Ids])
+        : ids()
+        , handlers()
+      {
+        // A stable insertion sort, so that the first of any repeated ids wins.
+        for (size_t i = 0U; i < Number_Of_Ids; ++i)
+        {
+          size_t j = i;
+
+          while ((j != 0U) && (ids_[i] < ids[j - 1U]))
+          {
+            ids[j]      = ids[j - 1U];
+            handlers[j] = handlers[j - 1U];
+            --j;
+          }
+
+          ids[j]      = ids_[i];
+          handlers[j] = handlers_[i];
+        }
+      }
+
+      //*******************************
+      /// Returns the handler for the id, or ETL_NULLPTR.
+      //*******************************
+      THandler find(etl::message_id_t id) const
+      {
+        size_t first = 0U;
+        size_t count = Number_Of_Ids;
+
+        while (count != 0U)
+        {
+          const size_t step = count / 2U;
+
+          if (ids[first + step] < id)
+          {
+            first += step + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return ((first != Number_Of_Ids) && (ids[first] == id)) ? handlers[first] : ETL_NULLPTR;
+      }
+
+    private:
+
+      etl::message_id_t ids[Number_Of_Ids];
+      THandler          handlers[Number_Of_Ids];
+    };
+
+    //*************************************************************************
+    /// Selects the dispatch table for the message types.
+    /// The dense table is used if at least half of the ids in the range
+    /// between the lowest and highest are used.
+    //*************************************************************************
+    template <typename THandler, typename... TMessageTypes>
+    struct dispatch_table_type
+    {
+      static constexpr size_t Number_Of_Ids = sizeof...(TMessageTypes);
+
+      static constexpr etl::message_id_t get_min_id()
+      {
+        const etl::message_id_t ids[] = { etl::message_id_t(TMessageTypes::ID)... };
+
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          result = (ids[i] < result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      static constexpr etl::message_id_t get_max_id()
+      {
+        const etl::message_id_t ids[] = { etl::message_id_t(TMessageTypes::ID)... };
+
+        etl::message_id_t result = ids[0];
+
+        for (size_t i = 1U; i < Number_Of_Ids; ++i)
+        {
+          result = (ids[i] > result) ? ids[i] : result;
+        }
+
+        return result;
+      }
+
+      static constexpr etl::message_id_t Min_Id   = get_min_id();
+      static constexpr size_t            Id_Range = size_t(get_max_id() - Min_Id) + 1U;
+      static constexpr bool              Is_Dense = (Id_Range <= (2U * Number_Of_Ids));
+
+      typedef typename etl::conditional<Is_Dense,
+                                        dense_dispatch_table<THandler, Number_Of_Ids, Min_Id, Id_Range>,
+                                        sorted_dispatch_table<THandler, Number_Of_Ids> >::type type;
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -392,6 +550,11 @@ namespace etl
 
     typedef etl::message_packet<TMessageTypes...> message_packet;
 
+    //**********************************************
+    /// True if the handler for a message is found with a table lookup.
+    //**********************************************
+    static constexpr bool Uses_Dispatch_Table = (sizeof...(TMessageTypes) >= ETL_MESSAGE_ROUTER_DISPATCH_TABLE_THRESHOLD);
+
     //**********************************************
     message_router()
       : imessage_router(etl::imessage_router::MESSAGE_ROUTER)
@@ -423,7 +586,23 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      bool was_handled;
+
+      if constexpr (Uses_Dispatch_Table)
+      {
+        const handler_t handler = get_dispatch_table().find(msg.get_message_id());
+
+        was_handled = (handler != ETL_NULLPTR);
+
+        if (was_handled)
+        {
+          handler(*this, msg);
+        }
+      }
+      else
+      {
+        was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      }
 
       if (!was_handled)
       {
@@ -463,7 +642,25 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if constexpr (Uses_Dispatch_Table)
+      {
+        if (get_dispatch_table().find(id) != ETL_NULLPTR)
+        {
+          return true;
+        }
+        else if (has_successor())
+        {
+          return get_successor().accepts(id);
+        }
+        else
+        {
+          return false;
+        }
+      }
+      else
+      {
+        return (accepts_type<TMessageTypes>(id) || ...);
+      }
     }
 
     //********************************************
@@ -486,6 +683,28 @@ namespace etl
 
   private:
 
+    typedef void (*handler_t)(message_router&, const etl::imessage&);
+
+    //********************************************
+    template <typename TMessage>
+    static void receive_thunk(message_router& router, const etl::imessage& msg)
+    {
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
+    }
+
+    //********************************************
+    /// The table is built at compile time.
+    //********************************************
+    static const auto& get_dispatch_table()
+    {
+      typedef typename private_message_router::dispatch_table_type<handler_t, TMessageTypes...>::type table_t;
+
+      static constexpr table_t table({ etl::message_id_t(TMessageTypes::ID)... },
+                                     { &message_router::template receive_thunk<TMessageTypes>... });
+
+      return table;
+    }
+
     //********************************************
     template <typename TMessage>
     bool receive_message_type(const etl::imessage& msg)
@@ -0,0 +1,327 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_ROUTER_INBOX_INCLUDED
+#define ETL_MESSAGE_ROUTER_INBOX_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "reference_counted_message_pool.h"
+#include "queue_mpmc_atomic.h"
+#include "optional.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for message router inbox
+  //***************************************************************************
+  class message_router_inbox_exception : public etl::exception
+  {
+  public:
+
+    message_router_inbox_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The inbox is full.
+  //***************************************************************************
+  class message_router_inbox_full : public etl::message_router_inbox_exception
+  {
+  public:
+
+    message_router_inbox_full(string_type file_name_, numeric_type line_number_)
+      : message_router_inbox_exception(ETL_ERROR_TEXT("message router inbox:full", ETL_MESSAGE_ROUTER_INBOX_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The message is not a shared message, and its type is unknown, so it
+  /// cannot be copied to the inbox.
+  //***************************************************************************
+  class message_router_inbox_not_shared : public etl::message_router_inbox_exception
+  {
+  public:
+
+    message_router_inbox_not_shared(string_type file_name_, numeric_type line_number_)
+      : message_router_inbox_exception(ETL_ERROR_TEXT("message router inbox:not shared", ETL_MESSAGE_ROUTER_INBOX_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Interface for a message router inbox.
+  /// Messages received by the inbox, from any number of threads, are queued
+  /// in a lock free queue of shared messages. The thread that owns the
+  /// destination router calls process_queue to pass them on, so the
+  /// destination router never has to be locked.
+  /// Only shared messages can be queued through the imessage_router
+  /// interface. Messages of a known type are copied to a shared message in the
+  /// pool by the message_router_inbox receive and post templates.
+  //***************************************************************************
+  class imessage_router_inbox : public etl::imessage_router
+  {
+  public:
+
+    typedef etl::optional<etl::shared_message>        queue_value_type;
+    typedef etl::iqueue_mpmc_atomic<queue_value_type> queue_type;
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Adds the shared message to the inbox.
+    /// Returns false if the inbox is full.
+    /// May be called from any thread.
+    //*******************************************
+    bool post(etl::shared_message shared_msg)
+    {
+#if ETL_USING_CPP11
+      return queue.push(queue_value_type(etl::move(shared_msg)));
+#else
+      return queue.push(queue_value_type(shared_msg));
+#endif
+    }
+
+    //*******************************************
+    /// Adds the shared message to the inbox.
+    /// Raises an error if the inbox is full.
+    /// May be called from any thread.
+    //*******************************************
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      const bool posted = post(shared_msg);
+
+      ETL_ASSERT(posted, ETL_ERROR(etl::message_router_inbox_full));
+      (void)posted;
+    }
+
+    //*******************************************
+    /// A message that is not shared cannot be queued, as its type is unknown.
+    /// Raises an error.
+    //*******************************************
+    virtual void receive(const etl::imessage&) ETL_OVERRIDE
+    {
+      ETL_ASSERT_FAIL(ETL_ERROR(etl::message_router_inbox_not_shared));
+    }
+
+    //*******************************************
+    /// Passes up to 'max_messages' queued messages to the destination router.
+    /// Returns the number of messages passed on.
+    /// Must only be called from the thread that owns the destination router.
+    //*******************************************
+    size_t process_queue(size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      queue_value_type shared_msg;
+
+      while ((count < max_messages) && queue.pop(shared_msg))
+      {
+#if ETL_USING_CPP11
+        destination.receive(etl::move(*shared_msg));
+#else
+        destination.receive(*shared_msg);
+#endif
+        ++count;
+      }
+
+      return count;
+    }
+
+    using imessage_router::accepts;
+
+    //*******************************************
+    /// Accepts the messages that the destination router accepts.
+    //*******************************************
+    virtual bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    //********************************************
+    ETL_DEPRECATED virtual bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //********************************************
+    virtual bool is_producer() const ETL_OVERRIDE
+    {
+      return destination.is_producer();
+    }
+
+    //********************************************
+    virtual bool is_consumer() const ETL_OVERRIDE
+    {
+      return destination.is_consumer();
+    }
+
+    //********************************************
+    /// The router that the queued messages are passed to.
+    //********************************************
+    etl::imessage_router& get_destination() const
+    {
+      return destination;
+    }
+
+    //********************************************
+    /// The number of queued messages.
+    //********************************************
+    size_t size() const
+    {
+      return queue.size();
+    }
+
+    //********************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //********************************************
+    bool full() const
+    {
+      return queue.full();
+    }
+
+    //********************************************
+    size_t max_size() const
+    {
+      return queue.max_size();
+    }
+
+    //********************************************
+    /// Discards the queued messages.
+    /// Must only be called from the thread that owns the destination router.
+    //********************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    /// The inbox has the same router id as the destination router.
+    //*******************************************
+    imessage_router_inbox(etl::imessage_router& destination_, queue_type& queue_)
+      : imessage_router(destination_.get_message_router_id())
+      , destination(destination_)
+      , queue(queue_)
+    {
+    }
+
+  private:
+
+    etl::imessage_router& destination;
+    queue_type&           queue;
+  };
+
+  //***************************************************************************
+  /// A message router inbox.
+  ///\tparam TPool      The type of the pool that messages are copied to.
+  ///\tparam QUEUE_SIZE The maximum number of queued messages.
+  //***************************************************************************
+  template <typename TPool, size_t QUEUE_SIZE>
+  class message_router_inbox : public etl::imessage_router_inbox
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<etl::ireference_counted_message_pool, TPool>::value), "TPool not derived from etl::ireference_counted_message_pool");
+
+    using etl::imessage_router_inbox::receive;
+    using etl::imessage_router_inbox::post;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_router_inbox(etl::imessage_router& destination_, TPool& pool_)
+      : imessage_router_inbox(destination_, inbox)
+      , pool(pool_)
+    {
+    }
+
+    //*******************************************
+    /// Copies the message to the pool and adds it to the inbox.
+    /// Returns false if the inbox is full.
+    /// May be called from any thread, if the pool is thread safe.
+    //*******************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_base_of<etl::imessage, TMessage>::value, bool>::type
+      post(const TMessage& msg)
+    {
+      if (full())
+      {
+        return false;
+      }
+
+      return post(etl::shared_message(pool, msg));
+    }
+
+    //*******************************************
+    /// Copies the message to the pool and adds it to the inbox.
+    /// Raises an error if the inbox is full.
+    /// May be called from any thread, if the pool is thread safe.
+    //*******************************************
+    template <typename TMessage>
+    typename etl::enable_if<etl::is_base_of<etl::imessage, TMessage>::value && !etl::is_same<etl::imessage, TMessage>::value, void>::type
+      receive(const TMessage& msg)
+    {
+      const bool posted = post(msg);
+
+      ETL_ASSERT(posted, ETL_ERROR(etl::message_router_inbox_full));
+      (void)posted;
+    }
+
+  private:
+
+    TPool& pool;
+    etl::queue_mpmc_atomic<queue_value_type, QUEUE_SIZE> inbox;
+  };
+}
+
+#endif
+#endif
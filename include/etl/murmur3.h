@@ -35,8 +35,12 @@ SOFTWARE.
 #include "ihash.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "array.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -47,6 +51,42 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_murmur3
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit block.
+    //*************************************************************************
+    inline uint32_t read32(const uint8_t* p)
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+#else
+      return uint32_t(p[0]) | (uint32_t(p[1]) << 8U) | (uint32_t(p[2]) << 16U) | (uint32_t(p[3]) << 24U);
+#endif
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Reads a little endian 64 bit block.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      uint64_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+#else
+      return  uint64_t(p[0])         | (uint64_t(p[1]) << 8U)  | (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U) |
+             (uint64_t(p[4]) << 32U) | (uint64_t(p[5]) << 40U) | (uint64_t(p[6]) << 48U) | (uint64_t(p[7]) << 56U);
+#endif
+    }
+#endif
+  }
+
   //***************************************************************************
   /// Calculates the murmur3 hash.
   /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
@@ -88,20 +128,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -127,20 +154,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -153,16 +167,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block = 0;
-      }
-
-      ++char_count;
+      add_byte(value_);
     }
 
     //*************************************************************************
@@ -184,16 +189,78 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8U);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block);
+        block_fill_count = 0;
+        block = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a whole block at a time.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p    = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* pend = reinterpret_cast<const uint8_t*>(end);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0U) && (p != pend))
+      {
+        add_byte(*p++);
+      }
+
+      const size_t length = static_cast<size_t>(pend - p) & ~size_t(FULL_BLOCK - 1U);
+      const uint8_t* pblocks_end = p + length;
+
+      while (p != pblocks_end)
+      {
+        add_block(private_murmur3::read32(p));
+        p += FULL_BLOCK;
+      }
+
+      char_count += length;
+
+      while (p != pend)
+      {
+        add_byte(*p++);
+      }
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
-    void add_block()
+    void add_block(value_type k)
     {
-      block *= CONSTANT1;
-      block = rotate_left(block, SHIFT1);
-      block *= CONSTANT2;
+      k *= CONSTANT1;
+      k = rotate_left(k, SHIFT1);
+      k *= CONSTANT2;
 
-      hash ^= block;
+      hash ^= k;
       hash = rotate_left(hash, SHIFT2);
       hash = (hash * MULTIPLY) + ADD;
     }
@@ -236,6 +303,288 @@ namespace etl
     static ETL_CONSTANT value_type MULTIPLY   = 5;
     static ETL_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 128 bit x64 murmur3 hash.
+  /// The value is the pair of 64 bit halves, h1 then h2, as output by MurmurHash3_x64_128.
+  /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_128
+  {
+  public:
+
+    typedef etl::array<uint64_t, 2> value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_128(uint64_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_128(TIterator begin, const TIterator end, uint64_t seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      h1               = seed;
+      h2               = seed;
+      char_count       = 0;
+      block1           = 0;
+      block2           = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_byte(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+
+      value_type result = { { h1, h2 } };
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      if (block_fill_count < HALF_BLOCK)
+      {
+        block1 |= uint64_t(value_) << (block_fill_count * 8U);
+      }
+      else
+      {
+        block2 |= uint64_t(value_) << ((block_fill_count - HALF_BLOCK) * 8U);
+      }
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block1, block2);
+        block_fill_count = 0;
+        block1 = 0;
+        block2 = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a whole block at a time.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      const uint8_t* p    = reinterpret_cast<const uint8_t*>(begin);
+      const uint8_t* pend = reinterpret_cast<const uint8_t*>(end);
+
+      // Complete any partially filled block.
+      while ((block_fill_count != 0U) && (p != pend))
+      {
+        add_byte(*p++);
+      }
+
+      const size_t length = static_cast<size_t>(pend - p) & ~size_t(FULL_BLOCK - 1U);
+      const uint8_t* pblocks_end = p + length;
+
+      while (p != pblocks_end)
+      {
+        add_block(private_murmur3::read64(p), private_murmur3::read64(p + HALF_BLOCK));
+        p += FULL_BLOCK;
+      }
+
+      char_count += length;
+
+      while (p != pend)
+      {
+        add_byte(*p++);
+      }
+    }
+
+    //*************************************************************************
+    /// Mixes the first half of a block.
+    //*************************************************************************
+    static uint64_t mix1(uint64_t k1)
+    {
+      k1 *= CONSTANT1;
+      k1  = rotate_left(k1, SHIFT1);
+      k1 *= CONSTANT2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    /// Mixes the second half of a block.
+    //*************************************************************************
+    static uint64_t mix2(uint64_t k2)
+    {
+      k2 *= CONSTANT2;
+      k2  = rotate_left(k2, SHIFT2);
+      k2 *= CONSTANT1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    /// The 64 bit finalisation mix.
+    //*************************************************************************
+    static uint64_t fmix(uint64_t k)
+    {
+      k ^= (k >> 33U);
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= (k >> 33U);
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= (k >> 33U);
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block(uint64_t k1, uint64_t k2)
+    {
+      h1 ^= mix1(k1);
+      h1  = rotate_left(h1, SHIFT3);
+      h1 += h2;
+      h1  = (h1 * MULTIPLY) + ADD1;
+
+      h2 ^= mix2(k2);
+      h2  = rotate_left(h2, SHIFT4);
+      h2 += h1;
+      h2  = (h2 * MULTIPLY) + ADD2;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        if (block_fill_count > HALF_BLOCK)
+        {
+          h2 ^= mix2(block2);
+        }
+
+        if (block_fill_count > 0U)
+        {
+          h1 ^= mix1(block1);
+        }
+
+        h1 ^= char_count;
+        h2 ^= char_count;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        is_finalised = true;
+      }
+    }
+
+    bool     is_finalised;
+    uint8_t  block_fill_count;
+    size_t   char_count;
+    uint64_t block1;
+    uint64_t block2;
+    uint64_t h1;
+    uint64_t h2;
+    uint64_t seed;
+
+    static ETL_CONSTANT uint8_t  FULL_BLOCK = 16U;
+    static ETL_CONSTANT uint8_t  HALF_BLOCK = 8U;
+    static ETL_CONSTANT uint64_t CONSTANT1  = 0x87C37B91114253D5ULL;
+    static ETL_CONSTANT uint64_t CONSTANT2  = 0x4CF5AD432745937FULL;
+    static ETL_CONSTANT size_t   SHIFT1     = 31;
+    static ETL_CONSTANT size_t   SHIFT2     = 33;
+    static ETL_CONSTANT size_t   SHIFT3     = 27;
+    static ETL_CONSTANT size_t   SHIFT4     = 31;
+    static ETL_CONSTANT uint64_t MULTIPLY   = 5;
+    static ETL_CONSTANT uint64_t ADD1       = 0x52DCE729UL;
+    static ETL_CONSTANT uint64_t ADD2       = 0x38495AB5UL;
+  };
+#endif
 }
 
 #endif
@@ -231,6 +231,48 @@ SOFTWARE.
   #define ETL_HAS_MUTABLE_ARRAY_VIEW 0
 #endif
 
+//*************************************
+// Option to use the carry-less multiply CRC backend on x86-64.
+#if defined(ETL_CRC_USE_CLMUL) && (defined(__x86_64__) || defined(_M_X64)) && \
+    (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_MICROSOFT))
+  #define ETL_HAS_CRC_CLMUL 1
+#else
+  #define ETL_HAS_CRC_CLMUL 0
+#endif
+
+//*************************************
+// Indicate if the flat unordered containers probe with SSE2.
+// Define ETL_UNORDERED_FLAT_NO_SSE2 to force the portable scalar group.
+#if !defined(ETL_UNORDERED_FLAT_NO_SSE2) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+  #define ETL_HAS_UNORDERED_FLAT_SSE2 1
+#else
+  #define ETL_HAS_UNORDERED_FLAT_SSE2 0
+#endif
+
+//*************************************
+// Option to use wyhash, rather than FNV-1a, for etl::hash of strings and byte ranges.
+#if defined(ETL_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+  #define ETL_HAS_HASH_WYHASH 1
+#else
+  #define ETL_HAS_HASH_WYHASH 0
+#endif
+
+//*************************************
+// Option to add blocking waits to the single producer, single consumer atomic queues.
+#if defined(ETL_SPSC_ATOMIC_USE_WAIT)
+  #define ETL_HAS_SPSC_ATOMIC_WAIT 1
+#else
+  #define ETL_HAS_SPSC_ATOMIC_WAIT 0
+#endif
+
+//*************************************
+// The size of a cache line.
+// Used to keep data written by different threads on separate cache lines.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // The macros below are dependent on the profile.
 // C++11
@@ -415,6 +457,7 @@ namespace etl
     // General
     static ETL_CONSTANT long cplusplus                        = __cplusplus;
     static ETL_CONSTANT int  language_standard                = ETL_LANGUAGE_STANDARD;
+    static ETL_CONSTANT size_t cache_line_size                = ETL_CACHE_LINE_SIZE;
 
     // Using...
     static ETL_CONSTANT bool using_stl                        = (ETL_USING_STL == 1);
@@ -455,6 +498,10 @@ namespace etl
     static ETL_CONSTANT bool has_ivector_repair               = (ETL_HAS_IVECTOR_REPAIR == 1);
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
+    static ETL_CONSTANT bool has_crc_clmul                    = (ETL_HAS_CRC_CLMUL == 1);
+    static ETL_CONSTANT bool has_unordered_flat_sse2          = (ETL_HAS_UNORDERED_FLAT_SSE2 == 1);
+    static ETL_CONSTANT bool has_hash_wyhash                  = (ETL_HAS_HASH_WYHASH == 1);
+    static ETL_CONSTANT bool has_spsc_atomic_wait             = (ETL_HAS_SPSC_ATOMIC_WAIT == 1);
 
     // Is...
     static ETL_CONSTANT bool is_debug_build                   = (ETL_IS_DEBUG_BUILD == 1);
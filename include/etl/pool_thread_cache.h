@@ -0,0 +1,738 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_THREAD_CACHE_INCLUDED
+#define ETL_POOL_THREAD_CACHE_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "atomic.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "log.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup pool_thread_cache pool_thread_cache
+/// A lock free depot for the items of a pool, and per thread caches that
+/// allocate from it.
+///\ingroup pool
+//*****************************************************************************
+
+namespace etl
+{
+  class ipool_thread_cache;
+
+  //***************************************************************************
+  /// The interface for a pool depot.
+  /// The depot takes all of the free items of an etl::pool or
+  /// etl::generic_pool when it is constructed, and holds them in a lock free
+  /// stack, so that they may be shared between threads.
+  /// Items are taken from, and returned to, the depot in batches by
+  /// etl::pool_thread_cache objects, one per thread.
+  /// The free items are a stack of item indexes. The head index is stored
+  /// with a count of changes, so that a compare-exchange of the head fails if
+  /// the stack has changed in the meantime, even if the head index is the same.
+  /// The index takes the fewest bits that can hold the pool size, and the
+  /// count has the rest. The count wraps, so a thread that is held between
+  /// reading the head and its compare-exchange while exactly a multiple of
+  /// 2^(bits - index bits) other changes are made will still succeed wrongly.
+  ///\ingroup pool_thread_cache
+  //***************************************************************************
+  class ipool_depot
+  {
+  public:
+
+    friend class ipool_thread_cache;
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the depot.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      if (n_items == 0U)
+      {
+        return false;
+      }
+
+      // Within the range of the items?
+      bool is_within_range = (p >= p_items[0]) && (p <= p_items[n_items - 1U]);
+
+      // A search can be slow, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      bool is_valid_address = is_within_range && (find_index(p) != No_Index);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items taken from the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return n_items;
+    }
+
+    //*************************************************************************
+    /// Returns the number of items in the depot.
+    /// Items held by the thread caches are not included.
+    /// May be out of date by the time that it is read, if other threads are
+    /// using the depot.
+    //*************************************************************************
+    size_t available() const
+    {
+      return n_available.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Returns the largest object size that may be allocated.
+    //*************************************************************************
+    size_t type_size() const
+    {
+      return Type_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the largest object alignment that may be allocated.
+    //*************************************************************************
+    size_t alignment() const
+    {
+      return Alignment;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    /// The low 'index_bits_' bits of the head are the index, the rest are the
+    /// change count.
+    //*************************************************************************
+    ipool_depot(etl::ipool&          pool_,
+                char**               p_items_,
+                etl::atomic<size_t>* p_next_,
+                size_t               type_size_,
+                size_t               alignment_,
+                size_t               index_bits_)
+      : pool(pool_)
+      , p_items(p_items_)
+      , p_next(p_next_)
+      , n_items(0U)
+      , Index_Mask((size_t(1U) << index_bits_) - 1U)
+      , Count_Unit(size_t(1U) << index_bits_)
+      , No_Index(Index_Mask)
+      , head(No_Index)
+      , n_available(0U)
+      , Type_Size(type_size_)
+      , Alignment(alignment_)
+    {
+    }
+
+    //*************************************************************************
+    /// Takes the free items from the pool.
+    /// Called from the derived class constructor, once the arrays exist.
+    //*************************************************************************
+    void initialise()
+    {
+      while (!pool.full())
+      {
+        p_items[n_items++] = pool.allocate<char>();
+      }
+
+      // Sorted, so that an item's index may be found by binary search.
+      etl::sort(p_items, p_items + n_items);
+
+      for (size_t i = 0U; i < n_items; ++i)
+      {
+        p_next[i].store(((i + 1U) < n_items) ? i + 1U : No_Index, etl::memory_order_relaxed);
+      }
+
+      n_available.store(n_items, etl::memory_order_relaxed);
+      head.store((n_items != 0U) ? 0U : No_Index, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Returns the items held by the depot to the pool.
+    /// Called from the derived class destructor.
+    /// Items held by thread caches, or allocated, are not returned.
+    //*************************************************************************
+    void restore_pool()
+    {
+      size_t index = head.load(etl::memory_order_acquire) & Index_Mask;
+
+      while (index != No_Index)
+      {
+        pool.release(p_items[index]);
+        index = p_next[index].load(etl::memory_order_relaxed);
+      }
+
+      head.store(No_Index, etl::memory_order_relaxed);
+      n_available.store(0U, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes up to 'n' items from the depot with one compare-exchange.
+    /// Returns the number of items taken.
+    //*************************************************************************
+    size_t acquire(char** p_out, size_t n)
+    {
+      size_t old_head = head.load(etl::memory_order_acquire);
+      size_t count;
+      size_t index;
+
+      do
+      {
+        count = 0U;
+        index = old_head & Index_Mask;
+
+        // The links may be stale if another thread has taken the items, but
+        // then the change count will have changed and the exchange will fail.
+        while ((count < n) && (index != No_Index))
+        {
+          p_out[count++] = p_items[index];
+          index = p_next[index].load(etl::memory_order_relaxed);
+        }
+
+        if (count == 0U)
+        {
+          return 0U;
+        }
+      } while (!head.compare_exchange_weak(old_head, ((old_head & ~Index_Mask) + Count_Unit) | index, etl::memory_order_acquire, etl::memory_order_acquire));
+
+      n_available.fetch_sub(count, etl::memory_order_relaxed);
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns 'n' items to the depot with one compare-exchange.
+    //*************************************************************************
+    void restore(char* const* p_in, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      // Link the items together.
+      const size_t first = find_index(p_in[0]);
+      size_t       last  = first;
+
+      ETL_ASSERT(first != No_Index, ETL_ERROR(etl::pool_object_not_in_pool));
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        const size_t index = find_index(p_in[i]);
+
+        ETL_ASSERT(index != No_Index, ETL_ERROR(etl::pool_object_not_in_pool));
+
+        p_next[last].store(index, etl::memory_order_relaxed);
+        last = index;
+      }
+
+      // Push the linked items on to the stack.
+      size_t old_head = head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_next[last].store(old_head & Index_Mask, etl::memory_order_relaxed);
+      } while (!head.compare_exchange_weak(old_head, ((old_head & ~Index_Mask) + Count_Unit) | first, etl::memory_order_release, etl::memory_order_relaxed));
+
+      n_available.fetch_add(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Finds the index of an item, or No_Index.
+    //*************************************************************************
+    size_t find_index(const char* p) const
+    {
+      const char* const* p_begin = p_items;
+      const char* const* p_end   = p_items + n_items;
+      const char* const* p_item  = etl::lower_bound(p_begin, p_end, p);
+
+      return ((p_item != p_end) && (*p_item == p)) ? static_cast<size_t>(p_item - p_begin) : No_Index;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_depot(const ipool_depot&);
+    ipool_depot& operator =(const ipool_depot&);
+
+    etl::ipool&          pool;
+    char** const         p_items;     ///< The items taken from the pool, sorted by address.
+    etl::atomic<size_t>* p_next;      ///< The index of the free item after each free item.
+    size_t               n_items;     ///< The number of items taken from the pool.
+    const size_t         Index_Mask;  ///< The bits of the head that are the index.
+    const size_t         Count_Unit;  ///< One change in the count bits of the head.
+    const size_t         No_Index;    ///< The index that ends the stack.
+    etl::atomic<size_t>  head;        ///< The change count and the index of the first free item.
+    etl::atomic<size_t>  n_available; ///< The number of items in the depot.
+    const size_t         Type_Size;
+    const size_t         Alignment;
+
+  protected:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ipool_depot()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A pool depot for an etl::pool or etl::generic_pool.
+  /// All free items are taken from the pool on construction, and those in the
+  /// depot are returned to it on destruction.
+  /// The thread caches that use the depot must be destroyed first.
+  ///\tparam TPool The type of the pool.
+  ///\ingroup pool_thread_cache
+  //***************************************************************************
+  template <typename TPool>
+  class pool_depot : public etl::ipool_depot
+  {
+  public:
+
+    static ETL_CONSTANT size_t SIZE = TPool::SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_depot(TPool& pool_)
+      : etl::ipool_depot(pool_, items, next, TPool::TYPE_SIZE, TPool::ALIGNMENT, Index_Bits)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor
+    //*************************************************************************
+    ~pool_depot()
+    {
+      this->restore_pool();
+    }
+
+  private:
+
+    // The fewest bits that can hold SIZE.
+    static ETL_CONSTANT size_t Index_Bits = etl::log2<SIZE>::value + 1U;
+
+    ETL_STATIC_ASSERT(Index_Bits < etl::integral_limits<size_t>::bits, "Too many items for the index");
+
+    char*               items[SIZE];
+    etl::atomic<size_t> next[SIZE];
+  };
+
+  template <typename TPool>
+  ETL_CONSTANT size_t pool_depot<TPool>::SIZE;
+
+  template <typename TPool>
+  ETL_CONSTANT size_t pool_depot<TPool>::Index_Bits;
+
+  //***************************************************************************
+  /// The interface for a pool thread cache.
+  /// Each thread that allocates from a depot has its own cache, which holds
+  /// a magazine of free items. Most allocations and releases are served by
+  /// the magazine, without any atomic operations. When the magazine is empty
+  /// it is half filled from the depot, and when it is full half of it is
+  /// returned to the depot, each with one compare-exchange.
+  /// A cache must only be used by one thread at a time, but an item may be
+  /// released to a different cache from the one that allocated it.
+  /// As the caches hold items, an allocation may fail while other caches have
+  /// free items.
+  ///\ingroup pool_thread_cache
+  //***************************************************************************
+  class ipool_thread_cache
+  {
+  public:
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if ((sizeof(T) > depot.type_size()) || (etl::alignment_of<T>::value > depot.alignment()))
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create default.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the cache and create with 1 parameter.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object to the cache.
+    /// If asserts or exceptions are enabled and the object does not belong to the
+    /// depot then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns all of the items in the cache to the depot.
+    //*************************************************************************
+    void flush()
+    {
+      depot.restore(p_magazine, count);
+      count = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of free items in the cache.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Magazine_Size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the cache.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the depot that the cache uses.
+    //*************************************************************************
+    etl::ipool_depot& get_depot() const
+    {
+      return depot;
+    }
+
+    //*************************************************************************
+    /// The number of allocations served by the cache alone.
+    //*************************************************************************
+    size_t allocate_hits() const
+    {
+      return allocate_hit_count;
+    }
+
+    //*************************************************************************
+    /// The number of allocations that had to go to the depot.
+    //*************************************************************************
+    size_t allocate_misses() const
+    {
+      return allocate_miss_count;
+    }
+
+    //*************************************************************************
+    /// The number of releases served by the cache alone.
+    //*************************************************************************
+    size_t release_hits() const
+    {
+      return release_hit_count;
+    }
+
+    //*************************************************************************
+    /// The number of releases that had to go to the depot.
+    //*************************************************************************
+    size_t release_misses() const
+    {
+      return release_miss_count;
+    }
+
+    //*************************************************************************
+    /// Sets the hit and miss counts to zero.
+    //*************************************************************************
+    void reset_counters()
+    {
+      allocate_hit_count  = 0U;
+      allocate_miss_count = 0U;
+      release_hit_count   = 0U;
+      release_miss_count  = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_thread_cache(etl::ipool_depot& depot_, char** p_magazine_, size_t magazine_size_)
+      : depot(depot_)
+      , p_magazine(p_magazine_)
+      , count(0U)
+      , allocate_hit_count(0U)
+      , allocate_miss_count(0U)
+      , release_hit_count(0U)
+      , release_miss_count(0U)
+      , Magazine_Size(magazine_size_)
+      , Batch_Size((magazine_size_ + 1U) / 2U)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Allocate an item, refilling the magazine from the depot if it is empty.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      if (count == 0U)
+      {
+        ++allocate_miss_count;
+
+        count = depot.acquire(p_magazine, Batch_Size);
+
+        if (count == 0U)
+        {
+          ETL_ASSERT(false, ETL_ERROR(etl::pool_no_allocation));
+          return ETL_NULLPTR;
+        }
+      }
+      else
+      {
+        ++allocate_hit_count;
+      }
+
+      return p_magazine[--count];
+    }
+
+    //*************************************************************************
+    /// Release an item, returning half of the magazine to the depot if it is full.
+    //*************************************************************************
+    void release_item(char* p_value)
+    {
+      // Does it belong to us?
+      ETL_ASSERT(depot.is_in_pool(p_value), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      if (count == Magazine_Size)
+      {
+        ++release_miss_count;
+
+        count -= Batch_Size;
+        depot.restore(p_magazine + count, Batch_Size);
+      }
+      else
+      {
+        ++release_hit_count;
+      }
+
+      p_magazine[count++] = p_value;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_thread_cache(const ipool_thread_cache&);
+    ipool_thread_cache& operator =(const ipool_thread_cache&);
+
+    etl::ipool_depot& depot;
+    char** const      p_magazine;
+    size_t            count;      ///< The number of free items in the magazine.
+
+    size_t allocate_hit_count;
+    size_t allocate_miss_count;
+    size_t release_hit_count;
+    size_t release_miss_count;
+
+    const size_t Magazine_Size;
+    const size_t Batch_Size;      ///< The number of items moved to or from the depot at a time.
+
+  protected:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~ipool_thread_cache()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A pool thread cache.
+  /// Any free items are returned to the depot on destruction.
+  ///\tparam VMagazine_Size The maximum number of free items held by the cache.
+  ///\ingroup pool_thread_cache
+  //***************************************************************************
+  template <size_t VMagazine_Size>
+  class pool_thread_cache : public etl::ipool_thread_cache
+  {
+  public:
+
+    static ETL_CONSTANT size_t MAGAZINE_SIZE = VMagazine_Size;
+
+    ETL_STATIC_ASSERT(VMagazine_Size > 0U, "Zero sized magazine");
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_thread_cache(etl::ipool_depot& depot_)
+      : etl::ipool_thread_cache(depot_, magazine, VMagazine_Size)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor
+    //*************************************************************************
+    ~pool_thread_cache()
+    {
+      this->flush();
+    }
+
+  private:
+
+    char* magazine[VMagazine_Size];
+  };
+
+  template <size_t VMagazine_Size>
+  ETL_CONSTANT size_t pool_thread_cache<VMagazine_Size>::MAGAZINE_SIZE;
+}
+
+#endif
+#endif
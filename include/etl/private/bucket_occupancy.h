@@ -0,0 +1,272 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BUCKET_OCCUPANCY_INCLUDED
+#define ETL_BUCKET_OCCUPANCY_INCLUDED
+
+#include "../platform.h"
+#include "../bit.h"
+#include "../integral_limits.h"
+#include "../nullptr.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+// The bucket occupancy bitmap for the chained unordered containers.
+// There is one bit per bucket, set while the bucket holds any nodes.
+// Iteration, clear and the first/last bucket markers step from one occupied
+// bucket to the next a word of buckets at a time, so a sparsely filled
+// container does not test every empty bucket in turn.
+// A well filled container is quicker to step through one bucket at a time,
+// so next() looks at a few buckets in turn before it goes to the bitmap, and
+// clear() steps through every bucket when the container is dense.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_unordered
+  {
+    typedef uint32_t occupancy_word_t;
+
+    //*************************************************************************
+    /// The number of occupancy words needed for a number of buckets.
+    //*************************************************************************
+    template <size_t Buckets>
+    struct bucket_occupancy_size
+    {
+      static ETL_CONSTANT size_t value = (Buckets + etl::integral_limits<occupancy_word_t>::bits - 1U) / etl::integral_limits<occupancy_word_t>::bits;
+    };
+
+    template <size_t Buckets>
+    ETL_CONSTANT size_t bucket_occupancy_size<Buckets>::value;
+
+    //*************************************************************************
+    /// The occupancy bitmap for an array of buckets.
+    /// The words are supplied by the derived container.
+    //*************************************************************************
+    template <typename TBucket>
+    class bucket_occupancy
+    {
+    public:
+
+      //*******************************
+      bucket_occupancy(TBucket* pbuckets_, size_t number_of_buckets_, occupancy_word_t* pwords_)
+        : pbuckets(pbuckets_)
+        , number_of_buckets(number_of_buckets_)
+        , number_of_words((number_of_buckets_ + Bits_Per_Word - 1U) / Bits_Per_Word)
+        , pwords(pwords_)
+        , number_occupied(0U)
+      {
+        reset_all();
+      }
+
+      //*******************************
+      /// Marks the bucket as occupied.
+      //*******************************
+      void set(const TBucket* pbucket)
+      {
+        const size_t           position = size_t(pbucket - pbuckets);
+        const occupancy_word_t bit      = occupancy_word_t(occupancy_word_t(1U) << (position % Bits_Per_Word));
+        occupancy_word_t&      word     = pwords[position / Bits_Per_Word];
+
+        if ((word & bit) == 0U)
+        {
+          word |= bit;
+          ++number_occupied;
+        }
+      }
+
+      //*******************************
+      /// Marks the bucket as empty.
+      //*******************************
+      void reset(const TBucket* pbucket)
+      {
+        const size_t           position = size_t(pbucket - pbuckets);
+        const occupancy_word_t bit      = occupancy_word_t(occupancy_word_t(1U) << (position % Bits_Per_Word));
+        occupancy_word_t&      word     = pwords[position / Bits_Per_Word];
+
+        if ((word & bit) != 0U)
+        {
+          word &= occupancy_word_t(~bit);
+          --number_occupied;
+        }
+      }
+
+      //*******************************
+      /// Marks all of the buckets as empty.
+      //*******************************
+      void reset_all()
+      {
+        for (size_t i = 0UL; i < number_of_words; ++i)
+        {
+          pwords[i] = 0U;
+        }
+
+        number_occupied = 0U;
+      }
+
+      //*******************************
+      /// The number of occupied buckets.
+      //*******************************
+      size_t occupied() const
+      {
+        return number_occupied;
+      }
+
+      //*******************************
+      /// True if enough buckets are occupied that stepping through every
+      /// bucket is quicker than scanning the bitmap.
+      //*******************************
+      bool is_dense() const
+      {
+        return (number_occupied * Dense_Ratio) >= number_of_buckets;
+      }
+
+      //*******************************
+      /// One past the last bucket.
+      //*******************************
+      TBucket* end() const
+      {
+        return pbuckets + number_of_buckets;
+      }
+
+      //*******************************
+      /// The first occupied bucket, or end() if there are none.
+      //*******************************
+      TBucket* first() const
+      {
+        return find_from(0U);
+      }
+
+      //*******************************
+      /// The first occupied bucket after pbucket, or end() if there are none.
+      //*******************************
+      TBucket* next(const TBucket* pbucket) const
+      {
+        TBucket* pnext = pbuckets + size_t(pbucket - pbuckets) + 1U;
+
+        // In a well filled container the next occupied bucket is usually
+        // close, so look at a few in turn before going to the bitmap.
+        TBucket* plinear_end = (size_t(end() - pnext) > Linear_Steps) ? pnext + Linear_Steps : end();
+
+        while (pnext != plinear_end)
+        {
+          if (!pnext->empty())
+          {
+            return pnext;
+          }
+
+          ++pnext;
+        }
+
+        return find_from(size_t(pnext - pbuckets));
+      }
+
+      //*******************************
+      /// The last occupied bucket before pbucket, or ETL_NULLPTR if there are none.
+      //*******************************
+      TBucket* previous(const TBucket* pbucket) const
+      {
+        const size_t position = size_t(pbucket - pbuckets);
+
+        size_t index = position / Bits_Per_Word;
+
+        // Only the bits below the position.
+        occupancy_word_t word = occupancy_word_t(pwords[index] & ((occupancy_word_t(1U) << (position % Bits_Per_Word)) - 1U));
+
+        while (word == 0U)
+        {
+          if (index == 0U)
+          {
+            return ETL_NULLPTR;
+          }
+
+          word = pwords[--index];
+        }
+
+        return pbuckets + (index * Bits_Per_Word) + (Bits_Per_Word - 1U - size_t(etl::countl_zero(word)));
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t Bits_Per_Word = etl::integral_limits<occupancy_word_t>::bits;
+      static ETL_CONSTANT size_t Linear_Steps  = 16U; ///< The buckets that next() looks at in turn before scanning the bitmap.
+      static ETL_CONSTANT size_t Dense_Ratio   = 4U; ///< At least one bucket in this many occupied is dense.
+
+      //*******************************
+      TBucket* find_from(size_t position) const
+      {
+        size_t index = position / Bits_Per_Word;
+
+        if (index < number_of_words)
+        {
+          // Only the bits from the position onwards.
+          occupancy_word_t word = occupancy_word_t(pwords[index] & (occupancy_word_t(~occupancy_word_t(0U)) << (position % Bits_Per_Word)));
+
+          while (word == 0U)
+          {
+            if (++index == number_of_words)
+            {
+              return end();
+            }
+
+            word = pwords[index];
+          }
+
+          return pbuckets + (index * Bits_Per_Word) + size_t(etl::countr_zero(word));
+        }
+
+        return end();
+      }
+
+      // Disable copy construction and assignment.
+      bucket_occupancy(const bucket_occupancy&);
+      bucket_occupancy& operator =(const bucket_occupancy&);
+
+      TBucket* const          pbuckets;
+      const size_t            number_of_buckets;
+      const size_t            number_of_words;
+      occupancy_word_t* const pwords;
+      size_t                  number_occupied;
+    };
+
+    template <typename TBucket>
+    ETL_CONSTANT size_t bucket_occupancy<TBucket>::Bits_Per_Word;
+
+    template <typename TBucket>
+    ETL_CONSTANT size_t bucket_occupancy<TBucket>::Linear_Steps;
+
+    template <typename TBucket>
+    ETL_CONSTANT size_t bucket_occupancy<TBucket>::Dense_Ratio;
+  }
+}
+
+#endif
@@ -0,0 +1,276 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_CRC_CLMUL_INCLUDED
+#define ETL_CRC_CLMUL_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+
+#include "stdint.h"
+
+#include "crc_parameters.h"
+
+//*****************************************************************************
+// Carry-less multiply folding backend for the CRC types.
+// Enabled by defining ETL_CRC_USE_CLMUL for x86-64 targets.
+// Long contiguous ranges are folded 64 bytes at a time with PCLMULQDQ into a
+// 16 byte block with the same CRC, which is then finished by the table engine.
+// The fold constants are x^N mod P, derived at compile time from the polynomial.
+//*****************************************************************************
+
+#if ETL_HAS_CRC_CLMUL
+
+#if defined(ETL_COMPILER_MICROSOFT)
+  #include <intrin.h>
+#endif
+
+#include <immintrin.h>
+
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_CRC_CLMUL_TARGET __attribute__((target("pclmul,ssse3,sse4.1")))
+#else
+  #define ETL_CRC_CLMUL_TARGET
+#endif
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*****************************************************************************
+    /// Multiplies a value by x, modulo the polynomial, in non-reflected form.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, TAccumulator Value>
+    struct crc_x_mul_mod
+    {
+      static ETL_CONSTANT TAccumulator value = ((Value & (TAccumulator(1U) << (Accumulator_Bits - 1U))) != 0U) ? TAccumulator(TAccumulator(Value << 1U) ^ Polynomial)
+                                                                                                             : TAccumulator(Value << 1U);
+    };
+
+    //*****************************************************************************
+    /// x^Power mod Polynomial, in non-reflected form.
+    /// Calculated 8 bits at a time to limit the template recursion depth.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power, bool Is_Small = (Power < Accumulator_Bits)>
+    struct crc_x_pow_mod;
+
+    //*********************************
+    // x^Power has a lower degree than the polynomial.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power>
+    struct crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Power, true>
+    {
+      static ETL_CONSTANT TAccumulator value = TAccumulator(TAccumulator(1U) << Power);
+    };
+
+    //*********************************
+    // x^Power = x^(Power - 8) * x^8
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power>
+    struct crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Power, false>
+    {
+      static ETL_CONSTANT TAccumulator value = crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_mul_mod<TAccumulator, Accumulator_Bits, Polynomial,
+                                               crc_x_pow_mod<TAccumulator, Accumulator_Bits, Polynomial, Power - 8U>::value>::value>::value>::value>::value>::value>::value>::value>::value;
+    };
+
+    //*****************************************************************************
+    /// The constant to fold a 64 bit half of the accumulator by Distance bits.
+    /// Reflected constants are bit reversed and use x^(N-1), as the carry-less
+    /// product of two bit reversed values is one bit short of its reversed width.
+    //*****************************************************************************
+    template <typename TCrcParameters, size_t Distance>
+    struct crc_clmul_fold_constant
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT uint64_t Normal    = uint64_t(crc_x_pow_mod<accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, Distance>::value);
+      static ETL_CONSTANT uint64_t Reflected = etl::reverse_bits_const<uint64_t, uint64_t(crc_x_pow_mod<accumulator_type, TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, Distance - 1U>::value)>::value;
+
+      static ETL_CONSTANT uint64_t value = TCrcParameters::Reflect ? Reflected : Normal;
+    };
+
+    //*****************************************************************************
+    /// Checks once whether the CPU supports the instructions used by the backend.
+    //*****************************************************************************
+    inline bool crc_clmul_detect()
+    {
+#if defined(ETL_COMPILER_MICROSOFT)
+      int info[4];
+      __cpuid(info, 1);
+
+      const int ecx = info[2];
+
+      return ((ecx & (1 << 1)) != 0) &&  // PCLMULQDQ
+             ((ecx & (1 << 9)) != 0) &&  // SSSE3
+             ((ecx & (1 << 19)) != 0);   // SSE4.1
+#else
+      __builtin_cpu_init();
+
+      return __builtin_cpu_supports("pclmul") && 
+             __builtin_cpu_supports("ssse3")  && 
+             __builtin_cpu_supports("sse4.1");
+#endif
+    }
+
+    //*****************************************************************************
+    inline bool crc_clmul_is_supported()
+    {
+      static const bool supported = crc_clmul_detect();
+
+      return supported;
+    }
+
+    //*****************************************************************************
+    /// Loads 16 bytes in the bit order of the CRC.
+    //*****************************************************************************
+    template <bool Reflect>
+    ETL_CRC_CLMUL_TARGET
+    inline __m128i crc_clmul_load(const uint8_t* p_data)
+    {
+      __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_data));
+
+      if (!Reflect)
+      {
+        value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+      }
+
+      return value;
+    }
+
+    //*****************************************************************************
+    /// Stores 16 bytes in the bit order of the CRC.
+    //*****************************************************************************
+    template <bool Reflect>
+    ETL_CRC_CLMUL_TARGET
+    inline void crc_clmul_store(uint8_t* p_data, __m128i value)
+    {
+      if (!Reflect)
+      {
+        value = _mm_shuffle_epi8(value, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+      }
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(p_data), value);
+    }
+
+    //*****************************************************************************
+    /// Multiplies each 64 bit half by its fold constant.
+    //*****************************************************************************
+    ETL_CRC_CLMUL_TARGET
+    inline __m128i crc_clmul_fold(__m128i value, __m128i constants)
+    {
+      return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00), 
+                           _mm_clmulepi64_si128(value, constants, 0x11));
+    }
+
+    //*****************************************************************************
+    /// Folds the contiguous range into a 16 byte block, to be processed by the
+    /// table engine with an initial accumulator of zero, that gives the same CRC.
+    /// Requires at least 64 bytes.
+    /// Returns the number of bytes consumed, a multiple of 16.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_clmul
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Minimum_Length = 64U;
+
+      ETL_CRC_CLMUL_TARGET
+      static size_t fold(accumulator_type crc, const uint8_t* p_data, size_t length, uint8_t* p_remainder)
+      {
+        static ETL_CONSTANT bool   Reflect          = TCrcParameters::Reflect;
+        static ETL_CONSTANT size_t Accumulator_Bits = TCrcParameters::Accumulator_Bits;
+
+        // The higher half of the value, in polynomial terms, is the low 64 bits when reflected.
+        const __m128i fold_512 = Reflect ? _mm_set_epi64x(int64_t(crc_clmul_fold_constant<TCrcParameters, 512U>::value), 
+                                                          int64_t(crc_clmul_fold_constant<TCrcParameters, 576U>::value))
+                                         : _mm_set_epi64x(int64_t(crc_clmul_fold_constant<TCrcParameters, 576U>::value), 
+                                                          int64_t(crc_clmul_fold_constant<TCrcParameters, 512U>::value));
+
+        const __m128i fold_128 = Reflect ? _mm_set_epi64x(int64_t(crc_clmul_fold_constant<TCrcParameters, 128U>::value), 
+                                                          int64_t(crc_clmul_fold_constant<TCrcParameters, 192U>::value))
+                                         : _mm_set_epi64x(int64_t(crc_clmul_fold_constant<TCrcParameters, 192U>::value), 
+                                                          int64_t(crc_clmul_fold_constant<TCrcParameters, 128U>::value));
+
+        const uint8_t* const p_begin = p_data;
+
+        __m128i x0 = crc_clmul_load<Reflect>(p_data);
+        __m128i x1 = crc_clmul_load<Reflect>(p_data + 16U);
+        __m128i x2 = crc_clmul_load<Reflect>(p_data + 32U);
+        __m128i x3 = crc_clmul_load<Reflect>(p_data + 48U);
+        p_data += 64U;
+        length -= 64U;
+
+        // Merge the current accumulator with the leading bits of the data.
+        const uint64_t initial = uint64_t(crc);
+
+        x0 = _mm_xor_si128(x0, Reflect ? _mm_set_epi64x(0, int64_t(initial)) 
+                                       : _mm_set_epi64x(int64_t(initial << (64U - Accumulator_Bits)), 0));
+
+        while (length >= 64U)
+        {
+          x0 = _mm_xor_si128(crc_clmul_fold(x0, fold_512), crc_clmul_load<Reflect>(p_data));
+          x1 = _mm_xor_si128(crc_clmul_fold(x1, fold_512), crc_clmul_load<Reflect>(p_data + 16U));
+          x2 = _mm_xor_si128(crc_clmul_fold(x2, fold_512), crc_clmul_load<Reflect>(p_data + 32U));
+          x3 = _mm_xor_si128(crc_clmul_fold(x3, fold_512), crc_clmul_load<Reflect>(p_data + 48U));
+          p_data += 64U;
+          length -= 64U;
+        }
+
+        __m128i x = x0;
+        x = _mm_xor_si128(crc_clmul_fold(x, fold_128), x1);
+        x = _mm_xor_si128(crc_clmul_fold(x, fold_128), x2);
+        x = _mm_xor_si128(crc_clmul_fold(x, fold_128), x3);
+
+        while (length >= 16U)
+        {
+          x = _mm_xor_si128(crc_clmul_fold(x, fold_128), crc_clmul_load<Reflect>(p_data));
+          p_data += 16U;
+          length -= 16U;
+        }
+
+        crc_clmul_store<Reflect>(p_remainder, x);
+
+        return size_t(p_data - p_begin);
+      }
+    };
+  }
+}
+
+#undef ETL_CRC_CLMUL_TARGET
+
+#endif
+#endif
@@ -36,10 +36,12 @@ SOFTWARE.
 #include "../static_assert.h"
 #include "../binary.h"
 #include "../type_traits.h"
+#include "../iterator.h"
 
 #include "stdint.h"
 
 #include "crc_parameters.h"
+#include "crc_clmul.h"
 
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
@@ -125,6 +127,36 @@ namespace etl
                                                crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Entry>::value>::value>::value>::value>::value>::value>::value>::value;
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// Slice 0 is the standard 8 bit table.
+    /// Slice N is the CRC of the byte 'Index' followed by N zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slice, size_t Index>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slice - 1U, Index>::value;
+      static ETL_CONSTANT size_t       Chunk    = Reflect ? size_t(Previous & 0xFFU) 
+                                                          : size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = Reflect ? TAccumulator(TAccumulator(Previous >> 8U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Chunk, 8U>::value)
+                                                       : TAccumulator(TAccumulator(Previous << 8U) ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Chunk, 8U>::value);
+    };
+
+    //*********************************
+    // Slice 0.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 0U, Index>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
     //*****************************************************************************
     /// CRC Update Chunk
     //*****************************************************************************
@@ -557,12 +589,259 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    // CRC Slicing Tables.
+    // 'Slices' tables of 256 entries, allowing 'Slices' bytes to be processed per step.
+    //*****************************************************************************
+#define ETL_CRC_SLICE_ENTRY(S, I)       crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, S, I>::value
+#define ETL_CRC_SLICE_ENTRIES_4(S, I)   ETL_CRC_SLICE_ENTRY(S, (I)), ETL_CRC_SLICE_ENTRY(S, (I) + 1U), ETL_CRC_SLICE_ENTRY(S, (I) + 2U), ETL_CRC_SLICE_ENTRY(S, (I) + 3U)
+#define ETL_CRC_SLICE_ENTRIES_16(S, I)  ETL_CRC_SLICE_ENTRIES_4(S, (I)), ETL_CRC_SLICE_ENTRIES_4(S, (I) + 4U), ETL_CRC_SLICE_ENTRIES_4(S, (I) + 8U), ETL_CRC_SLICE_ENTRIES_4(S, (I) + 12U)
+#define ETL_CRC_SLICE_ENTRIES_64(S, I)  ETL_CRC_SLICE_ENTRIES_16(S, (I)), ETL_CRC_SLICE_ENTRIES_16(S, (I) + 16U), ETL_CRC_SLICE_ENTRIES_16(S, (I) + 32U), ETL_CRC_SLICE_ENTRIES_16(S, (I) + 48U)
+#define ETL_CRC_SLICE_TABLE(S)          { ETL_CRC_SLICE_ENTRIES_64(S, 0U), ETL_CRC_SLICE_ENTRIES_64(S, 64U), ETL_CRC_SLICE_ENTRIES_64(S, 128U), ETL_CRC_SLICE_ENTRIES_64(S, 192U) }
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table;
+
+    //*********************************
+    // Common slicing algorithm.
+    template <typename TAccumulator, size_t Accumulator_Bits, bool Reflect, size_t Slices>
+    static
+    TAccumulator crc_update_slices(TAccumulator crc, const uint8_t* p_data, size_t length, const TAccumulator table[][256U])
+    {
+      ETL_STATIC_ASSERT((Slices * 8U) >= Accumulator_Bits, "Too few slices for the accumulator width");
+
+      static ETL_CONSTANT size_t Accumulator_Bytes = Accumulator_Bits / 8U;
+
+      while (length >= Slices)
+      {
+        TAccumulator result = 0U;
+
+        for (size_t i = 0U; i < Slices; ++i)
+        {
+          uint8_t index = p_data[i];
+
+          if (i < Accumulator_Bytes)
+          {
+            index ^= Reflect ? uint8_t(crc >> (8U * i)) 
+                             : uint8_t(crc >> (Accumulator_Bits - (8U * (i + 1U))));
+          }
+
+          result ^= table[Slices - 1U - i][index];
+        }
+
+        crc     = result;
+        p_data += Slices;
+        length -= Slices;
+      }
+
+      while (length != 0U)
+      {
+        crc = crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, *p_data, table[0]);
+        ++p_data;
+        --length;
+      }
+
+      return crc;
+    }
+
+    //*********************************
+    // Slicing by 8.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return add(crc, &value, 1U);
+      }
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, const uint8_t* p_data, size_t length) const
+      {
+        static ETL_CONSTANT TAccumulator table[8U][256U] =
+        {
+          ETL_CRC_SLICE_TABLE(0U), ETL_CRC_SLICE_TABLE(1U), ETL_CRC_SLICE_TABLE(2U), ETL_CRC_SLICE_TABLE(3U),
+          ETL_CRC_SLICE_TABLE(4U), ETL_CRC_SLICE_TABLE(5U), ETL_CRC_SLICE_TABLE(6U), ETL_CRC_SLICE_TABLE(7U)
+        };
+
+        return crc_update_slices<TAccumulator, Accumulator_Bits, Reflect, 8U>(crc, p_data, length, table);
+      }
+    };
+
+    //*********************************
+    // Slicing by 16.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
+    {
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return add(crc, &value, 1U);
+      }
+
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, const uint8_t* p_data, size_t length) const
+      {
+        static ETL_CONSTANT TAccumulator table[16U][256U] =
+        {
+          ETL_CRC_SLICE_TABLE(0U),  ETL_CRC_SLICE_TABLE(1U),  ETL_CRC_SLICE_TABLE(2U),  ETL_CRC_SLICE_TABLE(3U),
+          ETL_CRC_SLICE_TABLE(4U),  ETL_CRC_SLICE_TABLE(5U),  ETL_CRC_SLICE_TABLE(6U),  ETL_CRC_SLICE_TABLE(7U),
+          ETL_CRC_SLICE_TABLE(8U),  ETL_CRC_SLICE_TABLE(9U),  ETL_CRC_SLICE_TABLE(10U), ETL_CRC_SLICE_TABLE(11U),
+          ETL_CRC_SLICE_TABLE(12U), ETL_CRC_SLICE_TABLE(13U), ETL_CRC_SLICE_TABLE(14U), ETL_CRC_SLICE_TABLE(15U)
+        };
+
+        return crc_update_slices<TAccumulator, Accumulator_Bits, Reflect, 16U>(crc, p_data, length, table);
+      }
+    };
+
+#undef ETL_CRC_SLICE_ENTRY
+#undef ETL_CRC_SLICE_ENTRIES_4
+#undef ETL_CRC_SLICE_ENTRIES_16
+#undef ETL_CRC_SLICE_ENTRIES_64
+#undef ETL_CRC_SLICE_TABLE
+
+    //*****************************************************************************
+    // CRC Combination.
+    // Polynomial arithmetic modulo the CRC polynomial, in non-reflected form.
+    //*****************************************************************************
+
+    //*********************************
+    /// Multiplies a value by x, modulo the polynomial.
+    template <typename TCrcParameters>
+    typename TCrcParameters::accumulator_type crc_multiply_x(typename TCrcParameters::accumulator_type value)
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT accumulator_type Top_Bit = accumulator_type(accumulator_type(1U) << (TCrcParameters::Accumulator_Bits - 1U));
+
+      return ((value & Top_Bit) != 0U) ? accumulator_type(accumulator_type(value << 1U) ^ TCrcParameters::Polynomial)
+                                       : accumulator_type(value << 1U);
+    }
+
+    //*********************************
+    /// Multiplies two values, modulo the polynomial.
+    template <typename TCrcParameters>
+    typename TCrcParameters::accumulator_type crc_multiply(typename TCrcParameters::accumulator_type a, typename TCrcParameters::accumulator_type b)
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT accumulator_type Top_Bit = accumulator_type(accumulator_type(1U) << (TCrcParameters::Accumulator_Bits - 1U));
+
+      accumulator_type result = 0U;
+
+      for (size_t i = 0U; i < TCrcParameters::Accumulator_Bits; ++i)
+      {
+        result = crc_multiply_x<TCrcParameters>(result);
+
+        if ((a & Top_Bit) != 0U)
+        {
+          result ^= b;
+        }
+
+        a = accumulator_type(a << 1U);
+      }
+
+      return result;
+    }
+
+    //*********************************
+    /// Advances an accumulator over 'length' zero bytes, in O(log(length)).
+    template <typename TCrcParameters>
+    typename TCrcParameters::accumulator_type crc_shift(typename TCrcParameters::accumulator_type crc, size_t length)
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      // x^8 mod P
+      accumulator_type x_pow = 1U;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        x_pow = crc_multiply_x<TCrcParameters>(x_pow);
+      }
+
+      if (TCrcParameters::Reflect)
+      {
+        crc = etl::reverse_bits(crc);
+      }
+
+      // Multiply by x^(8 * length) mod P, by squaring.
+      while (length != 0U)
+      {
+        if ((length & 1U) != 0U)
+        {
+          crc = crc_multiply<TCrcParameters>(crc, x_pow);
+        }
+
+        x_pow   = crc_multiply<TCrcParameters>(x_pow, x_pow);
+        length >>= 1U;
+      }
+
+      if (TCrcParameters::Reflect)
+      {
+        crc = etl::reverse_bits(crc);
+      }
+
+      return crc;
+    }
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
     template <typename TCrcParameters, size_t Table_Size>
     struct crc_policy;
 
+    //*********************************
+    // Policy for slicing by 16 (16 x 256 entry tables).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_table<typename TCrcParameters::accumulator_type, 
+                                                                      TCrcParameters::Accumulator_Bits, 
+                                                                      TCrcParameters::Polynomial, 
+                                                                      TCrcParameters::Reflect, 
+                                                                      16U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slicing by 8 (8 x 256 entry tables).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_table<typename TCrcParameters::accumulator_type, 
+                                                                      TCrcParameters::Accumulator_Bits, 
+                                                                      TCrcParameters::Polynomial, 
+                                                                      TCrcParameters::Reflect, 
+                                                                      8U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
     //*********************************
     // Policy for 256 entry table.
     template <typename TCrcParameters>
@@ -650,13 +929,22 @@ namespace etl
 
   //*****************************************************************************
   /// Basic parameterised CRC type.
+  /// Table sizes of 2048 and 4096 select the 'slicing by 8' and 'slicing by 16'
+  /// algorithms, which process 8 or 16 bytes per step from contiguous buffers.
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
   class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
   {
+  private:
+
+    typedef etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> > base_t;
+
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), 
+                      "Table size must be 4, 16, 256, 2048 or 4096");
+
+    using base_t::add;
 
     //*************************************************************************
     /// Default constructor.
@@ -677,6 +965,103 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks.
+    /// \param crc_a    The CRC of the first block.
+    /// \param crc_b    The CRC of the second block.
+    /// \param length_b The length of the second block, in bytes.
+    /// \return The CRC of the first block followed by the second.
+    //*************************************************************************
+    static typename base_t::value_type combine(typename base_t::value_type crc_a, typename base_t::value_type crc_b, size_t length_b)
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      // Remove the final XOR from 'a' and the initial value that 'b' was started with.
+      const accumulator_type difference = accumulator_type(crc_a ^ TCrcParameters::Xor_Out ^ private_crc::crc_policy<TCrcParameters, Table_Size>().initial());
+
+      return crc_b ^ private_crc::crc_shift<TCrcParameters>(difference, length_b);
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// Contiguous byte ranges use the multi-byte path of the slicing tables
+    /// and, if enabled, the carry-less multiply folding backend.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      ETL_STATIC_ASSERT(sizeof(value_type) == 1, "Type not supported");
+
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value> is_contiguous_t;
+
+      add_range(begin, end, is_contiguous_t());
+    }
+
+  private:
+
+    typedef etl::integral_constant<bool, (Table_Size > 256U)> use_slices_t;
+
+    //*************************************************************************
+    /// Adds a contiguous range.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      const uint8_t* p_data = reinterpret_cast<const uint8_t*>(begin);
+      size_t         length = static_cast<size_t>(end - begin);
+
+#if ETL_HAS_CRC_CLMUL
+      if ((length >= private_crc::crc_clmul<TCrcParameters>::Minimum_Length) && private_crc::crc_clmul_is_supported())
+      {
+        uint8_t remainder[16U];
+
+        const size_t folded = private_crc::crc_clmul<TCrcParameters>::fold(this->frame_check, p_data, length, remainder);
+
+        this->frame_check = 0U;
+        add_block(remainder, 16U, use_slices_t());
+
+        p_data += folded;
+        length -= folded;
+      }
+#endif
+
+      add_block(p_data, length, use_slices_t());
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      base_t::add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Adds a block using the slicing tables.
+    //*************************************************************************
+    void add_block(const uint8_t* p_data, size_t length, etl::true_type)
+    {
+      this->frame_check = this->policy.add(this->frame_check, p_data, length);
+    }
+
+    //*************************************************************************
+    /// Adds a block, one byte at a time.
+    //*************************************************************************
+    void add_block(const uint8_t* p_data, size_t length, etl::false_type)
+    {
+      while (length != 0U)
+      {
+        this->frame_check = this->policy.add(this->frame_check, *p_data);
+        ++p_data;
+        --length;
+      }
+    }
   };
 }
 
@@ -0,0 +1,285 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_SPSC_ATOMIC_WAIT_INCLUDED
+#define ETL_PRIVATE_SPSC_ATOMIC_WAIT_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+
+#if defined(__linux__)
+  #define ETL_SPSC_ATOMIC_WAIT_FUTEX
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  #include <time.h>
+#elif ETL_USING_STL && ETL_USING_CPP20 && ETL_HAS_ATOMIC
+  #include <atomic>
+  #include <chrono>
+  #include <thread>
+  #if defined(__cpp_lib_atomic_wait)
+    #define ETL_SPSC_ATOMIC_WAIT_STD
+  #endif
+#endif
+
+#if !defined(ETL_SPSC_ATOMIC_WAIT_FUTEX) && !defined(ETL_SPSC_ATOMIC_WAIT_STD)
+  #error ETL_SPSC_ATOMIC_USE_WAIT requires Linux or C++20 std::atomic::wait
+#endif
+
+#if !defined(ETL_SPSC_ATOMIC_WAIT_SPIN_LIMIT)
+  #define ETL_SPSC_ATOMIC_WAIT_SPIN_LIMIT 4096
+#endif
+
+namespace etl
+{
+  namespace private_spsc_atomic_wait
+  {
+    //*************************************************************************
+    /// Lets one thread sleep until another has made progress.
+    /// The waiting side spins first, re-trying its operation, for an adaptive
+    /// number of tries. The limit doubles each time a spin succeeds and halves
+    /// each time the thread has to sleep, so a busy queue stays in the spin
+    /// phase and a quiet one goes straight to sleep.
+    /// The notifying side only makes a system call if the other side is asleep.
+    //*************************************************************************
+    class waiter
+    {
+    public:
+
+      static ETL_CONSTANT uint32_t Max_Spin_Limit = ETL_SPSC_ATOMIC_WAIT_SPIN_LIMIT;
+      static ETL_CONSTANT uint32_t Min_Spin_Limit = 16U;
+      static ETL_CONSTANT uint32_t Forever        = 0xFFFFFFFFUL;
+
+      //*******************************
+      waiter()
+        : epoch(0U)
+        , sleepers(0U)
+        , spin_limit(Max_Spin_Limit)
+      {
+      }
+
+      //*******************************
+      /// Wakes the other side if it is asleep.
+      /// Call after publishing progress.
+      //*******************************
+      void notify()
+      {
+        // A read-modify-write, so that it is ordered with the sleeper's
+        // registration in prepare_sleep. Either the sleeper sees the
+        // progress, or this sees the sleeper.
+        if (sleepers.fetch_add(0U, etl::memory_order_acq_rel) != 0U)
+        {
+          epoch.fetch_add(1U, etl::memory_order_release);
+          wake_all();
+        }
+      }
+
+      //*******************************
+      /// Calls operation() until it returns true or 'timeout_us' microseconds
+      /// have passed. Returns the last result of operation().
+      /// A timeout of zero tries once. A timeout of Forever never times out.
+      /// Must only be called from the waiting side.
+      //*******************************
+      template <typename TOperation>
+      bool wait(TOperation& operation, uint32_t timeout_us)
+      {
+        if (timeout_us == 0U)
+        {
+          return operation();
+        }
+
+        // Spin.
+        const uint32_t limit = spin_limit;
+
+        for (uint32_t i = 0U; i < limit; ++i)
+        {
+          if (operation())
+          {
+            spin_limit = (spin_limit >= (Max_Spin_Limit / 2U)) ? Max_Spin_Limit : (spin_limit * 2U);
+            return true;
+          }
+
+          relax();
+        }
+
+        spin_limit = (spin_limit <= (Min_Spin_Limit * 2U)) ? Min_Spin_Limit : (spin_limit / 2U);
+
+        // Sleep.
+        const uint64_t start = (timeout_us == Forever) ? 0U : now_us();
+
+        while (true)
+        {
+          const uint32_t key = prepare_sleep();
+
+          // Re-try after registering, so that progress made before the other
+          // side could see the registration is not missed.
+          if (operation())
+          {
+            cancel_sleep();
+            return true;
+          }
+
+          uint32_t remaining = Forever;
+
+          if (timeout_us != Forever)
+          {
+            const uint64_t elapsed = now_us() - start;
+
+            if (elapsed >= timeout_us)
+            {
+              cancel_sleep();
+              return false;
+            }
+
+            remaining = uint32_t(timeout_us - elapsed);
+          }
+
+          sleep(key, remaining);
+        }
+      }
+
+      //*******************************
+      /// The number of times that wait re-tries before sleeping.
+      //*******************************
+      uint32_t get_spin_limit() const
+      {
+        return spin_limit;
+      }
+
+    private:
+
+      //*******************************
+      /// Registers as a sleeper and returns the key to pass to sleep.
+      //*******************************
+      uint32_t prepare_sleep()
+      {
+        sleepers.fetch_add(1U, etl::memory_order_acq_rel);
+
+        return epoch.load(etl::memory_order_acquire);
+      }
+
+      //*******************************
+      /// Unregisters without sleeping.
+      //*******************************
+      void cancel_sleep()
+      {
+        sleepers.fetch_sub(1U, etl::memory_order_release);
+      }
+
+      //*******************************
+      /// Sleeps until notified or for up to 'timeout_us' microseconds, then
+      /// unregisters. Returns immediately if notified since prepare_sleep.
+      /// May return early.
+      //*******************************
+      void sleep(uint32_t key, uint32_t timeout_us)
+      {
+        sleep_on(key, timeout_us);
+        sleepers.fetch_sub(1U, etl::memory_order_release);
+      }
+
+      //*******************************
+      /// A monotonic time in microseconds.
+      //*******************************
+      static uint64_t now_us()
+      {
+#if defined(ETL_SPSC_ATOMIC_WAIT_FUTEX)
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        return (uint64_t(now.tv_sec) * 1000000U) + (uint64_t(now.tv_nsec) / 1000U);
+#else
+        return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+      }
+
+      //*******************************
+      /// A hint to the processor that this is a spin loop.
+      //*******************************
+      static void relax()
+      {
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__aarch64__) || defined(__arm__))
+        __asm__ __volatile__("yield");
+#endif
+      }
+
+#if defined(ETL_SPSC_ATOMIC_WAIT_FUTEX)
+      //*******************************
+      void sleep_on(uint32_t key, uint32_t timeout_us)
+      {
+        struct timespec timeout;
+        timeout.tv_sec  = time_t(timeout_us / 1000000U);
+        timeout.tv_nsec = long((timeout_us % 1000000U) * 1000U);
+
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAIT_PRIVATE, key, (timeout_us == Forever) ? ETL_NULLPTR : &timeout, ETL_NULLPTR, 0);
+      }
+
+      //*******************************
+      void wake_all()
+      {
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&epoch), FUTEX_WAKE_PRIVATE, 0x7FFFFFFF, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+#else
+      //*******************************
+      /// std::atomic::wait cannot time out, so a timed sleep only yields.
+      //*******************************
+      void sleep_on(uint32_t key, uint32_t timeout_us)
+      {
+        if (timeout_us == Forever)
+        {
+          epoch.wait(key, std::memory_order_acquire);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      //*******************************
+      void wake_all()
+      {
+        epoch.notify_all();
+      }
+#endif
+
+      etl::atomic<uint32_t> epoch;      ///< Incremented by each notify that finds a sleeper.
+      etl::atomic<uint32_t> sleepers;   ///< The number of threads registered to sleep.
+      uint32_t              spin_limit; ///< Only used by the waiting side.
+    };
+  }
+}
+
+#endif
+#endif
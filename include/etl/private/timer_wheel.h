@@ -0,0 +1,356 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_TIMER_WHEEL_INCLUDED
+#define ETL_PRIVATE_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../timer.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// The wheel's view of a timer.
+    //*************************************************************************
+    struct node
+    {
+      uint32_t      expiry;
+      uint_least8_t previous;
+      uint_least8_t next;
+      uint_least8_t slot;
+    };
+
+    //*************************************************************************
+    /// A hierarchical timing wheel of timer ids.
+    /// Level 0 has a slot for each of the next 32 ticks. Each higher level has
+    /// 32 slots, each covering 32 times the span of a slot in the level below.
+    /// Seven levels cover the whole 32 bit range of delays.
+    /// A timer is held in the lowest level that can hold its delay and moves
+    /// down a level each time the wheel reaches its slot, so starting and
+    /// stopping a timer are O(1) and each timer moves at most six times.
+    ///
+    /// Timers that expire in the same tick are expired in the same order as
+    /// etl::callback_timer's sorted list; the most recently started first.
+    /// A newly started timer is added to the head of its slot. A timer is only
+    /// ever started at a lower level than an older timer with the same expiry,
+    /// so timers cascading down a level are added to the tail of their new slot,
+    /// the lowest level first.
+    //*************************************************************************
+    class wheel
+    {
+    public:
+
+      static ETL_CONSTANT uint_least8_t Slot_Bits = 5U;
+      static ETL_CONSTANT uint_least8_t Slots     = 1U << Slot_Bits;
+      static ETL_CONSTANT uint_least8_t Slot_Mask = Slots - 1U;
+      static ETL_CONSTANT uint_least8_t Levels    = 7U;
+      static ETL_CONSTANT uint_least8_t No_Slot   = 255U;
+
+      //*******************************
+      wheel(node* pnodes_, uint_least8_t max_timers_)
+        : pnodes(pnodes_)
+        , max_timers(max_timers_)
+      {
+        clear();
+      }
+
+      //*******************************
+      /// Removes all timers.
+      //*******************************
+      void clear()
+      {
+        for (uint_least8_t i = 0U; i < max_timers; ++i)
+        {
+          pnodes[i].expiry   = 0U;
+          pnodes[i].previous = etl::timer::id::NO_TIMER;
+          pnodes[i].next     = etl::timer::id::NO_TIMER;
+          pnodes[i].slot     = No_Slot;
+        }
+
+        for (uint_least8_t i = 0U; i < (Slots * Levels); ++i)
+        {
+          heads[i] = etl::timer::id::NO_TIMER;
+          tails[i] = etl::timer::id::NO_TIMER;
+        }
+
+        level0_occupied = 0U;
+        active          = 0U;
+        now             = 0U;
+      }
+
+      //*******************************
+      /// Returns true if the timer is in the wheel.
+      //*******************************
+      bool is_active(etl::timer::id::type id) const
+      {
+        return pnodes[id].slot != No_Slot;
+      }
+
+      //*******************************
+      /// Returns true if there are no timers in the wheel.
+      //*******************************
+      bool empty() const
+      {
+        return active == 0U;
+      }
+
+      //*******************************
+      /// Adds a timer that expires 'delay' ticks from now.
+      /// A delay of zero expires at the next call to tick.
+      //*******************************
+      void insert(etl::timer::id::type id, uint32_t delay)
+      {
+        pnodes[id].expiry = now + delay;
+        link(id, false);
+        ++active;
+      }
+
+      //*******************************
+      /// Removes a timer from the wheel.
+      //*******************************
+      void remove(etl::timer::id::type id)
+      {
+        unlink(id);
+        --active;
+      }
+
+      //*******************************
+      /// Advances the wheel by 'count' ticks.
+      /// Calls expired(id) for each timer as it expires, in order of expiry,
+      /// after the timer has been removed from the wheel. While expired(id) is
+      /// called the wheel's time is the timer's expiry time, so timers started
+      /// from it are timed from the expiry.
+      //*******************************
+      template <typename TExpired>
+      void tick(uint32_t count, TExpired& expired)
+      {
+        // Timers started with a zero delay since the last tick.
+        expire(expired);
+
+        while (count != 0U)
+        {
+          if (active == 0U)
+          {
+            now += count;
+            return;
+          }
+
+          // Skip to the next occupied level 0 slot, or the end of level 0.
+          const uint32_t index   = now & Slot_Mask;
+          const uint32_t pending = level0_occupied & ~((2UL << index) - 1UL);
+
+          uint32_t step = (pending == 0U) ? (Slots - index) : (lowest_bit(pending) - index);
+
+          if (step > count)
+          {
+            now += count;
+            return;
+          }
+
+          now   += step;
+          count -= step;
+
+          if ((now & Slot_Mask) == 0U)
+          {
+            cascade();
+          }
+
+          expire(expired);
+        }
+      }
+
+    private:
+
+      //*******************************
+      /// Calls expired(id) for each timer that expires now.
+      //*******************************
+      template <typename TExpired>
+      void expire(TExpired& expired)
+      {
+        const uint_least8_t slot = static_cast<uint_least8_t>(now & Slot_Mask);
+
+        // Expired timers may start others that expire now, so re-read the head.
+        while (heads[slot] != etl::timer::id::NO_TIMER)
+        {
+          etl::timer::id::type id = heads[slot];
+
+          remove(id);
+          expired(id);
+        }
+      }
+
+      //*******************************
+      /// Moves the timers in each higher level slot that has come due down to
+      /// the lower levels. Called when level 0 wraps.
+      //*******************************
+      void cascade()
+      {
+        // From the bottom up, as the timers in the lower levels were started more recently.
+        // A timer moves straight to the level for its remaining delay, which is never a slot being cascaded.
+        uint_least8_t level = 1U;
+
+        do
+        {
+          const uint_least8_t slot = static_cast<uint_least8_t>((level * Slots) + ((now >> (Slot_Bits * level)) & Slot_Mask));
+
+          // Keep the order of the timers in the slot.
+          while (heads[slot] != etl::timer::id::NO_TIMER)
+          {
+            etl::timer::id::type id = heads[slot];
+
+            unlink(id);
+            link(id, true);
+          }
+
+          // Stop at the first level that has not wrapped.
+        } while ((((now >> (Slot_Bits * level)) & Slot_Mask) == 0U) && (++level < Levels));
+      }
+
+      //*******************************
+      /// Adds the timer to the slot for its expiry.
+      /// At the tail if cascading, otherwise at the head.
+      //*******************************
+      void link(etl::timer::id::type id, bool at_tail)
+      {
+        node& timer = pnodes[id];
+
+        const uint32_t delay = timer.expiry - now;
+
+        uint_least8_t level = 0U;
+
+        while ((level < (Levels - 1U)) && (delay >= (1UL << (Slot_Bits * (level + 1U)))))
+        {
+          ++level;
+        }
+
+        const uint_least8_t slot = static_cast<uint_least8_t>((level * Slots) + ((timer.expiry >> (Slot_Bits * level)) & Slot_Mask));
+
+        timer.slot = slot;
+
+        if (heads[slot] == etl::timer::id::NO_TIMER)
+        {
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+          heads[slot]    = id;
+          tails[slot]    = id;
+        }
+        else if (at_tail)
+        {
+          timer.previous = tails[slot];
+          timer.next     = etl::timer::id::NO_TIMER;
+          pnodes[tails[slot]].next = id;
+          tails[slot]    = id;
+        }
+        else
+        {
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = heads[slot];
+          pnodes[heads[slot]].previous = id;
+          heads[slot]    = id;
+        }
+
+        if (slot < Slots)
+        {
+          level0_occupied |= (1UL << slot);
+        }
+      }
+
+      //*******************************
+      /// Removes the timer from its slot.
+      //*******************************
+      void unlink(etl::timer::id::type id)
+      {
+        node& timer = pnodes[id];
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          heads[timer.slot] = timer.next;
+
+          if ((timer.slot < Slots) && (timer.next == etl::timer::id::NO_TIMER))
+          {
+            level0_occupied &= ~(1UL << timer.slot);
+          }
+        }
+        else
+        {
+          pnodes[timer.previous].next = timer.next;
+        }
+
+        if (timer.next == etl::timer::id::NO_TIMER)
+        {
+          tails[timer.slot] = timer.previous;
+        }
+        else
+        {
+          pnodes[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.slot     = No_Slot;
+      }
+
+      //*******************************
+      /// The index of the lowest set bit. value must not be zero.
+      //*******************************
+      static uint32_t lowest_bit(uint32_t value)
+      {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+        return static_cast<uint32_t>(__builtin_ctz(value));
+#else
+        uint32_t index = 0U;
+
+        while ((value & 1U) == 0U)
+        {
+          value >>= 1U;
+          ++index;
+        }
+
+        return index;
+#endif
+      }
+
+      node* const         pnodes;
+      const uint_least8_t max_timers;
+
+      uint_least8_t heads[Slots * Levels];
+      uint_least8_t tails[Slots * Levels];
+      uint32_t      level0_occupied;
+      uint_least8_t active;
+      uint32_t      now;
+    };
+  }
+}
+
+#endif
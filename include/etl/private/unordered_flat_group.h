@@ -0,0 +1,598 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_GROUP_INCLUDED
+#define ETL_UNORDERED_FLAT_GROUP_INCLUDED
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../integral_limits.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+// Control bytes and group probing for the open addressing flat unordered
+// containers.
+// Every slot has a control byte that is either 'Empty', 'Deleted' or, for an
+// occupied slot, seven bits of the key's hash (H2).
+// Lookups test a whole group of control bytes at a time against H2, either
+// sixteen at a time with SSE2, or eight at a time with portable SWAR code.
+// The first Group_Width - 1 control bytes are cloned after the last so that a
+// group may be loaded from any slot position without wrapping.
+//*****************************************************************************
+
+#if ETL_HAS_UNORDERED_FLAT_SSE2
+  #include <emmintrin.h>
+#endif
+
+namespace etl
+{
+  namespace private_unordered_flat
+  {
+    typedef int8_t ctrl_t;
+
+    static ETL_CONSTANT ctrl_t Empty   = -128; // 0b10000000
+    static ETL_CONSTANT ctrl_t Deleted = -2;   // 0b11111110
+
+    //*************************************************************************
+    /// Returns true if the control byte marks an occupied slot.
+    //*************************************************************************
+    inline bool is_full(ctrl_t c)
+    {
+      return c >= 0;
+    }
+
+    //*************************************************************************
+    /// Bit scans for the masks.
+    /// Uses the compiler built-ins where available, as the portable versions
+    /// are too slow for the probe loop.
+    //*************************************************************************
+    template <typename TWord>
+    size_t lowest_bit(TWord value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return (sizeof(TWord) > sizeof(unsigned int)) ? static_cast<size_t>(__builtin_ctzll(value))
+                                                    : static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(value)));
+#else
+      return static_cast<size_t>(etl::count_trailing_zeros(value));
+#endif
+    }
+
+    template <typename TWord>
+    size_t leading_zero_bits(TWord value)
+    {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+      return (sizeof(TWord) > sizeof(unsigned int)) ? static_cast<size_t>(__builtin_clzll(value)) - ((sizeof(unsigned long long) - sizeof(TWord)) * 8U)
+                                                    : static_cast<size_t>(__builtin_clz(static_cast<unsigned int>(value))) - ((sizeof(unsigned int) - sizeof(TWord)) * 8U);
+#else
+      return static_cast<size_t>(etl::count_leading_zeros(value));
+#endif
+    }
+
+    //*************************************************************************
+    /// A mask with one flag per slot of a group.
+    /// Each flag occupies (1 << Shift) bits of the word.
+    //*************************************************************************
+    template <typename TWord, size_t Width, size_t Shift>
+    class bit_mask
+    {
+    public:
+
+      explicit bit_mask(TWord mask_)
+        : mask(mask_)
+      {
+      }
+
+      //*******************************
+      /// Returns true if any flag is set.
+      //*******************************
+      bool any() const
+      {
+        return mask != 0U;
+      }
+
+      //*******************************
+      /// The slot index of the lowest set flag.
+      /// The mask must not be empty.
+      //*******************************
+      size_t lowest() const
+      {
+        return lowest_bit(mask) >> Shift;
+      }
+
+      //*******************************
+      /// Clears the lowest set flag.
+      //*******************************
+      void clear_lowest()
+      {
+        mask &= TWord(mask - 1U);
+      }
+
+      //*******************************
+      /// The number of clear flags below the lowest set flag.
+      //*******************************
+      size_t trailing_empty() const
+      {
+        return (mask == 0U) ? Width : lowest();
+      }
+
+      //*******************************
+      /// The number of clear flags above the highest set flag.
+      //*******************************
+      size_t leading_empty() const
+      {
+        static ETL_CONSTANT size_t Unused_Bits = etl::integral_limits<TWord>::bits - (Width << Shift);
+
+        return (mask == 0U) ? Width : ((leading_zero_bits(mask) - Unused_Bits) >> Shift);
+      }
+
+      //*******************************
+      /// The raw mask.
+      //*******************************
+      TWord value() const
+      {
+        return mask;
+      }
+
+    private:
+
+      TWord mask;
+    };
+
+    //*************************************************************************
+    /// A group of control bytes tested a word at a time.
+    /// Each control byte is represented by its top bit in the result masks.
+    //*************************************************************************
+    template <typename TWord>
+    class group_portable
+    {
+    public:
+
+      static ETL_CONSTANT size_t Width = sizeof(TWord);
+
+      typedef etl::private_unordered_flat::bit_mask<TWord, Width, 3U> mask_type;
+
+      //*******************************
+      /// Loads Width control bytes, starting at pos.
+      /// The bytes are assembled little endian so that the lowest flag is the first slot.
+      //*******************************
+      explicit group_portable(const ctrl_t* pos)
+        : ctrl(0U)
+      {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+        memcpy(&ctrl, pos, Width);
+#else
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          ctrl |= TWord(static_cast<uint8_t>(pos[i])) << (i * 8U);
+        }
+#endif
+      }
+
+      //*******************************
+      /// The slots whose control byte equals h2.
+      /// May report a false positive in a slot following a true match.
+      //*******************************
+      mask_type match(ctrl_t h2) const
+      {
+        const TWord x = ctrl ^ TWord(Lsbs * static_cast<uint8_t>(h2));
+
+        return mask_type(TWord(TWord(x - Lsbs) & TWord(~x) & Msbs));
+      }
+
+      //*******************************
+      /// The empty slots.
+      //*******************************
+      mask_type match_empty() const
+      {
+        return mask_type(TWord(ctrl & TWord(TWord(~ctrl) << 6U) & Msbs));
+      }
+
+      //*******************************
+      /// The empty or deleted slots.
+      //*******************************
+      mask_type match_empty_or_deleted() const
+      {
+        return mask_type(TWord(ctrl & Msbs));
+      }
+
+      //*******************************
+      /// The occupied slots.
+      //*******************************
+      mask_type match_full() const
+      {
+        return mask_type(TWord(TWord(~ctrl) & Msbs));
+      }
+
+    private:
+
+      static ETL_CONSTANT TWord Lsbs = TWord(TWord(~TWord(0U)) / 0xFFU);
+      static ETL_CONSTANT TWord Msbs = TWord(Lsbs * 0x80U);
+
+      TWord ctrl;
+    };
+
+    template <typename TWord>
+    ETL_CONSTANT size_t group_portable<TWord>::Width;
+
+    template <typename TWord>
+    ETL_CONSTANT TWord group_portable<TWord>::Lsbs;
+
+    template <typename TWord>
+    ETL_CONSTANT TWord group_portable<TWord>::Msbs;
+
+#if ETL_HAS_UNORDERED_FLAT_SSE2
+    //*************************************************************************
+    /// A group of sixteen control bytes tested with SSE2.
+    //*************************************************************************
+    class group_sse2
+    {
+    public:
+
+      static ETL_CONSTANT size_t Width = 16U;
+
+      typedef etl::private_unordered_flat::bit_mask<uint32_t, Width, 0U> mask_type;
+
+      //*******************************
+      /// Loads Width control bytes, starting at pos.
+      //*******************************
+      explicit group_sse2(const ctrl_t* pos)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))
+      {
+      }
+
+      //*******************************
+      /// The slots whose control byte equals h2.
+      //*******************************
+      mask_type match(ctrl_t h2) const
+      {
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl))));
+      }
+
+      //*******************************
+      /// The empty slots.
+      //*******************************
+      mask_type match_empty() const
+      {
+        return match(Empty);
+      }
+
+      //*******************************
+      /// The empty or deleted slots.
+      /// These are the only control bytes with the top bit set.
+      //*******************************
+      mask_type match_empty_or_deleted() const
+      {
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(ctrl)));
+      }
+
+      //*******************************
+      /// The occupied slots.
+      //*******************************
+      mask_type match_full() const
+      {
+        return mask_type(static_cast<uint32_t>(_mm_movemask_epi8(ctrl)) ^ 0xFFFFU);
+      }
+
+    private:
+
+      __m128i ctrl;
+    };
+
+    typedef group_sse2 group;
+#elif ETL_USING_64BIT_TYPES
+    typedef group_portable<uint64_t> group;
+#else
+    typedef group_portable<uint32_t> group;
+#endif
+
+    //*************************************************************************
+    /// The smallest number of slots that holds MAX_SIZE elements at a maximum
+    /// load factor of 7/8. Always a power of two and at least 16.
+    //*************************************************************************
+    template <size_t MAX_SIZE, size_t Slots = 16U, bool Fits = ((Slots - (Slots / 8U)) >= MAX_SIZE)>
+    struct slot_count
+    {
+      static ETL_CONSTANT size_t value = etl::private_unordered_flat::slot_count<MAX_SIZE, Slots * 2U>::value;
+    };
+
+    template <size_t MAX_SIZE, size_t Slots>
+    struct slot_count<MAX_SIZE, Slots, true>
+    {
+      static ETL_CONSTANT size_t value = Slots;
+    };
+
+    template <size_t MAX_SIZE, size_t Slots, bool Fits>
+    ETL_CONSTANT size_t slot_count<MAX_SIZE, Slots, Fits>::value;
+
+    template <size_t MAX_SIZE, size_t Slots>
+    ETL_CONSTANT size_t slot_count<MAX_SIZE, Slots, true>::value;
+
+    //*************************************************************************
+    /// The run time equivalent of slot_count.
+    //*************************************************************************
+    inline size_t get_slot_count(size_t max_size)
+    {
+      size_t slots = 16U;
+
+      while ((slots - (slots / 8U)) < max_size)
+      {
+        slots *= 2U;
+      }
+
+      return slots;
+    }
+
+    //*************************************************************************
+    /// The maximum number of occupied and deleted slots.
+    //*************************************************************************
+    inline size_t get_max_load(size_t slots)
+    {
+      return slots - (slots / 8U);
+    }
+
+    //*************************************************************************
+    /// Mixes the user's hash so that both H1 and H2 are usable, even for an
+    /// identity hash of small integers.
+    //*************************************************************************
+    inline size_t mix(size_t hash, etl::integral_constant<bool, false> /*is_64_bit*/)
+    {
+      uint32_t h = static_cast<uint32_t>(hash);
+
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return static_cast<size_t>(h);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    inline size_t mix(size_t hash, etl::integral_constant<bool, true> /*is_64_bit*/)
+    {
+      uint64_t h = static_cast<uint64_t>(hash);
+
+      h ^= h >> 33U;
+      h *= 0xFF51AFD7ED558CCDULL;
+      h ^= h >> 33U;
+
+      return static_cast<size_t>(h);
+    }
+#endif
+
+    inline size_t mix(size_t hash)
+    {
+      return mix(hash, etl::integral_constant<bool, (sizeof(size_t) > sizeof(uint32_t))>());
+    }
+
+    //*************************************************************************
+    /// The slot position part of the mixed hash.
+    //*************************************************************************
+    inline size_t h1(size_t mixed)
+    {
+      return mixed >> 7U;
+    }
+
+    //*************************************************************************
+    /// The control byte part of the mixed hash.
+    //*************************************************************************
+    inline ctrl_t h2(size_t mixed)
+    {
+      return static_cast<ctrl_t>(mixed & 0x7FU);
+    }
+
+    //*************************************************************************
+    /// Triangular probing over groups.
+    /// Visits every group exactly once when the slot count is a power of two.
+    //*************************************************************************
+    class probe_sequence
+    {
+    public:
+
+      probe_sequence(size_t hash1, size_t mask_)
+        : mask(mask_)
+        , position(hash1 & mask_)
+        , index(0U)
+      {
+      }
+
+      size_t offset() const
+      {
+        return position;
+      }
+
+      size_t offset(size_t i) const
+      {
+        return (position + i) & mask;
+      }
+
+      void next()
+      {
+        index    += group::Width;
+        position += index;
+        position &= mask;
+      }
+
+      /// The number of slots probed before the current group.
+      size_t probed() const
+      {
+        return index;
+      }
+
+    private:
+
+      size_t mask;
+      size_t position;
+      size_t index;
+    };
+
+    //*************************************************************************
+    /// Sets the control byte for slot i, and its clone if it has one.
+    //*************************************************************************
+    inline void set_ctrl(ctrl_t* ctrl, size_t slots, size_t i, ctrl_t value)
+    {
+      ctrl[i] = value;
+
+      if (i < (group::Width - 1U))
+      {
+        ctrl[slots + i] = value;
+      }
+    }
+
+    //*************************************************************************
+    /// Marks all of the control bytes as empty.
+    //*************************************************************************
+    inline void reset_ctrl(ctrl_t* ctrl, size_t slots)
+    {
+      const size_t count = slots + group::Width - 1U;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        ctrl[i] = Empty;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the first empty or deleted slot in the probe sequence for hash1.
+    /// The load factor guarantees that one exists.
+    //*************************************************************************
+    inline size_t find_first_non_full(const ctrl_t* ctrl, size_t mask, size_t hash1)
+    {
+      probe_sequence seq(hash1, mask);
+
+      while (true)
+      {
+        const group g(ctrl + seq.offset());
+        const group::mask_type candidates = g.match_empty_or_deleted();
+
+        if (candidates.any())
+        {
+          return seq.offset(candidates.lowest());
+        }
+
+        seq.next();
+      }
+    }
+
+    //*************************************************************************
+    /// Returns true if slot i can be marked as empty when erased.
+    /// That is only true if no lookup could have probed past it, which is the
+    /// case if every group covering the slot contains an empty slot.
+    //*************************************************************************
+    inline bool can_mark_empty(const ctrl_t* ctrl, size_t mask, size_t i)
+    {
+      const size_t index_before = (i - group::Width) & mask;
+
+      const group::mask_type empty_after  = group(ctrl + i).match_empty();
+      const group::mask_type empty_before = group(ctrl + index_before).match_empty();
+
+      return empty_before.any() && empty_after.any() &&
+             ((empty_after.trailing_empty() + empty_before.leading_empty()) < group::Width);
+    }
+
+    //*************************************************************************
+    /// Prepares the control bytes for dropping the deleted slots in place.
+    /// Deleted slots become empty and occupied slots become deleted, meaning
+    /// 'needs to be rehashed'.
+    //*************************************************************************
+    inline void prepare_drop_deleted(ctrl_t* ctrl, size_t slots)
+    {
+      for (size_t i = 0U; i < slots; ++i)
+      {
+        ctrl[i] = is_full(ctrl[i]) ? Deleted : Empty;
+      }
+
+      for (size_t i = 0U; i < (group::Width - 1U); ++i)
+      {
+        ctrl[slots + i] = ctrl[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the first occupied control byte in [pctrl, pctrl_end), or pctrl_end.
+    /// Skips a group at a time. The cloned bytes may be read, but never returned.
+    //*************************************************************************
+    inline const ctrl_t* next_full(const ctrl_t* pctrl, const ctrl_t* pctrl_end)
+    {
+      while (pctrl != pctrl_end)
+      {
+        const size_t remaining = static_cast<size_t>(pctrl_end - pctrl);
+        const group::mask_type full = group(pctrl).match_full();
+
+        if (full.any() && (full.lowest() < remaining))
+        {
+          return pctrl + full.lowest();
+        }
+
+        if (remaining <= group::Width)
+        {
+          return pctrl_end;
+        }
+
+        pctrl += group::Width;
+      }
+
+      return pctrl_end;
+    }
+
+    //*************************************************************************
+    /// Returns the index of the probe group that slot i is in for hash1.
+    //*************************************************************************
+    inline size_t probe_index(size_t i, size_t mask, size_t hash1)
+    {
+      return ((i - (hash1 & mask)) & mask) / group::Width;
+    }
+  }
+
+  //***************************************************************************
+  /// The storage needed by a flat unordered container of MAX_SIZE elements.
+  /// Slot_Count    The number of value slots.
+  /// Control_Count The number of control bytes.
+  ///\ingroup unordered_flat_map
+  //***************************************************************************
+  template <size_t MAX_SIZE>
+  struct unordered_flat_buffer_size
+  {
+    static ETL_CONSTANT size_t Slot_Count    = etl::private_unordered_flat::slot_count<MAX_SIZE>::value;
+    static ETL_CONSTANT size_t Control_Count = Slot_Count + etl::private_unordered_flat::group::Width - 1U;
+  };
+
+  template <size_t MAX_SIZE>
+  ETL_CONSTANT size_t unordered_flat_buffer_size<MAX_SIZE>::Slot_Count;
+
+  template <size_t MAX_SIZE>
+  ETL_CONSTANT size_t unordered_flat_buffer_size<MAX_SIZE>::Control_Count;
+}
+
+#endif
@@ -0,0 +1,708 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a queue_mpmc_atomic.
+  ///\ingroup queue_mpmc
+  //***************************************************************************
+  class queue_mpmc_atomic_exception : public exception
+  {
+  public:
+
+    queue_mpmc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a queue_mpmc_atomic with no capacity.
+  ///\ingroup queue_mpmc
+  //***************************************************************************
+  class queue_mpmc_atomic_invalid_size : public queue_mpmc_atomic_exception
+  {
+  public:
+
+    queue_mpmc_atomic_invalid_size(string_type file_name_, numeric_type line_number_)
+      : queue_mpmc_atomic_exception(ETL_ERROR_TEXT("queue_mpmc_atomic:size", ETL_QUEUE_MPMC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief A lock free, fixed capacity, multiple producer, multiple consumer queue.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// Each slot in the buffer holds a sequence number that says whether it is
+  /// ready to be written or read on the current lap of the buffer.
+  /// A producer or consumer claims a slot with a single compare and swap of
+  /// the shared write or read position, then constructs or moves out the
+  /// value and publishes the slot by updating its sequence number.
+  /// Producers only contend with producers and consumers with consumers.
+  /// The write and read positions are kept on separate cache lines. The cache
+  /// line size is set by ETL_CACHE_LINE_SIZE.
+  /// push and pop do not block, but a producer or consumer that is suspended
+  /// between claiming a slot and publishing it holds up the others on that slot.
+  /// size, empty, full and available are snapshots and may be out of date as
+  /// soon as they return.
+  /// \tparam T The type of value that the queue holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic
+  {
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type; ///< The type used for determining the size of the queue.
+
+    //*************************************************************************
+    /// A slot in the buffer.
+    /// An external buffer for etl::queue_mpmc_atomic_ext must hold 'max_size' of these.
+    //*************************************************************************
+    struct slot_type
+    {
+      etl::atomic<size_t> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::move(value));
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(etl::forward<Args>(args)...);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_t position;
+      slot_type* p_slot = claim_write_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        ::new (&p_slot->value) T(value1, value2, value3, value4);
+        publish_write_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_t position;
+      slot_type* p_slot = claim_read_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        T* p_value = reinterpret_cast<T*>(&p_slot->value);
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(*p_value);
+#else
+        value = *p_value;
+#endif
+        p_value->~T();
+        publish_read_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_t position;
+      slot_type* p_slot = claim_read_slot(position);
+
+      if (p_slot != ETL_NULLPTR)
+      {
+        reinterpret_cast<T*>(&p_slot->value)->~T();
+        publish_read_slot(p_slot, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// The queue must not be empty and there must be no concurrent consumers,
+    /// as another consumer may pop the value.
+    //*************************************************************************
+    reference front()
+    {
+      return *reinterpret_cast<T*>(&get_slot(read_position.load(etl::memory_order_acquire)).value);
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// The queue must not be empty and there must be no concurrent consumers,
+    /// as another consumer may pop the value.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return *reinterpret_cast<const T*>(&get_slot(read_position.load(etl::memory_order_acquire)).value);
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    //*************************************************************************
+    size_type size() const
+    {
+      // Read the read position first, so that the write position cannot be behind it.
+      size_t    read_index  = read_position.load(etl::memory_order_acquire);
+      size_t    write_index = write_position.load(etl::memory_order_acquire);
+      ptrdiff_t difference  = get_difference(write_index, read_index);
+
+      if (difference < 0)
+      {
+        return 0U;
+      }
+      else if (size_t(difference) > MAX_SIZE)
+      {
+        return MAX_SIZE;
+      }
+      else
+      {
+        return size_type(difference);
+      }
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(slot_type* p_slots_, size_type max_size_)
+      : p_slots(p_slots_)
+      , MAX_SIZE(max_size_)
+      , LIMIT(get_limit(max_size_))
+      , write_position(0U)
+      , read_position(0U)
+    {
+      for (size_t i = 0U; i < MAX_SIZE; ++i)
+      {
+        ::new (&p_slots[i].sequence) etl::atomic<size_t>(i);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the slot at the write position.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    slot_type* claim_write_slot(size_t& position)
+    {
+      position = write_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type& slot       = get_slot(position);
+        size_t     sequence   = slot.sequence.load(etl::memory_order_acquire);
+        ptrdiff_t  difference = get_difference(sequence, position);
+
+        if (difference == 0)
+        {
+          // The slot is free on this lap. Try to claim it.
+          if (write_position.compare_exchange_weak(position, get_position_after(position, 1U), etl::memory_order_relaxed))
+          {
+            return &slot;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer has claimed it.
+          position = write_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Marks a claimed slot as ready to read.
+    //*************************************************************************
+    void publish_write_slot(slot_type* p_slot, size_t position)
+    {
+      p_slot->sequence.store(get_position_after(position, 1U), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the read position.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    slot_type* claim_read_slot(size_t& position)
+    {
+      position = read_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        slot_type& slot       = get_slot(position);
+        size_t     sequence   = slot.sequence.load(etl::memory_order_acquire);
+        ptrdiff_t  difference = get_difference(sequence, get_position_after(position, 1U));
+
+        if (difference == 0)
+        {
+          // The slot has been written on this lap. Try to claim it.
+          if (read_position.compare_exchange_weak(position, get_position_after(position, 1U), etl::memory_order_relaxed))
+          {
+            return &slot;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been written on this lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer has claimed it.
+          position = read_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Marks a claimed slot as ready to write on the next lap.
+    //*************************************************************************
+    void publish_read_slot(slot_type* p_slot, size_t position)
+    {
+      p_slot->sequence.store(get_position_after(position, MAX_SIZE), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Positions and sequence numbers count from 0 to LIMIT - 1 and wrap.
+    /// LIMIT is a multiple of the capacity, so that the slot for a position
+    /// does not jump when it wraps, and is no more than half of the range of
+    /// size_t, so that differences can be signed.
+    /// Called from the constructor, so it checks the capacity first.
+    //*************************************************************************
+    static size_t get_limit(size_type max_size_)
+    {
+      ETL_ASSERT(max_size_ > 0U, ETL_ERROR(etl::queue_mpmc_atomic_invalid_size));
+
+      const size_t half_range = (etl::integral_limits<size_t>::max / 2U) + 1U;
+
+      return (half_range / max_size_) * max_size_;
+    }
+
+    //*************************************************************************
+    /// The position 'n' places after 'position'.
+    //*************************************************************************
+    size_t get_position_after(size_t position, size_t n) const
+    {
+      return (position >= (LIMIT - n)) ? (position - (LIMIT - n)) : (position + n);
+    }
+
+    //*************************************************************************
+    /// The signed distance from 'rhs' to 'lhs'.
+    //*************************************************************************
+    ptrdiff_t get_difference(size_t lhs, size_t rhs) const
+    {
+      size_t difference = (lhs >= rhs) ? (lhs - rhs) : (lhs + (LIMIT - rhs));
+
+      return (difference >= (LIMIT / 2U)) ? -ptrdiff_t(LIMIT - difference) : ptrdiff_t(difference);
+    }
+
+    //*************************************************************************
+    /// The slot for a position.
+    //*************************************************************************
+    slot_type& get_slot(size_t position) const
+    {
+      return p_slots[position % MAX_SIZE];
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    slot_type* const    p_slots;                        ///< The internal buffer.
+    const size_type     MAX_SIZE;                       ///< The maximum number of items in the queue.
+    const size_t        LIMIT;                          ///< The range of positions and sequence numbers.
+    char                write_padding[ETL_CACHE_LINE_SIZE]; ///< Separates from the read-only data.
+    etl::atomic<size_t> write_position;                 ///< The next slot to claim for a push.
+    char                read_padding[ETL_CACHE_LINE_SIZE];  ///< Separates from the producers' data.
+    etl::atomic<size_t> read_position;                  ///< The next slot to claim for a pop.
+    char                end_padding[ETL_CACHE_LINE_SIZE];   ///< Separates from the data that follows.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iqueue_mpmc_atomic()
+    {
+    }
+#else
+  protected:
+    ~iqueue_mpmc_atomic()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity, lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the size variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+    typedef typename base_t::slot_type slot_type;
+
+    ETL_STATIC_ASSERT((SIZE > 0U), "Size must be greater than zero");
+    ETL_STATIC_ASSERT((SIZE <= etl::integral_limits<size_type>::max), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(reinterpret_cast<slot_type*>(&buffer[0]), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The uninitialised buffer of slots used in the queue_mpmc_atomic.
+    typename etl::aligned_storage<sizeof(slot_type), etl::alignment_of<slot_type>::value>::type buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A lock free mpmc queue that uses an external buffer.
+  /// The buffer must hold 'max_size' elements of
+  /// etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>::slot_type.
+  /// \tparam T            The type this queue should support.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the size variables.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_ext : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+    typedef typename base_t::slot_type slot_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   The buffer for the slots.
+    ///\param max_size The maximum number of items in the queue. Must not be zero.
+    /// Emits etl::queue_mpmc_atomic_invalid_size if it is.
+    //*************************************************************************
+    queue_mpmc_atomic_ext(void* buffer, size_type max_size)
+      : base_t(reinterpret_cast<slot_type*>(buffer), max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic_ext()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic_ext(const queue_mpmc_atomic_ext&) ETL_DELETE;
+    queue_mpmc_atomic_ext& operator = (const queue_mpmc_atomic_ext&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic_ext(queue_mpmc_atomic_ext&&) = delete;
+    queue_mpmc_atomic_ext& operator = (queue_mpmc_atomic_ext&&) = delete;
+#endif
+  };
+}
+
+#endif
+
+#endif
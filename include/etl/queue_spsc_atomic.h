@@ -39,17 +39,198 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
+#include "memory.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+#include "private/spsc_atomic_wait.h"
 
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 #if ETL_HAS_ATOMIC
 
 namespace etl
 {
-  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic_base
+  //***************************************************************************
+  /// Base exception for an spsc atomic queue.
+  //***************************************************************************
+  class queue_spsc_atomic_exception : public exception
+  {
+  public:
+
+    queue_spsc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for committing more than was reserved or peeked.
+  //***************************************************************************
+  class queue_spsc_atomic_commit_invalid : public queue_spsc_atomic_exception
   {
+  public:
+
+    queue_spsc_atomic_commit_invalid(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_atomic_exception(ETL_ERROR_TEXT("queue_spsc_atomic:commit", ETL_QUEUE_SPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The layouts of the spsc atomic queue's indexes.
+  /// COMPACT keeps the indexes next to each other.
+  /// PADDED keeps the producer's and consumer's indexes on separate cache
+  /// lines, set by ETL_CACHE_LINE_SIZE. Each side also keeps a private copy of
+  /// the other side's index, which it only refreshes when the copy shows the
+  /// queue as full (for the producer) or empty (for the consumer), so that it
+  /// reads the other side's line less often. It is aimed at a producer and
+  /// consumer running on different cores; measure on the target to see if it
+  /// helps. Each PADDED queue is three cache lines larger.
+  //***************************************************************************
+  struct spsc_queue_layout
+  {
+    enum
+    {
+      COMPACT,
+      PADDED
+    };
+  };
+
+  namespace private_queue_spsc_atomic
+  {
+    //*************************************************************************
+    /// The indexes of an spsc atomic queue.
+    //*************************************************************************
+    template <typename TSize, const size_t LAYOUT>
+    class indexes;
+
+    //*************************************************************************
+    /// The indexes, next to each other.
+    /// The producer and consumer always read the other side's index.
+    //*************************************************************************
+    template <typename TSize>
+    class indexes<TSize, etl::spsc_queue_layout::COMPACT>
+    {
+    protected:
+
+      indexes()
+        : write(0),
+          read(0)
+      {
+      }
+
+      //*******************************
+      /// The consumer's index, as seen by the producer.
+      //*******************************
+      TSize peer_read()
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //*******************************
+      /// The consumer's index, re-read by the producer.
+      //*******************************
+      TSize refresh_peer_read()
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //*******************************
+      /// The producer's index, as seen by the consumer.
+      //*******************************
+      TSize peer_write()
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+
+      //*******************************
+      /// The producer's index, re-read by the consumer.
+      //*******************************
+      TSize refresh_peer_write()
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+
+      etl::atomic<TSize> write; ///< Where to input new data.
+      etl::atomic<TSize> read;  ///< Where to get the oldest data.
+    };
+
+    //*************************************************************************
+    /// The indexes, on separate cache lines.
+    /// The producer and consumer each keep a copy of the other side's index.
+    //*************************************************************************
+    template <typename TSize>
+    class indexes<TSize, etl::spsc_queue_layout::PADDED>
+    {
+    protected:
+
+      indexes()
+        : write(0),
+          cached_read(0),
+          read(0),
+          cached_write(0)
+      {
+      }
+
+      //*******************************
+      /// The consumer's index, as seen by the producer.
+      //*******************************
+      TSize peer_read()
+      {
+        return cached_read;
+      }
+
+      //*******************************
+      /// The consumer's index, re-read by the producer.
+      //*******************************
+      TSize refresh_peer_read()
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+
+        return cached_read;
+      }
+
+      //*******************************
+      /// The producer's index, as seen by the consumer.
+      //*******************************
+      TSize peer_write()
+      {
+        return cached_write;
+      }
+
+      //*******************************
+      /// The producer's index, re-read by the consumer.
+      //*******************************
+      TSize refresh_peer_write()
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+
+        return cached_write;
+      }
+
+      char               padding[ETL_CACHE_LINE_SIZE];          ///< Separates the producer's data from what comes before.
+      etl::atomic<TSize> write;                                 ///< Where to input new data.
+      TSize              cached_read;                           ///< The producer's copy of 'read'.
+      char               padding_producer[ETL_CACHE_LINE_SIZE]; ///< Separates the consumer's data from the producer's.
+      etl::atomic<TSize> read;                                  ///< Where to get the oldest data.
+      TSize              cached_write;                          ///< The consumer's copy of 'write'.
+      char               padding_consumer[ETL_CACHE_LINE_SIZE]; ///< Separates the consumer's data from what comes after.
+    };
+  }
+
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::spsc_queue_layout::COMPACT>
+  class queue_spsc_atomic_base : public etl::private_queue_spsc_atomic::indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type, LAYOUT>
+  {
+  private:
+
+    typedef etl::private_queue_spsc_atomic::indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type, LAYOUT> indexes_t;
+
   public:
 
     /// The type used for determining the size of queue.
@@ -128,9 +309,7 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
-        read(0),
-        RESERVED(reserved_)
+      : RESERVED(reserved_)
     {
     }
 
@@ -149,8 +328,9 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
+    using indexes_t::write;
+    using indexes_t::read;
+
     const size_type RESERVED;     ///< The maximum number of items in the queue.
 
   private:
@@ -180,14 +360,15 @@ namespace etl
   /// etl::iqueue_spsc_atomic<int>& iQueue = myQueue;
   ///\endcode
   /// This queue supports concurrent access by one producer and one consumer.
-  /// \tparam T The type of value that the queue_spsc_atomic holds.
+  /// \tparam T      The type of value that the queue_spsc_atomic holds.
+  /// \tparam LAYOUT The layout of the indexes. See etl::spsc_queue_layout.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::spsc_queue_layout::COMPACT>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL, LAYOUT>
   {
   private:
 
-    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL> base_t;
+    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL, LAYOUT> base_t;
 
   public:
 
@@ -203,6 +384,10 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::peer_read;
+    using base_t::refresh_peer_read;
+    using base_t::peer_write;
+    using base_t::refresh_peer_write;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,11 +397,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -234,11 +420,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -259,11 +446,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -282,11 +470,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -305,11 +494,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -328,11 +518,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -351,11 +542,12 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (can_write(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
         write.store(next_index, etl::memory_order_release);
+        notify_consumer();
 
         return true;
       }
@@ -372,7 +564,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -390,7 +582,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -407,6 +599,7 @@ namespace etl
       p_buffer[read_index].~T();
 
       read.store(next_index, etl::memory_order_release);
+      notify_producer();
 
       return true;
     }
@@ -418,7 +611,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!can_read(read_index))
       {
         // Queue is empty
         return false;
@@ -429,6 +622,7 @@ namespace etl
       p_buffer[read_index].~T();
 
       read.store(next_index, etl::memory_order_release);
+      notify_producer();
 
       return true;
     }
@@ -453,6 +647,162 @@ namespace etl
       return p_buffer[read_index];
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    /// The values are copied in at most two contiguous runs (memcpy for
+    /// trivially copyable types) and the write index is published once.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    size_type push(const etl::span<const T>& values)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_space  = get_producer_free_space(write_index, values.size());
+      size_type n           = static_cast<size_type>(etl::min(values.size(), static_cast<size_t>(free_space)));
+      size_type first       = etl::min(n, static_cast<size_type>(RESERVED - write_index));
+
+      const T* p_values = values.data();
+
+      copy_in(p_values,         first,     p_buffer + write_index, etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+      copy_in(p_values + first, n - first, p_buffer,               etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+
+      write.store(get_index_after(write_index, n), etl::memory_order_release);
+      notify_consumer();
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as are available, up to the size of 'values'.
+    /// The values are moved out in at most two contiguous runs (memcpy for
+    /// trivially copyable types) and the read index is published once.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    size_type pop(const etl::span<T>& values)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used       = get_consumer_used_space(read_index, values.size());
+      size_type n          = static_cast<size_type>(etl::min(values.size(), static_cast<size_t>(used)));
+      size_type first      = etl::min(n, static_cast<size_type>(RESERVED - read_index));
+
+      T* p_values = values.data();
+
+      move_out(p_buffer + read_index, first,     p_values,         etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+      move_out(p_buffer,              n - first, p_values + first, etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>());
+
+      read.store(get_index_after(read_index, n), etl::memory_order_release);
+      notify_producer();
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Reserves up to 'max_reserve_size' free slots for writing in place.
+    /// The span covers the contiguous free slots from the write position, so
+    /// it may be shorter than requested when the free space wraps around the
+    /// end of the buffer. Reserve again after committing to get the remainder.
+    /// Returns an empty span if the queue is full.
+    /// The slots are uninitialised, so T must be trivially copyable.
+    /// Must be called from the 'push' thread.
+    //*************************************************************************
+    etl::span<T> reserve_write(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "reserve_write requires a trivially copyable type");
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type wanted      = etl::min(max_reserve_size, static_cast<size_type>(RESERVED - write_index));
+      size_type n           = etl::min(wanted, get_producer_free_space(write_index, wanted));
+
+      return etl::span<T>(p_buffer + write_index, n);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'n' slots of the span returned by reserve_write.
+    /// 'n' must not be larger than the size of that span. Emits an
+    /// etl::queue_spsc_atomic_commit_invalid error, and commits nothing, if
+    /// 'n' is larger than the contiguous free space.
+    /// Must be called from the 'push' thread.
+    //*************************************************************************
+    void commit_write(size_type n)
+    {
+      ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "commit_write requires a trivially copyable type");
+
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_space  = get_producer_free_space(write_index, n);
+
+      ETL_ASSERT_AND_RETURN((n <= free_space) && (n <= (RESERVED - write_index)), ETL_ERROR(queue_spsc_atomic_commit_invalid));
+
+      write.store(get_index_after(write_index, n), etl::memory_order_release);
+      notify_consumer();
+    }
+
+    //*************************************************************************
+    /// Gets up to 'max_peek_size' of the values at the front of the queue,
+    /// without removing them.
+    /// The span covers the contiguous values from the read position, so it may
+    /// be shorter than requested when the values wrap around the end of the
+    /// buffer. Peek again after committing to get the remainder.
+    /// Returns an empty span if the queue is empty.
+    /// Must be called from the 'pop' thread.
+    //*************************************************************************
+    etl::span<T> peek_read(size_type max_peek_size = etl::integral_limits<size_type>::max)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type wanted     = etl::min(max_peek_size, static_cast<size_type>(RESERVED - read_index));
+      size_type n          = etl::min(wanted, get_consumer_used_space(read_index, wanted));
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Removes the first 'n' values of the span returned by peek_read.
+    /// 'n' must not be larger than the size of that span. Emits an
+    /// etl::queue_spsc_atomic_commit_invalid error, and removes nothing, if
+    /// 'n' is larger than the contiguous values available.
+    /// Must be called from the 'pop' thread.
+    //*************************************************************************
+    void commit_read(size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used       = get_consumer_used_space(read_index, n);
+
+      ETL_ASSERT_AND_RETURN((n <= used) && (n <= (RESERVED - read_index)), ETL_ERROR(queue_spsc_atomic_commit_invalid));
+
+      etl::destroy(p_buffer + read_index, p_buffer + read_index + n);
+
+      read.store(get_index_after(read_index, n), etl::memory_order_release);
+      notify_producer();
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    /// Push a value to the queue, waiting for space if the queue is full.
+    /// Spins for a while, then sleeps until the consumer pops a value.
+    /// Waits for up to 'timeout_us' microseconds; by default, forever.
+    /// Returns false if the queue was still full at the timeout.
+    /// Must be called from the 'push' thread.
+    //*************************************************************************
+    bool push_wait(const_reference value, uint32_t timeout_us = etl::private_spsc_atomic_wait::waiter::Forever)
+    {
+      push_operation operation = { *this, value };
+
+      return producer_waiter.wait(operation, timeout_us);
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting for one if the queue is empty.
+    /// Spins for a while, then sleeps until the producer pushes a value.
+    /// Waits for up to 'timeout_us' microseconds; by default, forever.
+    /// Returns false if the queue was still empty at the timeout.
+    /// Must be called from the 'pop' thread.
+    //*************************************************************************
+    bool pop_wait(reference value, uint32_t timeout_us = etl::private_spsc_atomic_wait::waiter::Forever)
+    {
+      pop_operation operation = { *this, value };
+
+      return consumer_waiter.wait(operation, timeout_us);
+    }
+
+#endif
     //*************************************************************************
     /// Clear the queue.
     /// Must be called from thread that pops the queue or when there is no
@@ -479,6 +829,183 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Can the producer write to the slot before 'next_index'?
+    /// Only re-reads the consumer's index if the last one seen says that the
+    /// queue is full.
+    //*************************************************************************
+    bool can_write(size_type next_index)
+    {
+      return (next_index != peer_read()) || (next_index != refresh_peer_read());
+    }
+
+    //*************************************************************************
+    /// Can the consumer read from 'read_index'?
+    /// Only re-reads the producer's index if the last one seen says that the
+    /// queue is empty.
+    //*************************************************************************
+    bool can_read(size_type read_index)
+    {
+      return (read_index != peer_write()) || (read_index != refresh_peer_write());
+    }
+
+    //*************************************************************************
+    /// The number of free slots, as seen by the producer.
+    /// Only re-reads the consumer's index if the last one seen says that there
+    /// are fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_producer_free_space(size_type write_index, size_t wanted)
+    {
+      size_type free_space = get_free_space(write_index, peer_read());
+
+      if (free_space < wanted)
+      {
+        free_space = get_free_space(write_index, refresh_peer_read());
+      }
+
+      return free_space;
+    }
+
+    //*************************************************************************
+    /// The number of used slots, as seen by the consumer.
+    /// Only re-reads the producer's index if the last one seen says that there
+    /// are fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_consumer_used_space(size_type read_index, size_t wanted)
+    {
+      size_type used = get_used_space(peer_write(), read_index);
+
+      if (used < wanted)
+      {
+        used = get_used_space(refresh_peer_write(), read_index);
+      }
+
+      return used;
+    }
+
+    //*************************************************************************
+    /// The number of free slots.
+    //*************************************************************************
+    size_type get_free_space(size_type write_index, size_type read_index) const
+    {
+      return (read_index > write_index) ? size_type(read_index - write_index - 1)
+                                        : size_type(RESERVED - write_index + read_index - 1);
+    }
+
+    //*************************************************************************
+    /// The number of used slots.
+    //*************************************************************************
+    size_type get_used_space(size_type write_index, size_type read_index) const
+    {
+      return (write_index >= read_index) ? size_type(write_index - read_index)
+                                         : size_type(RESERVED - read_index + write_index);
+    }
+
+    //*************************************************************************
+    /// The index 'n' slots after 'index'.
+    //*************************************************************************
+    size_type get_index_after(size_type index, size_type n) const
+    {
+      const size_type to_end = size_type(RESERVED - index);
+
+      return (n >= to_end) ? size_type(n - to_end) : size_type(index + n);
+    }
+
+    //*************************************************************************
+    /// Copies values into uninitialised slots. Trivially copyable.
+    //*************************************************************************
+    static void copy_in(const T* p_source, size_type n, T* p_destination, etl::true_type)
+    {
+      if (n != 0)
+      {
+        memcpy(static_cast<void*>(p_destination), static_cast<const void*>(p_source), n * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    /// Copies values into uninitialised slots. Not trivially copyable.
+    //*************************************************************************
+    static void copy_in(const T* p_source, size_type n, T* p_destination, etl::false_type)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        ::new (p_destination + i) T(p_source[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves values out of slots, leaving them uninitialised. Trivially copyable.
+    //*************************************************************************
+    static void move_out(T* p_source, size_type n, T* p_destination, etl::true_type)
+    {
+      if (n != 0)
+      {
+        memcpy(static_cast<void*>(p_destination), static_cast<const void*>(p_source), n * sizeof(T));
+      }
+    }
+
+    //*************************************************************************
+    /// Moves values out of slots, leaving them uninitialised. Not trivially copyable.
+    //*************************************************************************
+    static void move_out(T* p_source, size_type n, T* p_destination, etl::false_type)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_destination[i] = ETL_MOVE(p_source[i]);
+        p_source[i].~T();
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes the consumer if it is waiting in pop_wait.
+    //*************************************************************************
+    void notify_consumer()
+    {
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+      consumer_waiter.notify();
+#endif
+    }
+
+    //*************************************************************************
+    /// Wakes the producer if it is waiting in push_wait.
+    //*************************************************************************
+    void notify_producer()
+    {
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+      producer_waiter.notify();
+#endif
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    /// The operation that push_wait re-tries.
+    //*************************************************************************
+    struct push_operation
+    {
+      bool operator()()
+      {
+        return queue.push(value);
+      }
+
+      iqueue_spsc_atomic& queue;
+      const_reference     value;
+    };
+
+    //*************************************************************************
+    /// The operation that pop_wait re-tries.
+    //*************************************************************************
+    struct pop_operation
+    {
+      bool operator()()
+      {
+        return queue.pop(value);
+      }
+
+      iqueue_spsc_atomic& queue;
+      reference           value;
+    };
+#endif
+
     // Disable copy construction and assignment.
     iqueue_spsc_atomic(const iqueue_spsc_atomic&) ETL_DELETE;
     iqueue_spsc_atomic& operator =(const iqueue_spsc_atomic&) ETL_DELETE;
@@ -489,6 +1016,11 @@ namespace etl
 #endif
 
     T* p_buffer; ///< The internal buffer.
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    etl::private_spsc_atomic_wait::waiter producer_waiter; ///< Where push_wait sleeps.
+    etl::private_spsc_atomic_wait::waiter consumer_waiter; ///< Where pop_wait sleeps.
+#endif
   };
 
   //***************************************************************************
@@ -498,13 +1030,14 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam LAYOUT       The layout of the indexes. See etl::spsc_queue_layout.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t LAYOUT = etl::spsc_queue_layout::COMPACT>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL, LAYOUT>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, LAYOUT> base_t;
 
   public:
 
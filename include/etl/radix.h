@@ -33,11 +33,22 @@ SOFTWARE.
 
 #include "platform.h"
 #include "enum_type.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "algorithm.h"
+#include "utility.h"
+#include "span.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
 
 #include <stdint.h>
+#include <string.h>
 
 ///\defgroup radix radix
 /// Radix constants for binary, octal, decimal and hex.
+/// Radix sorts for integral and floating point keys.
 ///\ingroup etl
 
 namespace etl
@@ -62,6 +73,466 @@ namespace etl
     ETL_ENUM_TYPE(hex,       "hex")
     ETL_END_ENUM_TYPE
   };
+
+  //***************************************************************************
+  /// Exception base for radix sorts.
+  ///\ingroup radix
+  //***************************************************************************
+  class radix_sort_exception : public etl::exception
+  {
+  public:
+
+    radix_sort_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The scratch buffer is smaller than the range to sort.
+  ///\ingroup radix
+  //***************************************************************************
+  class radix_sort_buffer_too_small : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_buffer_too_small(string_type file_name_, numeric_type line_number_)
+      : radix_sort_exception(ETL_ERROR_TEXT("radix_sort:buffer", ETL_RADIX_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix
+  {
+    //*************************************************************************
+    /// The unsigned type with the same size as a floating point type.
+    //*************************************************************************
+    template <size_t Size>
+    struct floating_point_bits;
+
+    template <>
+    struct floating_point_bits<4U>
+    {
+      typedef uint32_t type;
+    };
+
+    template <>
+    struct floating_point_bits<8U>
+    {
+      typedef uint64_t type;
+    };
+
+    //*************************************************************************
+    /// Converts a key to an unsigned value with the same ordering.
+    /// Unsigned integral keys.
+    //*************************************************************************
+    template <typename TKey, bool Is_Floating_Point = etl::is_floating_point<TKey>::value, bool Is_Signed = etl::is_signed<TKey>::value>
+    struct key_traits
+    {
+      ETL_STATIC_ASSERT((etl::is_integral<TKey>::value && !etl::is_same<TKey, bool>::value), "Radix sort keys must be integral or floating point");
+
+      typedef typename etl::make_unsigned<TKey>::type unsigned_type;
+
+      static unsigned_type to_unsigned(TKey key)
+      {
+        return static_cast<unsigned_type>(key);
+      }
+    };
+
+    //*************************************************************************
+    /// Signed integral keys.
+    /// Flipping the sign bit puts negative values before positive ones.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_traits<TKey, false, true>
+    {
+      typedef typename etl::make_unsigned<TKey>::type unsigned_type;
+
+      static unsigned_type to_unsigned(TKey key)
+      {
+        return static_cast<unsigned_type>(static_cast<unsigned_type>(key) ^ (unsigned_type(1U) << ((CHAR_BIT * sizeof(TKey)) - 1U)));
+      }
+    };
+
+    //*************************************************************************
+    /// Floating point keys.
+    /// Positive values have the sign bit set; negative values have all bits
+    /// inverted, which reverses their order. -0.0 sorts before +0.0 and NaNs
+    /// sort to the ends, according to their sign.
+    //*************************************************************************
+    template <typename TKey, bool Is_Signed>
+    struct key_traits<TKey, true, Is_Signed>
+    {
+      typedef typename floating_point_bits<sizeof(TKey)>::type unsigned_type;
+
+      static unsigned_type to_unsigned(TKey key)
+      {
+        unsigned_type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        const unsigned_type sign = unsigned_type(1U) << ((CHAR_BIT * sizeof(TKey)) - 1U);
+
+        return ((bits & sign) != 0U) ? static_cast<unsigned_type>(~bits) : static_cast<unsigned_type>(bits | sign);
+      }
+    };
+
+    //*************************************************************************
+    /// Gets a byte of an unsigned key.
+    //*************************************************************************
+    template <typename TUnsigned>
+    uint8_t get_byte(TUnsigned key, size_t index)
+    {
+      return static_cast<uint8_t>(key >> (index * 8U));
+    }
+
+    //*************************************************************************
+    /// Uses the value as the key.
+    //*************************************************************************
+    struct identity_key
+    {
+      template <typename T>
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Uses a data member as the key.
+    //*************************************************************************
+    template <typename TKey, typename TClass>
+    struct member_key
+    {
+      explicit member_key(TKey TClass::* member_)
+        : member(member_)
+      {
+      }
+
+      const TKey& operator()(const TClass& value) const
+      {
+        return value.*member;
+      }
+
+      TKey TClass::* member;
+    };
+
+    //*************************************************************************
+    /// Compares the projected keys of two values.
+    //*************************************************************************
+    template <typename TKey, typename TProjection>
+    struct key_compare
+    {
+      explicit key_compare(TProjection projection_)
+        : projection(projection_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T& lhs, const T& rhs) const
+      {
+        return key_traits<TKey>::to_unsigned(projection(lhs)) < key_traits<TKey>::to_unsigned(projection(rhs));
+      }
+
+      TProjection projection;
+    };
+
+    //*************************************************************************
+    /// Moves each element from the source to its bucket in the destination.
+    //*************************************************************************
+    template <typename TKey, typename TSource, typename TDestination, typename TProjection>
+    void scatter(TSource first, TSource last, TDestination destination, TProjection projection, size_t byte_index, size_t* offsets)
+    {
+      typedef key_traits<TKey> traits;
+
+      while (first != last)
+      {
+        const uint8_t byte = get_byte(traits::to_unsigned(projection(*first)), byte_index);
+
+        *(destination + offsets[byte]) = ETL_MOVE(*first);
+        ++offsets[byte];
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// LSD radix sort.
+    /// The histograms for every byte are built in one pass over the data, and
+    /// bytes that are the same for every key are skipped.
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TPointer, typename TProjection>
+    void lsd_sort(TIterator first, TIterator last, TPointer buffer, TProjection projection)
+    {
+      typedef key_traits<TKey>               traits;
+      typedef typename traits::unsigned_type unsigned_t;
+
+      const size_t Key_Bytes = sizeof(unsigned_t);
+      const size_t size      = static_cast<size_t>(etl::distance(first, last));
+
+      if (size < 2U)
+      {
+        return;
+      }
+
+      size_t counts[Key_Bytes][256U];
+      memset(counts, 0, sizeof(counts));
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        const unsigned_t key = traits::to_unsigned(projection(*itr));
+
+        for (size_t i = 0U; i < Key_Bytes; ++i)
+        {
+          ++counts[i][get_byte(key, i)];
+        }
+      }
+
+      bool in_buffer = false;
+
+      for (size_t i = 0U; i < Key_Bytes; ++i)
+      {
+        size_t* offsets = counts[i];
+
+        // Skip the pass if every key has the same byte here.
+        const uint8_t byte = get_byte(traits::to_unsigned(projection(in_buffer ? *buffer : *first)), i);
+
+        if (offsets[byte] == size)
+        {
+          continue;
+        }
+
+        size_t total = 0U;
+
+        for (size_t j = 0U; j < 256U; ++j)
+        {
+          const size_t count = offsets[j];
+          offsets[j] = total;
+          total += count;
+        }
+
+        if (in_buffer)
+        {
+          scatter<TKey>(buffer, buffer + size, first, projection, i, offsets);
+        }
+        else
+        {
+          scatter<TKey>(first, last, buffer, projection, i, offsets);
+        }
+
+        in_buffer = !in_buffer;
+      }
+
+      if (in_buffer)
+      {
+        etl::move(buffer, buffer + size, first);
+      }
+    }
+
+    //*************************************************************************
+    /// MSD 'American flag' radix sort.
+    /// Elements are permuted in place in to their buckets, then each bucket is
+    /// sorted on the next byte. Small buckets use an insertion sort.
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TProjection>
+    void msd_sort(TIterator first, TIterator last, TProjection projection, size_t byte_index)
+    {
+      typedef key_traits<TKey>                                          traits;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const size_t Insertion_Sort_Threshold = 32U;
+
+      while (true)
+      {
+        const size_t size = static_cast<size_t>(last - first);
+
+        if (size < Insertion_Sort_Threshold)
+        {
+          etl::private_algorithm::intro_sort_insertion(first, last, key_compare<TKey, TProjection>(projection), true);
+          return;
+        }
+
+        size_t heads[256U];
+        size_t tails[256U];
+        memset(tails, 0, sizeof(tails));
+
+        for (TIterator itr = first; itr != last; ++itr)
+        {
+          ++tails[get_byte(traits::to_unsigned(projection(*itr)), byte_index)];
+        }
+
+        // Skip the byte if it is the same for every key.
+        const uint8_t first_byte = get_byte(traits::to_unsigned(projection(*first)), byte_index);
+
+        if (tails[first_byte] == size)
+        {
+          if (byte_index == 0U)
+          {
+            return;
+          }
+
+          --byte_index;
+          continue;
+        }
+
+        size_t total = 0U;
+
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          heads[i]  = total;
+          total    += tails[i];
+          tails[i]  = total;
+        }
+
+        // Swap each element in to its bucket.
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          while (heads[i] < tails[i])
+          {
+            TIterator itr = first + static_cast<difference_t>(heads[i]);
+
+            const uint8_t byte = get_byte(traits::to_unsigned(projection(*itr)), byte_index);
+
+            if (byte == i)
+            {
+              ++heads[i];
+            }
+            else
+            {
+              etl::iter_swap(itr, first + static_cast<difference_t>(heads[byte]));
+              ++heads[byte];
+            }
+          }
+        }
+
+        if (byte_index == 0U)
+        {
+          return;
+        }
+
+        // Sort each bucket on the next byte.
+        size_t start = 0U;
+
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          const size_t end = tails[i];
+
+          if ((end - start) > 1U)
+          {
+            msd_sort<TKey>(first + static_cast<difference_t>(start), first + static_cast<difference_t>(end), projection, byte_index - 1U);
+          }
+
+          start = end;
+        }
+
+        return;
+      }
+    }
+
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TProjection>
+    void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> buffer, TProjection projection)
+    {
+      ETL_ASSERT_AND_RETURN(buffer.size() >= static_cast<size_t>(etl::distance(first, last)), ETL_ERROR(radix_sort_buffer_too_small));
+
+      lsd_sort<TKey>(first, last, buffer.data(), projection);
+    }
+
+    //*************************************************************************
+    template <typename TKey, typename TIterator, typename TProjection>
+    void radix_sort_in_place(TIterator first, TIterator last, TProjection projection)
+    {
+      msd_sort<TKey>(first, last, projection, sizeof(typename key_traits<TKey>::unsigned_type) - 1U);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts integral or floating point values with an LSD radix sort.
+  /// Stable. O(n) for a fixed key size.
+  /// Requires random access iterators.
+  /// Uses a histogram of every key byte, sizeof(key) * 256 * sizeof(size_t)
+  /// bytes, on the stack.
+  ///\param buffer Scratch space of at least the length of the range.
+  ///              Emits radix_sort_buffer_too_small if it is not.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> buffer)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    private_radix::radix_sort<value_t>(first, last, buffer, private_radix::identity_key());
+  }
+
+  //***************************************************************************
+  /// Sorts values with an LSD radix sort, using a data member as the key.
+  /// i.e. etl::radix_sort(records.begin(), records.end(), buffer, &Record::timestamp);
+  ///\param buffer Scratch space of at least the length of the range.
+  ///\param member The integral or floating point member to sort on.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator, typename TKey, typename TClass>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> buffer, TKey TClass::* member)
+  {
+    private_radix::radix_sort<TKey>(first, last, buffer, private_radix::member_key<TKey, TClass>(member));
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts values with an LSD radix sort, using a projection as the key.
+  ///\param buffer     Scratch space of at least the length of the range.
+  ///\param projection Returns the integral or floating point key of a value.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator, typename TProjection>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> buffer, TProjection projection)
+  {
+    typedef typename etl::decay<decltype(projection(*first))>::type key_t;
+
+    private_radix::radix_sort<key_t>(first, last, buffer, projection);
+  }
+#endif
+
+  //***************************************************************************
+  /// Sorts integral or floating point values in place with an MSD
+  /// 'American flag' radix sort.
+  /// Not stable. Needs no scratch buffer.
+  /// Requires random access iterators.
+  /// Uses up to sizeof(key) levels of recursion, each with
+  /// 2 * 256 * sizeof(size_t) bytes of stack.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator>
+  void radix_sort_in_place(TIterator first, TIterator last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+    private_radix::radix_sort_in_place<value_t>(first, last, private_radix::identity_key());
+  }
+
+  //***************************************************************************
+  /// Sorts values in place with an MSD radix sort, using a data member as the key.
+  ///\param member The integral or floating point member to sort on.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator, typename TKey, typename TClass>
+  void radix_sort_in_place(TIterator first, TIterator last, TKey TClass::* member)
+  {
+    private_radix::radix_sort_in_place<TKey>(first, last, private_radix::member_key<TKey, TClass>(member));
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts values in place with an MSD radix sort, using a projection as the key.
+  ///\param projection Returns the integral or floating point key of a value.
+  ///\ingroup radix
+  //***************************************************************************
+  template <typename TIterator, typename TProjection>
+  void radix_sort_in_place(TIterator first, TIterator last, TProjection projection)
+  {
+    typedef typename etl::decay<decltype(projection(*first))>::type key_t;
+
+    private_radix::radix_sort_in_place<key_t>(first, last, projection);
+  }
+#endif
 }
 
 #endif
@@ -1056,6 +1056,14 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Gets the lookup, for bulk operations in derived containers.
+    //*********************************************************************
+    lookup_t& get_lookup()
+    {
+      return lookup;
+    }
+
   private:
 
     // Disable copy construction and assignment.
@@ -898,6 +898,14 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Gets the lookup, for bulk operations in derived containers.
+    //*********************************************************************
+    lookup_t& get_lookup()
+    {
+      return lookup;
+    }
+
   private:
 
     // Disable copy construction.
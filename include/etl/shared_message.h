@@ -103,15 +103,20 @@ namespace etl
     {
       if (&other != this)
       {
-        // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
+        // Deal with the current message, if it has not been moved from.
+        if ((p_rcmessage != ETL_NULLPTR) &&
+            (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
         {
           p_rcmessage->release();
         }
 
         // Copy over the new one.
         p_rcmessage = other.p_rcmessage;
-        p_rcmessage->get_reference_counter().increment_reference_count();
+
+        if (p_rcmessage != ETL_NULLPTR)
+        {
+          p_rcmessage->get_reference_counter().increment_reference_count();
+        }
        }
 
       return *this;
@@ -125,8 +130,9 @@ namespace etl
     {
       if (&other != this)
       {
-        // Deal with the current message.
-        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
+        // Deal with the current message, if it has not been moved from.
+        if ((p_rcmessage != ETL_NULLPTR) &&
+            (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U))
         {
           p_rcmessage->release();
         }
@@ -0,0 +1,1410 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UNORDERED_FLAT_SET_INCLUDED
+#define ETL_UNORDERED_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "parameter_type.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/unordered_flat_group.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup unordered_flat_set unordered_flat_set
+/// An open addressing unordered_set with the capacity defined at compile time.
+/// The elements are stored directly in a slot array, indexed by a parallel
+/// array of one byte control codes that are probed a group at a time.
+/// Erasing an element never moves other elements, but inserting may rehash
+/// the table in place to reclaim deleted slots, which invalidates iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_exception : public etl::exception
+  {
+  public:
+
+    unordered_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_full : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:full", ETL_UNORDERED_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_out_of_range : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:range", ETL_UNORDERED_FLAT_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the unordered_flat_set.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  class unordered_flat_set_iterator : public etl::unordered_flat_set_exception
+  {
+  public:
+
+    unordered_flat_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::unordered_flat_set_exception(ETL_ERROR_TEXT("unordered_flat_set:iterator", ETL_UNORDERED_FLAT_SET_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized unordered_flat_set.
+  /// Can be used as a reference type for all unordered_flat_set containing a specific type.
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iunordered_flat_set
+  {
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const TKey& key_parameter_t;
+
+  protected:
+
+    typedef etl::private_unordered_flat::ctrl_t ctrl_t;
+    typedef etl::private_unordered_flat::group  group_t;
+
+  public:
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      typedef typename iunordered_flat_set::value_type      value_type;
+      typedef typename iunordered_flat_set::key_type        key_type;
+      typedef typename iunordered_flat_set::hasher          hasher;
+      typedef typename iunordered_flat_set::key_equal       key_equal;
+      typedef typename iunordered_flat_set::reference       reference;
+      typedef typename iunordered_flat_set::const_reference const_reference;
+      typedef typename iunordered_flat_set::pointer         pointer;
+      typedef typename iunordered_flat_set::const_pointer   const_pointer;
+      typedef typename iunordered_flat_set::size_type       size_type;
+
+      friend class iunordered_flat_set;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pctrl(ETL_NULLPTR)
+        , pctrl_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pctrl(other.pctrl)
+        , pctrl_end(other.pctrl_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        const ctrl_t* pnext = etl::private_unordered_flat::next_full(pctrl + 1, pctrl_end);
+
+        pslot += (pnext - pctrl);
+        pctrl  = pnext;
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pctrl     = other.pctrl;
+        pctrl_end = other.pctrl_end;
+        pslot     = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.pctrl == rhs.pctrl;
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(const ctrl_t* pctrl_, const ctrl_t* pctrl_end_, pointer pslot_)
+        : pctrl(pctrl_)
+        , pctrl_end(pctrl_end_)
+        , pslot(pslot_)
+      {
+      }
+
+      const ctrl_t* pctrl;
+      const ctrl_t* pctrl_end;
+      pointer       pslot;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      typedef typename iunordered_flat_set::value_type      value_type;
+      typedef typename iunordered_flat_set::key_type        key_type;
+      typedef typename iunordered_flat_set::hasher          hasher;
+      typedef typename iunordered_flat_set::key_equal       key_equal;
+      typedef typename iunordered_flat_set::reference       reference;
+      typedef typename iunordered_flat_set::const_reference const_reference;
+      typedef typename iunordered_flat_set::pointer         pointer;
+      typedef typename iunordered_flat_set::const_pointer   const_pointer;
+      typedef typename iunordered_flat_set::size_type       size_type;
+
+      friend class iunordered_flat_set;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pctrl(ETL_NULLPTR)
+        , pctrl_end(ETL_NULLPTR)
+        , pslot(ETL_NULLPTR)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iunordered_flat_set::iterator& other)
+        : pctrl(other.pctrl)
+        , pctrl_end(other.pctrl_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pctrl(other.pctrl)
+        , pctrl_end(other.pctrl_end)
+        , pslot(other.pslot)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        const ctrl_t* pnext = etl::private_unordered_flat::next_full(pctrl + 1, pctrl_end);
+
+        pslot += (pnext - pctrl);
+        pctrl  = pnext;
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        operator++();
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pctrl     = other.pctrl;
+        pctrl_end = other.pctrl_end;
+        pslot     = other.pslot;
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return *pslot;
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return pslot;
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.pctrl == rhs.pctrl;
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const ctrl_t* pctrl_, const ctrl_t* pctrl_end_, const_pointer pslot_)
+        : pctrl(pctrl_)
+        , pctrl_end(pctrl_end_)
+        , pslot(pslot_)
+      {
+      }
+
+      const ctrl_t* pctrl;
+      const ctrl_t* pctrl_end;
+      const_pointer pslot;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the unordered_flat_set.
+    ///\return An iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    iterator begin()
+    {
+      const ctrl_t* pfirst = first_full();
+
+      return iterator(pfirst, pctrl + slot_count, pslots + (pfirst - pctrl));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_set.
+    ///\return A const iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      const ctrl_t* pfirst = first_full();
+
+      return const_iterator(pfirst, pctrl + slot_count, pslots + (pfirst - pctrl));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the unordered_flat_set.
+    ///\return A const iterator to the beginning of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the unordered_flat_set.
+    ///\return An iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(pctrl + slot_count, pctrl + slot_count, pslots + slot_count);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_set.
+    ///\return A const iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(pctrl + slot_count, pctrl + slot_count, pslots + slot_count);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the unordered_flat_set.
+    ///\return A const iterator to the end of the unordered_flat_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*********************************************************************
+    /// Returns the number of slots in the table.
+    /// Each slot is a bucket that holds at most one element.
+    ///\return The number of slots in the table.
+    //*********************************************************************
+    size_type bucket_count() const
+    {
+      return slot_count;
+    }
+
+    //*********************************************************************
+    /// Returns the maximum number of slots in the table.
+    ///\return The maximum number of slots in the table.
+    //*********************************************************************
+    size_type max_bucket_count() const
+    {
+      return slot_count;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(unordered_flat_set_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(unordered_flat_set_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key)
+    {
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      const size_t hash  = hash_of(key);
+      size_t       index = find_index(key, hash);
+
+      if (index != slot_count)
+      {
+        result.first = make_iterator(index);
+        return result;
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_set_full), result);
+
+      index = find_insert_index(hash);
+      ::new (pslots + index) value_type(key);
+      commit_insert(index, hash);
+
+      result.first  = make_iterator(index);
+      result.second = true;
+
+      return result;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      ETL_OR_STD::pair<iterator, bool> result(end(), false);
+
+      const size_t hash  = hash_of(key);
+      size_t       index = find_index(key, hash);
+
+      if (index != slot_count)
+      {
+        result.first = make_iterator(index);
+        return result;
+      }
+
+      ETL_ASSERT_AND_RETURN_VALUE(!full(), ETL_ERROR(unordered_flat_set_full), result);
+
+      index = find_insert_index(hash);
+      ::new (pslots + index) value_type(etl::move(key));
+      commit_insert(index, hash);
+
+      result.first  = make_iterator(index);
+      result.second = true;
+
+      return result;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key)
+    {
+      return insert(etl::move(key)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the unordered_flat_set.
+    /// If asserts or exceptions are enabled, emits unordered_flat_set_full if the unordered_flat_set does not have enough free space.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      if (index == slot_count)
+      {
+        return 0U;
+      }
+
+      erase_index(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Iterators to other elements remain valid.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the next element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      const size_t index = static_cast<size_t>(ielement.pctrl - pctrl);
+
+      iterator inext = make_iterator(index);
+      ++inext;
+
+      erase_index(index);
+
+      return inext;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Erasing everything?
+      if ((first_ == begin()) && (last_ == end()))
+      {
+        clear();
+        return end();
+      }
+
+      while (first_ != last_)
+      {
+        first_ = erase(first_);
+      }
+
+      return make_iterator(static_cast<size_t>(last_.pctrl - pctrl));
+    }
+
+    //*************************************************************************
+    /// Clears the unordered_flat_set.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find_index(key, hash_of(key)) == slot_count) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return make_iterator(find_index(key, hash_of(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return make_iterator(find_index(key, hash_of(key)));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    /// The range is defined by two iterators, the first pointing to the first
+    /// element of the wanted range and the second pointing past the last
+    /// element of the range.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the unordered_flat_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the unordered_flat_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return max_elements;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the unordered_flat_set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == max_elements;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_elements - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / bucket_count.
+    ///\return The load factor = size / bucket_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(bucket_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iunordered_flat_set& operator = (const iunordered_flat_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iunordered_flat_set& operator = (iunordered_flat_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iunordered_flat_set(pointer pslots_, ctrl_t* pctrl_, size_t slot_count_, size_t max_elements_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pslots(pslots_)
+      , pctrl(pctrl_)
+      , slot_count(slot_count_)
+      , max_elements(max_elements_)
+      , current_size(0U)
+      , growth_left(etl::private_unordered_flat::get_max_load(slot_count_))
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      etl::private_unordered_flat::reset_ctrl(pctrl, slot_count);
+    }
+
+    //*********************************************************************
+    /// Initialise the unordered_flat_set.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < slot_count; ++i)
+        {
+          if (etl::private_unordered_flat::is_full(pctrl[i]))
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT
+          }
+        }
+      }
+
+      etl::private_unordered_flat::reset_ctrl(pctrl, slot_count);
+
+      current_size = 0U;
+      growth_left  = etl::private_unordered_flat::get_max_load(slot_count);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        iterator temp = first;
+        ++temp;
+        insert(etl::move(*first));
+        first = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Hashes the key and mixes the result.
+    //*********************************************************************
+    size_t hash_of(key_parameter_t key) const
+    {
+      return etl::private_unordered_flat::mix(key_hash_function(key));
+    }
+
+    //*********************************************************************
+    /// Finds the slot index of the key.
+    ///\return The index, or slot_count if the key does not exist.
+    //*********************************************************************
+    size_t find_index(key_parameter_t key, size_t hash) const
+    {
+      const ctrl_t h2 = etl::private_unordered_flat::h2(hash);
+
+      etl::private_unordered_flat::probe_sequence seq(etl::private_unordered_flat::h1(hash), slot_count - 1U);
+
+      while (true)
+      {
+        const group_t g(pctrl + seq.offset());
+
+        typename group_t::mask_type matches = g.match(h2);
+
+        while (matches.any())
+        {
+          const size_t index = seq.offset(matches.lowest());
+
+          if (key_equal_function(pslots[index], key))
+          {
+            return index;
+          }
+
+          matches.clear_lowest();
+        }
+
+        // An empty slot ends the probe sequence.
+        if (g.match_empty().any())
+        {
+          return slot_count;
+        }
+
+        seq.next();
+      }
+    }
+
+    //*********************************************************************
+    /// Finds the slot for a new element.
+    /// Reclaims the deleted slots if there is no room left for growth.
+    //*********************************************************************
+    size_t find_insert_index(size_t hash)
+    {
+      const size_t h1 = etl::private_unordered_flat::h1(hash);
+
+      size_t index = etl::private_unordered_flat::find_first_non_full(pctrl, slot_count - 1U, h1);
+
+      if ((growth_left == 0U) && (pctrl[index] != etl::private_unordered_flat::Deleted))
+      {
+        drop_deleted();
+        index = etl::private_unordered_flat::find_first_non_full(pctrl, slot_count - 1U, h1);
+      }
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Marks a newly constructed element as occupied.
+    //*********************************************************************
+    void commit_insert(size_t index, size_t hash)
+    {
+      if (pctrl[index] != etl::private_unordered_flat::Deleted)
+      {
+        --growth_left;
+      }
+
+      etl::private_unordered_flat::set_ctrl(pctrl, slot_count, index, etl::private_unordered_flat::h2(hash));
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT
+    }
+
+    //*********************************************************************
+    /// Destroys the element in the slot and marks it as empty or deleted.
+    //*********************************************************************
+    void erase_index(size_t index)
+    {
+      pslots[index].~value_type();
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT
+
+      if (etl::private_unordered_flat::can_mark_empty(pctrl, slot_count - 1U, index))
+      {
+        etl::private_unordered_flat::set_ctrl(pctrl, slot_count, index, etl::private_unordered_flat::Empty);
+        ++growth_left;
+      }
+      else
+      {
+        etl::private_unordered_flat::set_ctrl(pctrl, slot_count, index, etl::private_unordered_flat::Deleted);
+      }
+    }
+
+    //*********************************************************************
+    /// Rehashes the table in place, turning all deleted slots back into empty ones.
+    //*********************************************************************
+    void drop_deleted()
+    {
+      const size_t mask = slot_count - 1U;
+
+      etl::private_unordered_flat::prepare_drop_deleted(pctrl, slot_count);
+
+      // Every 'deleted' control byte now marks an element that must be rehashed.
+      for (size_t i = 0U; i < slot_count; ++i)
+      {
+        if (pctrl[i] != etl::private_unordered_flat::Deleted)
+        {
+          continue;
+        }
+
+        const size_t hash  = hash_of(pslots[i]);
+        const size_t h1    = etl::private_unordered_flat::h1(hash);
+        const ctrl_t h2    = etl::private_unordered_flat::h2(hash);
+        const size_t new_i = etl::private_unordered_flat::find_first_non_full(pctrl, mask, h1);
+
+        if (etl::private_unordered_flat::probe_index(new_i, mask, h1) == etl::private_unordered_flat::probe_index(i, mask, h1))
+        {
+          // Already in the right group.
+          etl::private_unordered_flat::set_ctrl(pctrl, slot_count, i, h2);
+        }
+        else if (pctrl[new_i] == etl::private_unordered_flat::Empty)
+        {
+          // Move to the empty slot.
+          etl::private_unordered_flat::set_ctrl(pctrl, slot_count, new_i, h2);
+          ::new (pslots + new_i) value_type(ETL_MOVE(pslots[i]));
+          pslots[i].~value_type();
+          etl::private_unordered_flat::set_ctrl(pctrl, slot_count, i, etl::private_unordered_flat::Empty);
+        }
+        else
+        {
+          // Swap with the element still to be rehashed, then rehash that one in this slot.
+          etl::private_unordered_flat::set_ctrl(pctrl, slot_count, new_i, h2);
+
+          etl::uninitialized_buffer_of<value_type, 1U> temp;
+          ::new (&temp[0]) value_type(ETL_MOVE(pslots[i]));
+          pslots[i].~value_type();
+          ::new (pslots + i) value_type(ETL_MOVE(pslots[new_i]));
+          pslots[new_i].~value_type();
+          ::new (pslots + new_i) value_type(ETL_MOVE(temp[0]));
+          temp[0].~value_type();
+
+          --i;
+        }
+      }
+
+      growth_left = etl::private_unordered_flat::get_max_load(slot_count) - current_size;
+    }
+
+    //*********************************************************************
+    /// The first occupied control byte, or the end.
+    //*********************************************************************
+    const ctrl_t* first_full() const
+    {
+      return empty() ? (pctrl + slot_count) : etl::private_unordered_flat::next_full(pctrl, pctrl + slot_count);
+    }
+
+    //*********************************************************************
+    /// Makes an iterator for the slot index.
+    //*********************************************************************
+    iterator make_iterator(size_t index)
+    {
+      return iterator(pctrl + index, pctrl + slot_count, pslots + index);
+    }
+
+    //*********************************************************************
+    /// Makes a const_iterator for the slot index.
+    //*********************************************************************
+    const_iterator make_iterator(size_t index) const
+    {
+      return const_iterator(pctrl + index, pctrl + slot_count, pslots + index);
+    }
+
+    // Disable copy construction.
+    iunordered_flat_set(const iunordered_flat_set&);
+
+    /// The element slots.
+    pointer pslots;
+
+    /// The control bytes.
+    ctrl_t* pctrl;
+
+    /// The number of slots. Always a power of two.
+    const size_t slot_count;
+
+    /// The maximum number of elements.
+    const size_t max_elements;
+
+    /// The current number of elements.
+    size_t current_size;
+
+    /// The number of empty slots that may still be filled before deleted slots must be reclaimed.
+    size_t growth_left;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_UNORDERED_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iunordered_flat_set()
+    {
+    }
+#else
+  protected:
+    ~iunordered_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first unordered_flat_set.
+  ///\param rhs Reference to the second unordered_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& lhs, const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    typedef typename etl::iunordered_flat_set<TKey, THash, TKeyEqual>::const_iterator const_iterator;
+
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    for (const_iterator itr = lhs.begin(); itr != lhs.end(); ++itr)
+    {
+      if (rhs.find(*itr) == rhs.end())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first unordered_flat_set.
+  ///\param rhs Reference to the second unordered_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup unordered_flat_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& lhs, const etl::iunordered_flat_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated unordered_flat_set implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_set : public etl::iunordered_flat_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t SLOT_COUNT = etl::unordered_flat_buffer_size<MAX_SIZE_>::Slot_Count;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    unordered_flat_set(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, ctrl, SLOT_COUNT, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_set(const unordered_flat_set& other)
+      : base(slots, ctrl, SLOT_COUNT, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_set(unordered_flat_set&& other)
+      : base(slots, ctrl, SLOT_COUNT, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_set(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, ctrl, SLOT_COUNT, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    unordered_flat_set(std::initializer_list<TKey> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(slots, ctrl, SLOT_COUNT, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_set& operator = (const unordered_flat_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_set& operator = (unordered_flat_set&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The element slots.
+    etl::uninitialized_buffer_of<typename base::value_type, SLOT_COUNT> slots;
+
+    /// The control bytes.
+    etl::private_unordered_flat::ctrl_t ctrl[etl::unordered_flat_buffer_size<MAX_SIZE_>::Control_Count];
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_set<TKey, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t unordered_flat_set<TKey, MAX_SIZE_, THash, TKeyEqual>::SLOT_COUNT;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... T>
+  unordered_flat_set(T...) -> unordered_flat_set<etl::nth_type_t<0, T...>, sizeof...(T)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... T>
+  constexpr auto make_unordered_flat_set(T&&... keys) -> etl::unordered_flat_set<TKey, sizeof...(T), THash, TKeyEqual>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+#endif
+
+  //*************************************************************************
+  /// An unordered_flat_set that uses external buffers.
+  /// The slot buffer must hold etl::unordered_flat_buffer_size<MAX_SIZE>::Slot_Count
+  /// elements of value_type and the control buffer must hold
+  /// etl::unordered_flat_buffer_size<MAX_SIZE>::Control_Count bytes.
+  //*************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class unordered_flat_set_ext : public etl::iunordered_flat_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iunordered_flat_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param slot_buffer    The buffer for the elements.
+    ///\param control_buffer The buffer for the control bytes.
+    ///\param max_size       The maximum number of elements.
+    //*************************************************************************
+    unordered_flat_set_ext(void* slot_buffer, void* control_buffer, size_t max_size, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::pointer>(slot_buffer),
+             reinterpret_cast<etl::private_unordered_flat::ctrl_t*>(control_buffer),
+             etl::private_unordered_flat::get_slot_count(max_size),
+             max_size,
+             hash,
+             equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    unordered_flat_set_ext(const unordered_flat_set_ext& other, void* slot_buffer, void* control_buffer, size_t max_size)
+      : base(reinterpret_cast<typename base::pointer>(slot_buffer),
+             reinterpret_cast<etl::private_unordered_flat::ctrl_t*>(control_buffer),
+             etl::private_unordered_flat::get_slot_count(max_size),
+             max_size,
+             other.hash_function(),
+             other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    unordered_flat_set_ext(unordered_flat_set_ext&& other, void* slot_buffer, void* control_buffer, size_t max_size)
+      : base(reinterpret_cast<typename base::pointer>(slot_buffer),
+             reinterpret_cast<etl::private_unordered_flat::ctrl_t*>(control_buffer),
+             etl::private_unordered_flat::get_slot_count(max_size),
+             max_size,
+             other.hash_function(),
+             other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    unordered_flat_set_ext(TIterator first_, TIterator last_, void* slot_buffer, void* control_buffer, size_t max_size, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(reinterpret_cast<typename base::pointer>(slot_buffer),
+             reinterpret_cast<etl::private_unordered_flat::ctrl_t*>(control_buffer),
+             etl::private_unordered_flat::get_slot_count(max_size),
+             max_size,
+             hash,
+             equal)
+    {
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~unordered_flat_set_ext()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    unordered_flat_set_ext& operator = (const unordered_flat_set_ext& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    unordered_flat_set_ext& operator = (unordered_flat_set_ext&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    unordered_flat_set_ext(const unordered_flat_set_ext&) ETL_DELETE;
+  };
+}
+
+#endif
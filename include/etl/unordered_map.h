@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/bucket_occupancy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -173,6 +175,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy<bucket_t> occupancy_t;
 
   public:
 
@@ -206,7 +209,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -220,15 +223,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -248,7 +247,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -287,8 +286,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -318,7 +317,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -349,7 +348,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_map::iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -357,7 +356,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -371,15 +370,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -399,7 +394,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -438,8 +433,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      const_iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -469,7 +464,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -482,7 +477,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -491,7 +486,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -500,7 +495,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -536,7 +531,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -545,7 +540,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -554,7 +549,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -791,7 +786,7 @@ namespace etl
 
         adjust_first_last_markers_after_insert(pbucket);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first = iterator(&occupancy, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -825,7 +820,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first = iterator(&occupancy, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -867,7 +862,7 @@ namespace etl
 
         adjust_first_last_markers_after_insert(pbucket);
 
-        result.first = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result.first = iterator(&occupancy, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -901,7 +896,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+          result.first = iterator(&occupancy, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -994,7 +989,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(&occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -1063,10 +1058,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = occupancy.next(pbucket);
 
             iprevious = pbucket->before_begin();
             icurrent  = pbucket->begin();
@@ -1074,7 +1066,7 @@ namespace etl
         }
       }
 
-      return iterator((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      return iterator(&occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
     }
 
     //*************************************************************************
@@ -1119,7 +1111,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1153,7 +1145,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1320,10 +1312,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
+    iunordered_map(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::private_unordered::occupancy_word_t* poccupancy_words_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , occupancy(pbuckets_, number_of_buckets_, poccupancy_words_)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1338,27 +1331,30 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0UL; i < number_of_buckets; ++i)
+        if (occupancy.is_dense())
         {
-          bucket_t& bucket = pbuckets[i];
-
-          if (!bucket.empty())
+          // Most buckets are in use, so step through all of them.
+          for (bucket_t* pbucket = pbuckets; pbucket != occupancy.end(); ++pbucket)
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (!pbucket->empty())
             {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ETL_DECREMENT_DEBUG_COUNT
-
-              ++it;
+              clear_bucket(*pbucket);
             }
+          }
 
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+          occupancy.reset_all();
+        }
+        else
+        {
+          // For each non-empty bucket...
+          bucket_t* pbucket = occupancy.first();
+
+          while (pbucket != occupancy.end())
+          {
+            clear_bucket(*pbucket);
+            occupancy.reset(pbucket);
+
+            pbucket = occupancy.next(pbucket);
           }
         }
 
@@ -1370,6 +1366,28 @@ namespace etl
       last  = first;
     }
 
+    //*********************************************************************
+    /// Destroys the values in a bucket and clears it.
+    /// The nodes are not released to the pool.
+    //*********************************************************************
+    void clear_bucket(bucket_t& bucket)
+    {
+      // For each item in the bucket...
+      local_iterator it = bucket.begin();
+
+      while (it != bucket.end())
+      {
+        // Destroy the value contents.
+        it->key_value_pair.~value_type();
+        ETL_DECREMENT_DEBUG_COUNT
+
+        ++it;
+      }
+
+      // Now it's safe to clear the bucket.
+      bucket.clear();
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Move from a range
@@ -1402,6 +1420,8 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy.set(pbucket);
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1425,6 +1445,11 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pbucket)
     {
+      if (pbucket->empty())
+      {
+        occupancy.reset(pbucket);
+      }
+
       if (empty())
       {
         first = pbuckets;
@@ -1432,31 +1457,15 @@ namespace etl
       }
       else
       {
-        if (pbucket == first)
+        if ((pbucket == first) && first->empty())
         {
-          // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          // We emptied the first, so find the next non-empty one.
+          first = occupancy.next(first);
         }
-        else if (pbucket == last)
+        else if ((pbucket == last) && last->empty())
         {
-          // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pcurrent = first;
-          bucket_t* pend = last;
-
-          last = first;
-
-          while (pcurrent != pend)
-          {
-            if (!pcurrent->empty())
-            {
-              last = pcurrent;
-            }
-
-            ++pcurrent;
-          }
+          // We emptied the last, so find the previous non-empty one.
+          last = occupancy.previous(last);
         }
       }
     }
@@ -1473,6 +1482,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The buckets that are not empty.
+    occupancy_t occupancy;
+
     /// The first and last pointers to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1561,7 +1573,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, hash, equal)
     {
     }
 
@@ -1569,7 +1581,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_map(const unordered_map& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, other.hash_function(), other.key_eq())
     {
       base::assign(other.cbegin(), other.cend());
     }
@@ -1579,7 +1591,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_map(unordered_map&& other)
-      : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, other.hash_function(), other.key_eq())
     {
       if (this != &other)
       {
@@ -1596,7 +1608,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1606,7 +1618,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1647,6 +1659,9 @@ namespace etl
 
     /// The buckets of node lists.
     typename base::bucket_t buckets[MAX_BUCKETS_];
+
+    /// The occupancy bitmap of the buckets.
+    etl::private_unordered::occupancy_word_t occupancy_words[etl::private_unordered::bucket_occupancy_size<MAX_BUCKETS_>::value];
   };
 
   //*************************************************************************
@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/bucket_occupancy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -173,6 +175,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy<bucket_t> occupancy_t;
 
   public:
 
@@ -206,7 +209,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -220,15 +223,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -248,7 +247,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -287,8 +286,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -318,7 +317,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -349,7 +348,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_multimap::iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -357,7 +356,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -371,16 +370,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -400,7 +394,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -439,8 +433,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      const_iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -470,7 +464,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -483,7 +477,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator((pbuckets + number_of_buckets), first, first->begin());
+      return iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -492,7 +486,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -501,7 +495,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator((pbuckets + number_of_buckets), first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -537,7 +531,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator((pbuckets + number_of_buckets), last, last->end());
+      return iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -546,7 +540,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -555,7 +549,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator((pbuckets + number_of_buckets), last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -680,7 +674,7 @@ namespace etl
         bucket.insert_after(bucket.before_begin(), node);
         adjust_first_last_markers_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(&occupancy, pbucket, pbucket->begin());
       }
       else
       {
@@ -710,7 +704,7 @@ namespace etl
         adjust_first_last_markers_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(&occupancy, pbucket, inode_previous);
       }
 
       return result;
@@ -749,7 +743,7 @@ namespace etl
           bucket.insert_after(bucket.before_begin(), node);
         adjust_first_last_markers_after_insert(pbucket);
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, pbucket->begin());
+        result = iterator(&occupancy, pbucket, pbucket->begin());
       }
       else
       {
@@ -779,7 +773,7 @@ namespace etl
         adjust_first_last_markers_after_insert(&bucket);
         ++inode_previous;
 
-        result = iterator((pbuckets + number_of_buckets), pbucket, inode_previous);
+        result = iterator(&occupancy, pbucket, inode_previous);
       }
 
       return result;
@@ -872,7 +866,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(&occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -911,7 +905,7 @@ namespace etl
       }
 
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(&occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket     = first_.get_bucket_list_iterator();
@@ -945,10 +939,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = occupancy.next(pbucket);
 
             iprevious = pbucket->before_begin();
             icurrent  = pbucket->begin();
@@ -1017,7 +1008,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1051,7 +1042,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
-            return const_iterator((pbuckets + number_of_buckets), pbucket, inode);
+            return const_iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1229,10 +1220,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
+    iunordered_multimap(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::private_unordered::occupancy_word_t* poccupancy_words_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , occupancy(pbuckets_, number_of_buckets_, poccupancy_words_)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1247,26 +1239,30 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0UL; i < number_of_buckets; ++i)
+        if (occupancy.is_dense())
         {
-          bucket_t& bucket = pbuckets[i];
-
-          if (!bucket.empty())
+          // Most buckets are in use, so step through all of them.
+          for (bucket_t* pbucket = pbuckets; pbucket != occupancy.end(); ++pbucket)
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (!pbucket->empty())
             {
-              // Destroy the value contents.
-              it->key_value_pair.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
+              clear_bucket(*pbucket);
             }
+          }
 
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+          occupancy.reset_all();
+        }
+        else
+        {
+          // For each non-empty bucket...
+          bucket_t* pbucket = occupancy.first();
+
+          while (pbucket != occupancy.end())
+          {
+            clear_bucket(*pbucket);
+            occupancy.reset(pbucket);
+
+            pbucket = occupancy.next(pbucket);
           }
         }
 
@@ -1278,6 +1274,27 @@ namespace etl
       last  = first;
     }
 
+    //*********************************************************************
+    /// Destroys the values in a bucket and clears it.
+    /// The nodes are not released to the pool.
+    //*********************************************************************
+    void clear_bucket(bucket_t& bucket)
+    {
+      // For each item in the bucket...
+      local_iterator it = bucket.begin();
+
+      while (it != bucket.end())
+      {
+        // Destroy the value contents.
+        it->key_value_pair.~value_type();
+        ++it;
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+
+      // Now it's safe to clear the bucket.
+      bucket.clear();
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Move from a range
@@ -1310,6 +1327,8 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy.set(pbucket);
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1333,38 +1352,27 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pcurrent)
     {
+      if (pcurrent->empty())
+      {
+        occupancy.reset(pcurrent);
+      }
+
       if (empty())
       {
         first = pbuckets;
-        last = pbuckets;
+        last  = pbuckets;
       }
       else
       {
-        if (pcurrent == first)
+        if ((pcurrent == first) && first->empty())
         {
-          // We erased the first so, we need to search again from where we erased.
-          while (first->empty())
-          {
-            ++first;
-          }
+          // We emptied the first, so find the next non-empty one.
+          first = occupancy.next(first);
         }
-        else if (pcurrent == last)
+        else if ((pcurrent == last) && last->empty())
         {
-          // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-          bucket_t* pcurrent = first;
-          bucket_t* pend = last;
-
-          last = first;
-
-          while (pcurrent != pend)
-          {
-            if (!pcurrent->empty())
-            {
-              last = pcurrent;
-            }
-
-            ++pcurrent;
-          }
+          // We emptied the last, so find the previous non-empty one.
+          last = occupancy.previous(last);
         }
       }
     }
@@ -1381,6 +1389,9 @@ namespace etl
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The buckets that are not empty.
+    occupancy_t occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1469,7 +1480,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     unordered_multimap(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, hash, equal)
     {
     }
 
@@ -1477,7 +1488,7 @@ namespace etl
     /// Copy constructor.
     //*************************************************************************
     unordered_multimap(const unordered_multimap& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, other.hash_function(), other.key_eq())
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1491,7 +1502,7 @@ namespace etl
     /// Move constructor.
     //*************************************************************************
     unordered_multimap(unordered_multimap&& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, other.hash_function(), other.key_eq())
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1509,7 +1520,7 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     unordered_multimap(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1519,7 +1530,7 @@ namespace etl
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_multimap(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS_, occupancy_words, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1562,6 +1573,9 @@ namespace etl
 
     /// The buckets of node lists.
     typename base::bucket_t buckets[MAX_BUCKETS_];
+
+    /// The occupancy bitmap of the buckets.
+    etl::private_unordered::occupancy_word_t occupancy_words[etl::private_unordered::bucket_occupancy_size<MAX_BUCKETS_>::value];
   };
 
   //*************************************************************************
@@ -52,6 +52,8 @@ SOFTWARE.
 #include "placement_new.h"
 #include "initializer_list.h"
 
+#include "private/bucket_occupancy.h"
+
 #include <stddef.h>
 
 //*****************************************************************************
@@ -170,6 +172,7 @@ namespace etl
 
     typedef etl::intrusive_forward_list<node_t, link_t> bucket_t;
     typedef etl::ipool pool_t;
+    typedef etl::private_unordered::bucket_occupancy<bucket_t> occupancy_t;
 
   public:
 
@@ -202,7 +205,7 @@ namespace etl
 
       //*********************************
       iterator(const iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -216,15 +219,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -244,7 +243,7 @@ namespace etl
       //*********************************
       iterator& operator =(const iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -283,8 +282,8 @@ namespace etl
     private:
 
       //*********************************
-      iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -314,7 +313,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator       inode;
     };
@@ -344,7 +343,7 @@ namespace etl
 
       //*********************************
       const_iterator(const typename iunordered_set::iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -352,7 +351,7 @@ namespace etl
 
       //*********************************
       const_iterator(const const_iterator& other)
-        : pbuckets_end(other.pbuckets_end)
+        : poccupancy(other.poccupancy)
         , pbucket(other.pbucket)
         , inode(other.inode)
       {
@@ -366,16 +365,11 @@ namespace etl
         // The end of this node list?
         if (inode == pbucket->end())
         {
-          // Search for the next non-empty bucket.
-
-          ++pbucket;
-          while ((pbucket != pbuckets_end) && (pbucket->empty()))
-          {
-            ++pbucket;
-          }
+          // Find the next non-empty bucket.
+          pbucket = poccupancy->next(pbucket);
 
           // If not past the end, get the first node in the bucket.
-          if (pbucket != pbuckets_end)
+          if (pbucket != poccupancy->end())
           {
             inode = pbucket->begin();
           }
@@ -395,7 +389,7 @@ namespace etl
       //*********************************
       const_iterator& operator =(const const_iterator& other)
       {
-        pbuckets_end = other.pbuckets_end;
+        poccupancy = other.poccupancy;
         pbucket = other.pbucket;
         inode = other.inode;
         return *this;
@@ -434,8 +428,8 @@ namespace etl
     private:
 
       //*********************************
-      const_iterator(bucket_t* pbuckets_end_, bucket_t* pbucket_, local_iterator inode_)
-        : pbuckets_end(pbuckets_end_)
+      const_iterator(const occupancy_t* poccupancy_, bucket_t* pbucket_, local_iterator inode_)
+        : poccupancy(poccupancy_)
         , pbucket(pbucket_)
         , inode(inode_)
       {
@@ -465,7 +459,7 @@ namespace etl
         return inode;
       }
 
-      bucket_t* pbuckets_end;
+      const occupancy_t* poccupancy;
       bucket_t* pbucket;
       local_iterator inode;
     };
@@ -478,7 +472,7 @@ namespace etl
     //*********************************************************************
     iterator begin()
     {
-      return iterator(pbuckets + number_of_buckets, first, first->begin());
+      return iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -487,7 +481,7 @@ namespace etl
     //*********************************************************************
     const_iterator begin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -496,7 +490,7 @@ namespace etl
     //*********************************************************************
     const_iterator cbegin() const
     {
-      return const_iterator(pbuckets + number_of_buckets, first, first->begin());
+      return const_iterator(&occupancy, first, first->begin());
     }
 
     //*********************************************************************
@@ -532,7 +526,7 @@ namespace etl
     //*********************************************************************
     iterator end()
     {
-      return iterator(pbuckets + number_of_buckets, last, last->end());
+      return iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -541,7 +535,7 @@ namespace etl
     //*********************************************************************
     const_iterator end() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -550,7 +544,7 @@ namespace etl
     //*********************************************************************
     const_iterator cend() const
     {
-      return const_iterator(pbuckets + number_of_buckets, last, last->end());
+      return const_iterator(&occupancy, last, last->end());
     }
 
     //*********************************************************************
@@ -673,7 +667,7 @@ namespace etl
         bucket.insert_after(bucket.before_begin(), node);
         adjust_first_last_markers_after_insert(&bucket);
 
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.first = iterator(&occupancy, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -707,7 +701,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.first = iterator(&occupancy, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -746,7 +740,7 @@ namespace etl
           bucket.insert_after(bucket.before_begin(), node);
         adjust_first_last_markers_after_insert(&bucket);
 
-        result.first = iterator(pbuckets + number_of_buckets, pbucket, pbucket->begin());
+        result.first = iterator(&occupancy, pbucket, pbucket->begin());
         result.second = true;
       }
       else
@@ -780,7 +774,7 @@ namespace etl
           adjust_first_last_markers_after_insert(&bucket);
           ++inode_previous;
 
-          result.first = iterator(pbuckets + number_of_buckets, pbucket, inode_previous);
+          result.first = iterator(&occupancy, pbucket, inode_previous);
           result.second = true;
         }
       }
@@ -873,7 +867,7 @@ namespace etl
     iterator erase(const_iterator ielement)
     {
       // Make a note of the next one.
-      iterator inext((pbuckets + number_of_buckets), ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
+      iterator inext(&occupancy, ielement.get_bucket_list_iterator(), ielement.get_local_iterator());
       ++inext;
 
       bucket_t&      bucket = ielement.get_bucket();
@@ -912,7 +906,7 @@ namespace etl
       }
 
       // Make a note of the last.
-      iterator result((pbuckets + number_of_buckets), last_.get_bucket_list_iterator(), last_.get_local_iterator());
+      iterator result(&occupancy, last_.get_bucket_list_iterator(), last_.get_local_iterator());
 
       // Get the starting point.
       bucket_t*      pbucket     = first_.get_bucket_list_iterator();
@@ -946,10 +940,7 @@ namespace etl
           if ((icurrent == pbucket->end()))
           {
             // Find the next non-empty one.
-            do
-            {
-              ++pbucket;
-            } while (pbucket->empty());
+            pbucket = occupancy.next(pbucket);
 
             iprevious = pbucket->before_begin();
             icurrent  = pbucket->begin();
@@ -1002,7 +993,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key))
           {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+            return iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1036,7 +1027,7 @@ namespace etl
           // Do we have this one?
           if (key_equal_function(key, inode->key))
           {
-            return iterator(pbuckets + number_of_buckets, pbucket, inode);
+            return iterator(&occupancy, pbucket, inode);
           }
 
           ++inode;
@@ -1204,10 +1195,11 @@ namespace etl
     //*********************************************************************
     /// Constructor.
     //*********************************************************************
-    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, hasher key_hash_function_, key_equal key_equal_function_)
+    iunordered_set(pool_t& node_pool_, bucket_t* pbuckets_, size_t number_of_buckets_, etl::private_unordered::occupancy_word_t* poccupancy_words_, hasher key_hash_function_, key_equal key_equal_function_)
       : pnodepool(&node_pool_)
       , pbuckets(pbuckets_)
       , number_of_buckets(number_of_buckets_)
+      , occupancy(pbuckets_, number_of_buckets_, poccupancy_words_)
       , first(pbuckets)
       , last(pbuckets)
       , key_hash_function(key_hash_function_)
@@ -1222,26 +1214,30 @@ namespace etl
     {
       if (!empty())
       {
-        // For each bucket...
-        for (size_t i = 0UL; i < number_of_buckets; ++i)
+        if (occupancy.is_dense())
         {
-          bucket_t& bucket = pbuckets[i];
-
-          if (!bucket.empty())
+          // Most buckets are in use, so step through all of them.
+          for (bucket_t* pbucket = pbuckets; pbucket != occupancy.end(); ++pbucket)
           {
-            // For each item in the bucket...
-            local_iterator it = bucket.begin();
-
-            while (it != bucket.end())
+            if (!pbucket->empty())
             {
-              // Destroy the value contents.
-              it->key.~value_type();
-              ++it;
-              ETL_DECREMENT_DEBUG_COUNT
+              clear_bucket(*pbucket);
             }
+          }
+
+          occupancy.reset_all();
+        }
+        else
+        {
+          // For each non-empty bucket...
+          bucket_t* pbucket = occupancy.first();
 
-            // Now it's safe to clear the bucket.
-            bucket.clear();
+          while (pbucket != occupancy.end())
+          {
+            clear_bucket(*pbucket);
+            occupancy.reset(pbucket);
+
+            pbucket = occupancy.next(pbucket);
           }
         }
 
@@ -1253,6 +1249,27 @@ namespace etl
       last  = first;
     }
 
+    //*********************************************************************
+    /// Destroys the values in a bucket and clears it.
+    /// The nodes are not released to the pool.
+    //*********************************************************************
+    void clear_bucket(bucket_t& bucket)
+    {
+      // For each item in the bucket...
+      local_iterator it = bucket.begin();
+
+      while (it != bucket.end())
+      {
+        // Destroy the value contents.
+        it->key.~value_type();
+        ++it;
+        ETL_DECREMENT_DEBUG_COUNT
+      }
+
+      // Now it's safe to clear the bucket.
+      bucket.clear();
+    }
+
 #if ETL_USING_CPP11
     //*************************************************************************
     /// Move from a range
@@ -1291,6 +1308,8 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_insert(bucket_t* pbucket)
     {
+      occupancy.set(pbucket);
+
       if (size() == 1)
       {
         first = pbucket;
@@ -1314,40 +1333,29 @@ namespace etl
     //*********************************************************************
     void adjust_first_last_markers_after_erase(bucket_t* pcurrent)
     {
-if (empty())
-{
-  first = pbuckets;
-  last = pbuckets;
-}
-else
-{
-  if (pcurrent == first)
-  {
-    // We erased the first so, we need to search again from where we erased.
-    while (first->empty())
-    {
-      ++first;
-    }
-  }
-  else if (pcurrent == last)
-  {
-    // We erased the last, so we need to search again. Start from the first, go no further than the current last.
-    bucket_t* pcurrent = first;
-    bucket_t* pend = last;
-
-    last = first;
-
-    while (pcurrent != pend)
-    {
-      if (!pcurrent->empty())
+      if (pcurrent->empty())
       {
-        last = pcurrent;
+        occupancy.reset(pcurrent);
       }
 
-      ++pcurrent;
-    }
-  }
-}
+      if (empty())
+      {
+        first = pbuckets;
+        last  = pbuckets;
+      }
+      else
+      {
+        if ((pcurrent == first) && first->empty())
+        {
+          // We emptied the first, so find the next non-empty one.
+          first = occupancy.next(first);
+        }
+        else if ((pcurrent == last) && last->empty())
+        {
+          // We emptied the last, so find the previous non-empty one.
+          last = occupancy.previous(last);
+        }
+      }
     }
 
     // Disable copy construction.
@@ -1362,6 +1370,9 @@ else
     /// The number of buckets.
     const size_t number_of_buckets;
 
+    /// The buckets that are not empty.
+    occupancy_t occupancy;
+
     /// The first and last iterators to buckets with values.
     bucket_t* first;
     bucket_t* last;
@@ -1450,7 +1461,7 @@ else
     /// Default constructor.
     //*************************************************************************
     unordered_set(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, hash, equal)
     {
     }
 
@@ -1458,7 +1469,7 @@ else
     /// Copy constructor.
     //*************************************************************************
     unordered_set(const unordered_set& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, other.hash_function(), other.key_eq())
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1472,7 +1483,7 @@ else
     /// Move constructor.
     //*************************************************************************
     unordered_set(unordered_set&& other)
-      : base(node_pool, buckets, MAX_BUCKETS, other.hash_function(), other.key_eq())
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, other.hash_function(), other.key_eq())
     {
       // Skip if doing self assignment
       if (this != &other)
@@ -1490,7 +1501,7 @@ else
     //*************************************************************************
     template <typename TIterator>
     unordered_set(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, hash, equal)
     {
       base::assign(first_, last_);
     }
@@ -1500,7 +1511,7 @@ else
     /// Construct from initializer_list.
     //*************************************************************************
     unordered_set(std::initializer_list<TKey> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
-      : base(node_pool, buckets, MAX_BUCKETS, hash, equal)
+      : base(node_pool, buckets, MAX_BUCKETS, occupancy_words, hash, equal)
     {
       base::assign(init.begin(), init.end());
     }
@@ -1543,6 +1554,9 @@ else
 
     /// The buckets of node lists.
     typename base::bucket_t buckets[MAX_BUCKETS_];
+
+    /// The occupancy bitmap of the buckets.
+    etl::private_unordered::occupancy_word_t occupancy_words[etl::private_unordered::bucket_occupancy_size<MAX_BUCKETS_>::value];
   };
 
   //*************************************************************************
@@ -0,0 +1,368 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "iterator.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+  #include <intrin.h>
+#endif
+
+#if ETL_USING_64BIT_TYPES
+
+///\defgroup wyhash wyhash 64 & 32 bit hash calculations
+/// A fast non-cryptographic hash that consumes the input eight bytes at a time.
+/// Compatible with the reference wyhash (final version 4) with the default secret.
+/// See https://github.com/wangyi-fudan/wyhash for more details.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    static ETL_CONSTANT uint64_t SECRET0 = 0x2D358DCCAA6C78A5ULL;
+    static ETL_CONSTANT uint64_t SECRET1 = 0x8BB84B93962EACC9ULL;
+    static ETL_CONSTANT uint64_t SECRET2 = 0x4B33A62ED433D4A3ULL;
+    static ETL_CONSTANT uint64_t SECRET3 = 0x4D5A2DA51DE1AA47ULL;
+
+    //*************************************************************************
+    /// Multiplies a and b to 128 bits.
+    /// Returns the low half in a and the high half in b.
+    //*************************************************************************
+    inline void multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t r = uint128_t(a) * b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+#elif defined(ETL_COMPILER_MICROSOFT) && defined(_M_X64)
+      a = _umul128(a, b, &b);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+      const uint64_t t   = rl + (rm0 << 32U);
+
+      uint64_t lo = t + (rm1 << 32U);
+      uint64_t hi = rh + (rm0 >> 32U) + (rm1 >> 32U) + (t < rl ? 1U : 0U) + (lo < t ? 1U : 0U);
+
+      a = lo;
+      b = hi;
+#endif
+    }
+
+    //*************************************************************************
+    /// Folds the 128 bit product of a and b to 64 bits.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit value.
+    //*************************************************************************
+    inline uint64_t read64(const uint8_t* p)
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      uint64_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+#else
+      return  uint64_t(p[0])         | (uint64_t(p[1]) << 8U)  | (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U) |
+             (uint64_t(p[4]) << 32U) | (uint64_t(p[5]) << 40U) | (uint64_t(p[6]) << 48U) | (uint64_t(p[7]) << 56U);
+#endif
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 32 bit value.
+    //*************************************************************************
+    inline uint64_t read32(const uint8_t* p)
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+#else
+      return uint64_t(p[0]) | (uint64_t(p[1]) << 8U) | (uint64_t(p[2]) << 16U) | (uint64_t(p[3]) << 24U);
+#endif
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read3(const uint8_t* p, size_t length)
+    {
+      return (uint64_t(p[0]) << 16U) | (uint64_t(p[length >> 1U]) << 8U) | uint64_t(p[length - 1U]);
+    }
+
+    //*************************************************************************
+    /// Calculates the 64 bit hash of length bytes.
+    //*************************************************************************
+    inline uint64_t calculate(const uint8_t* p, size_t length, uint64_t seed)
+    {
+      seed ^= mix(seed ^ SECRET0, SECRET1);
+
+      uint64_t a;
+      uint64_t b;
+
+      if (length <= 16U)
+      {
+        if (length >= 4U)
+        {
+          // Two overlapping pairs of 32 bit reads cover 4 to 16 bytes.
+          const size_t offset = (length >> 3U) << 2U;
+
+          a = (read32(p) << 32U) | read32(p + offset);
+          b = (read32(p + length - 4U) << 32U) | read32(p + length - 4U - offset);
+        }
+        else if (length > 0U)
+        {
+          a = read3(p, length);
+          b = 0U;
+        }
+        else
+        {
+          a = 0U;
+          b = 0U;
+        }
+      }
+      else
+      {
+        size_t remaining = length;
+
+        if (remaining >= 48U)
+        {
+          // Three independent lanes.
+          uint64_t seed1 = seed;
+          uint64_t seed2 = seed;
+
+          do
+          {
+            seed  = mix(read64(p)      ^ SECRET1, read64(p + 8U)  ^ seed);
+            seed1 = mix(read64(p + 16U) ^ SECRET2, read64(p + 24U) ^ seed1);
+            seed2 = mix(read64(p + 32U) ^ SECRET3, read64(p + 40U) ^ seed2);
+
+            p         += 48U;
+            remaining -= 48U;
+          } while (remaining >= 48U);
+
+          seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16U)
+        {
+          seed = mix(read64(p) ^ SECRET1, read64(p + 8U) ^ seed);
+
+          p         += 16U;
+          remaining -= 16U;
+        }
+
+        // The last 16 bytes, which may overlap those already consumed.
+        a = read64(p + remaining - 16U);
+        b = read64(p + remaining - 8U);
+      }
+
+      a ^= SECRET1;
+      b ^= seed;
+      multiply(a, b);
+
+      return mix(a ^ SECRET0 ^ length, b ^ SECRET1);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash of a contiguous range of bytes.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash_64
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Constructor from a buffer.
+    /// \param data   Start of the buffer.
+    /// \param length The length of the buffer in bytes.
+    /// \param seed   The seed value. Default = 0.
+    //*************************************************************************
+    wyhash_64(const void* data, size_t length, value_type seed = 0U)
+      : hash(calculate(data, length, seed))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// The range must be contiguous.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    wyhash_64(TIterator begin, const TIterator end, value_type seed = 0U)
+      : hash(0U)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      const size_t length = static_cast<size_t>(etl::distance(begin, end));
+
+      hash = calculate((length == 0U) ? ETL_NULLPTR : &*begin, length, seed);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value() const
+    {
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Calculates the hash of a buffer.
+    /// \param data   Start of the buffer.
+    /// \param length The length of the buffer in bytes.
+    /// \param seed   The seed value. Default = 0.
+    //*************************************************************************
+    static value_type calculate(const void* data, size_t length, value_type seed = 0U)
+    {
+      return private_wyhash::calculate(static_cast<const uint8_t*>(data), length, seed);
+    }
+
+  private:
+
+    value_type hash;
+  };
+
+  //***************************************************************************
+  /// Calculates the 32 bit wyhash of a contiguous range of bytes.
+  /// The 64 bit hash, with the upper half folded into the lower.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash_32
+  {
+  public:
+
+    typedef uint32_t value_type;
+
+    //*************************************************************************
+    /// Constructor from a buffer.
+    /// \param data   Start of the buffer.
+    /// \param length The length of the buffer in bytes.
+    /// \param seed   The seed value. Default = 0.
+    //*************************************************************************
+    wyhash_32(const void* data, size_t length, uint64_t seed = 0U)
+      : hash(fold(wyhash_64::calculate(data, length, seed)))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// The range must be contiguous.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    wyhash_32(TIterator begin, const TIterator end, uint64_t seed = 0U)
+      : hash(fold(wyhash_64(begin, end, seed).value()))
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value() const
+    {
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type () const
+    {
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Calculates the hash of a buffer.
+    /// \param data   Start of the buffer.
+    /// \param length The length of the buffer in bytes.
+    /// \param seed   The seed value. Default = 0.
+    //*************************************************************************
+    static value_type calculate(const void* data, size_t length, uint64_t seed = 0U)
+    {
+      return fold(wyhash_64::calculate(data, length, seed));
+    }
+
+  private:
+
+    //*************************************************************************
+    static value_type fold(uint64_t h)
+    {
+      return static_cast<value_type>(h ^ (h >> 32U));
+    }
+
+    value_type hash;
+  };
+}
+
+#endif // ETL_USING_64BIT_TYPES
+
+#endif
@@ -0,0 +1,143 @@
+// btree_map.cpp : Compares etl::btree_map with etl::map for insert, find,
+// iteration and erase.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include btree_map.cpp -o btree_map
+//
+// Keys are distinct random values, inserted and erased in random order.
+// Half of the finds are for keys that are not present.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <memory>
+
+#include "etl/btree_map.h"
+#include "etl/map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+const size_t LOOKUPS = 2000000UL;
+
+// Stops the optimiser from discarding the results.
+volatile size_t sink;
+
+//*****************************************************************************
+void Report(const char* name, uint64_t time, size_t operations)
+{
+  std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(10) << (double(time) / double(operations)) << "ns\n";
+}
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& lookups)
+{
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<TMap> map(new TMap);
+
+  std::cout << " " << name << "\n";
+
+  StartTimer();
+  for (size_t i = 0UL; i < keys.size(); ++i)
+  {
+    map->insert(typename TMap::value_type(keys[i], keys[i]));
+  }
+  Report("insert", StopTimer(), keys.size());
+
+  size_t sum = 0U;
+
+  StartTimer();
+  for (size_t i = 0UL; i < lookups.size(); ++i)
+  {
+    sum += (map->find(lookups[i]) != map->end()) ? 1U : 0U;
+  }
+  Report("find", StopTimer(), lookups.size());
+
+  const size_t passes = (LOOKUPS / keys.size()) + 1U;
+
+  StartTimer();
+  for (size_t pass = 0UL; pass < passes; ++pass)
+  {
+    for (typename TMap::const_iterator itr = map->begin(); itr != map->end(); ++itr)
+    {
+      sum += itr->second;
+    }
+  }
+  Report("iterate", StopTimer(), passes * keys.size());
+
+  StartTimer();
+  for (size_t i = keys.size(); i > 0UL; --i)
+  {
+    map->erase(keys[i - 1U]);
+  }
+  Report("erase", StopTimer(), keys.size());
+
+  sink = sum;
+}
+
+//*****************************************************************************
+template <size_t SIZE>
+void Compare(std::mt19937& rng)
+{
+  // Distinct random even keys, in random order.
+  std::vector<uint32_t> keys;
+  keys.reserve(SIZE);
+
+  while (keys.size() < SIZE)
+  {
+    keys.push_back(uint32_t(rng()) & ~1U);
+
+    if (keys.size() == SIZE)
+    {
+      std::sort(keys.begin(), keys.end());
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+  }
+
+  std::shuffle(keys.begin(), keys.end(), rng);
+
+  // Half present, half odd and so missing.
+  std::vector<uint32_t> lookups(LOOKUPS);
+
+  for (size_t i = 0UL; i < LOOKUPS; ++i)
+  {
+    lookups[i] = keys[rng() % keys.size()] | (rng() & 1U);
+  }
+
+  std::cout << "Elements : " << keys.size() << "\n";
+
+  Run<etl::btree_map<uint32_t, uint32_t, SIZE> >("etl::btree_map", keys, lookups);
+  Run<etl::map<uint32_t, uint32_t, SIZE> >("etl::map", keys, lookups);
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  Compare<64>(rng);
+  Compare<1024>(rng);
+  Compare<16384>(rng);
+  Compare<262144>(rng);
+
+  return 0;
+}
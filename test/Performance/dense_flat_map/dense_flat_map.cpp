@@ -0,0 +1,140 @@
+// dense_flat_map.cpp : Compares etl::dense_flat_map against etl::flat_map and etl::map.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include dense_flat_map.cpp -o dense_flat_map
+//
+// Each container is filled with the same random keys, then timed for finding
+// keys that are present, finding keys that are not, and iterating over every
+// element to sum the mapped values.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <memory>
+
+#include "etl/dense_flat_map.h"
+#include "etl/flat_map.h"
+#include "etl/map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+const size_t LOOKUPS = 1000000UL;
+const size_t VISITS  = 4000000UL;
+
+// Stops the optimiser from discarding the lookups.
+volatile uint32_t sink;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, TMap& map, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& hits, const std::vector<uint32_t>& misses)
+{
+  // Sorted keys are appended, so filling is not the thing being measured.
+  for (size_t i = 0UL; i < keys.size(); ++i)
+  {
+    map.insert(typename TMap::value_type(keys[i], keys[i]));
+  }
+
+  uint32_t sum = 0U;
+
+  StartTimer();
+  for (size_t i = 0UL; i < hits.size(); ++i)
+  {
+    sum += map.find(hits[i])->second;
+  }
+  const uint64_t hit_time = StopTimer();
+
+  StartTimer();
+  for (size_t i = 0UL; i < misses.size(); ++i)
+  {
+    sum += (map.find(misses[i]) == map.end()) ? 1U : 0U;
+  }
+  const uint64_t miss_time = StopTimer();
+
+  // Iterate enough times to visit about the same number of elements at each size.
+  const size_t passes = (VISITS + keys.size() - 1U) / keys.size();
+
+  StartTimer();
+  for (size_t p = 0UL; p < passes; ++p)
+  {
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      sum += itr->second;
+    }
+  }
+  const uint64_t iterate_time = StopTimer();
+
+  sink = sum;
+
+  std::cout << "  " << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(10) << (double(hit_time) / double(hits.size())) << "ns"
+            << std::setw(10) << (double(miss_time) / double(misses.size())) << "ns"
+            << std::setw(10) << (double(iterate_time) / double(passes * keys.size())) << "ns\n";
+}
+
+//*****************************************************************************
+template <size_t SIZE>
+void Compare(std::mt19937& rng)
+{
+  typedef etl::dense_flat_map<uint32_t, uint32_t, SIZE> Densemap;
+  typedef etl::flat_map<uint32_t, uint32_t, SIZE>       Flatmap;
+  typedef etl::map<uint32_t, uint32_t, SIZE>            Etlmap;
+
+  // Distinct random keys. Even keys are present, odd keys are missing.
+  std::vector<uint32_t> all(SIZE);
+  std::generate(all.begin(), all.end(), [&]() { return uint32_t(rng()) & ~1U; });
+  std::sort(all.begin(), all.end());
+  all.erase(std::unique(all.begin(), all.end()), all.end());
+
+  std::vector<uint32_t> hits(LOOKUPS);
+  std::vector<uint32_t> misses(LOOKUPS);
+
+  for (size_t i = 0UL; i < LOOKUPS; ++i)
+  {
+    hits[i]   = all[rng() % all.size()];
+    misses[i] = hits[i] | 1U;
+  }
+
+  std::cout << "Elements : " << all.size() << "\n";
+  std::cout << "  " << std::left << std::setw(22) << "" << std::right
+            << std::setw(12) << "hit" << std::setw(12) << "miss" << std::setw(12) << "iterate" << "\n";
+
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<Densemap> densemap(new Densemap);
+  std::unique_ptr<Flatmap>  flatmap(new Flatmap);
+  std::unique_ptr<Etlmap>   etlmap(new Etlmap);
+
+  Run("etl::dense_flat_map", *densemap, all, hits, misses);
+  Run("etl::flat_map", *flatmap, all, hits, misses);
+  Run("etl::map", *etlmap, all, hits, misses);
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  Compare<64>(rng);
+  Compare<1024>(rng);
+  Compare<16384>(rng);
+  Compare<65536>(rng);
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+// eytzinger_view.cpp : Compares searching a sorted array with etl::lower_bound,
+// etl::lower_bound_branchless and an etl::eytzinger_view, and searching an
+// etl::flat_map.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include eytzinger_view.cpp -o eytzinger_view
+//
+// Each search looks for a random key, half of which are present.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <memory>
+
+#include "etl/algorithm.h"
+#include "etl/eytzinger_view.h"
+#include "etl/flat_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+const size_t LOOKUPS = 2000000UL;
+
+// Stops the optimiser from discarding the searches.
+volatile size_t sink;
+
+//*****************************************************************************
+template <typename TSearch>
+void Run(const char* name, const std::vector<uint32_t>& lookups, TSearch search)
+{
+  size_t sum = 0U;
+
+  StartTimer();
+  for (size_t i = 0UL; i < lookups.size(); ++i)
+  {
+    sum += search(lookups[i]);
+  }
+  const uint64_t time = StopTimer();
+
+  sink = sum;
+
+  std::cout << "  " << std::left << std::setw(32) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(10) << (double(time) / double(lookups.size())) << "ns\n";
+}
+
+//*****************************************************************************
+template <size_t SIZE>
+void Compare(std::mt19937& rng)
+{
+  typedef etl::eytzinger_view<uint32_t, SIZE>     View;
+  typedef etl::flat_map<uint32_t, uint32_t, SIZE> Flatmap;
+
+  // Distinct random even keys.
+  std::vector<uint32_t> keys;
+  keys.reserve(SIZE);
+
+  while (keys.size() < SIZE)
+  {
+    keys.push_back(uint32_t(rng()) & ~1U);
+
+    if (keys.size() == SIZE)
+    {
+      std::sort(keys.begin(), keys.end());
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+  }
+
+  // Half present, half odd and so missing.
+  std::vector<uint32_t> lookups(LOOKUPS);
+
+  for (size_t i = 0UL; i < LOOKUPS; ++i)
+  {
+    lookups[i] = keys[rng() % keys.size()] | (rng() & 1U);
+  }
+
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<View>    view(new View(keys.begin(), keys.end()));
+  std::unique_ptr<Flatmap> flatmap(new Flatmap);
+
+  for (size_t i = 0UL; i < keys.size(); ++i)
+  {
+    flatmap->insert(typename Flatmap::value_type(keys[i], keys[i]));
+  }
+
+  const uint32_t* first = keys.data();
+  const uint32_t* last  = keys.data() + keys.size();
+
+  std::cout << "Elements : " << keys.size() << "\n";
+
+  Run("etl::lower_bound", lookups, [=](uint32_t key) { return size_t(etl::lower_bound(first, last, key) - first); });
+  Run("etl::lower_bound_branchless", lookups, [=](uint32_t key) { return size_t(etl::lower_bound_branchless(first, last, key) - first); });
+  Run("etl::eytzinger_view::lower_bound", lookups, [&](uint32_t key) { return view->lower_bound(key); });
+  Run("etl::flat_map::lower_bound", lookups, [&](uint32_t key) { return (flatmap->lower_bound(key) != flatmap->end()) ? size_t(1U) : size_t(0U); });
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  Compare<64>(rng);
+  Compare<1024>(rng);
+  Compare<16384>(rng);
+  Compare<262144>(rng);
+
+  return 0;
+}
@@ -0,0 +1,170 @@
+// hash.cpp : Compares the throughput of the ETL byte range hashes.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include hash.cpp -o hash
+//
+// Define ETL_HASH_USE_WYHASH to make wyhash the backend for etl::hash of strings,
+// which is measured by the etl::unordered_map lookup at the end.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <memory>
+#include <stdio.h>
+
+#include "etl/fnv_1.h"
+#include "etl/murmur3.h"
+#include "etl/wyhash.h"
+#include "etl/hash.h"
+#include "etl/string.h"
+#include "etl/unordered_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t TESTBYTES = 64UL * 1024UL * 1024UL;
+const size_t LOOKUPS   = 1000000UL;
+const size_t KEYS      = 10000UL;
+
+// Stops the optimiser from discarding the hashes.
+volatile uint64_t sink;
+
+struct Fnv1a64
+{
+  static uint64_t calculate(const uint8_t* p, size_t length)
+  {
+    return etl::fnv_1a_64(p, p + length);
+  }
+};
+
+struct Murmur3_32
+{
+  static uint64_t calculate(const uint8_t* p, size_t length)
+  {
+    return etl::murmur3<uint32_t>(p, p + length);
+  }
+};
+
+struct Murmur3_128
+{
+  static uint64_t calculate(const uint8_t* p, size_t length)
+  {
+    etl::murmur3_128::value_type hash = etl::murmur3_128(p, p + length);
+
+    return hash[0] ^ hash[1];
+  }
+};
+
+struct Wyhash64
+{
+  static uint64_t calculate(const uint8_t* p, size_t length)
+  {
+    return etl::wyhash_64::calculate(p, length);
+  }
+};
+
+struct Wyhash32
+{
+  static uint64_t calculate(const uint8_t* p, size_t length)
+  {
+    return etl::wyhash_32::calculate(p, length);
+  }
+};
+
+//*****************************************************************************
+/// Hashes TESTBYTES of data in blocks of 'length' and reports MB/s.
+//*****************************************************************************
+template <typename THash>
+double Throughput(const std::vector<uint8_t>& data, size_t length)
+{
+  const size_t blocks = data.size() / length;
+  uint64_t sum = 0U;
+
+  StartTimer();
+  for (size_t i = 0UL; i < blocks; ++i)
+  {
+    sum += THash::calculate(&data[i * length], length);
+  }
+  uint64_t time = StopTimer();
+
+  sink = sum;
+
+  return (time == 0U) ? 0.0 : double(blocks * length) / double(time);
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  std::vector<uint8_t> data(TESTBYTES);
+  for (size_t i = 0UL; i < data.size(); ++i)
+  {
+    data[i] = uint8_t(rng());
+  }
+
+  const size_t lengths[] = { 4U, 8U, 16U, 32U, 64U, 256U, 4096U };
+
+  std::cout << "Throughput (MB/s)\n\n";
+  std::cout << std::setw(8)  << "Length"
+            << std::setw(12) << "fnv_1a_64"
+            << std::setw(12) << "murmur3_32"
+            << std::setw(12) << "murmur3_128"
+            << std::setw(12) << "wyhash_64"
+            << std::setw(12) << "wyhash_32" << "\n";
+
+  for (size_t i = 0UL; i < (sizeof(lengths) / sizeof(lengths[0])); ++i)
+  {
+    std::cout << std::setw(8)  << lengths[i] << std::fixed << std::setprecision(0)
+              << std::setw(12) << Throughput<Fnv1a64>(data, lengths[i])
+              << std::setw(12) << Throughput<Murmur3_32>(data, lengths[i])
+              << std::setw(12) << Throughput<Murmur3_128>(data, lengths[i])
+              << std::setw(12) << Throughput<Wyhash64>(data, lengths[i])
+              << std::setw(12) << Throughput<Wyhash32>(data, lengths[i]) << "\n";
+  }
+
+  // Lookups through etl::hash<etl::string<N>>.
+  typedef etl::string<24> Key;
+  typedef etl::unordered_map<Key, uint32_t, KEYS> Map;
+
+  std::unique_ptr<Map> map(new Map);
+  std::vector<Key> keys;
+
+  for (size_t i = 0UL; i < KEYS; ++i)
+  {
+    char text[24];
+    snprintf(text, sizeof(text), "sensor/%08X/value", unsigned(rng()));
+    keys.push_back(Key(text));
+    map->insert(Map::value_type(keys.back(), uint32_t(i)));
+  }
+
+  uint64_t sum = 0U;
+
+  StartTimer();
+  for (size_t i = 0UL; i < LOOKUPS; ++i)
+  {
+    sum += map->find(keys[i % KEYS])->second;
+  }
+  uint64_t time = StopTimer();
+
+  sink = sum;
+
+  std::cout << "\netl::unordered_map<etl::string<24>> lookup (" << (etl::traits::has_hash_wyhash ? "wyhash" : "fnv_1a")
+            << ") : " << (time * 1000U) / LOOKUPS << "ns\n";
+
+  return 0;
+}
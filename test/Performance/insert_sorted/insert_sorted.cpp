@@ -0,0 +1,105 @@
+// insert_sorted.cpp : Compares building etl::map and etl::flat_map from sorted
+// input with insert and with insert_sorted, and merging the odd keys into an
+// etl::flat_map that holds the even ones.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include insert_sorted.cpp -o insert_sorted
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <memory>
+#include <utility>
+
+#include "etl/map.h"
+#include "etl/flat_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+// Stops the optimiser from discarding the results.
+volatile size_t sink;
+
+//*****************************************************************************
+void Report(const char* name, uint64_t time)
+{
+  std::cout << "  " << std::left << std::setw(40) << name << std::right << std::fixed << std::setprecision(1)
+            << std::setw(12) << (double(time) / 1000.0) << "us\n";
+}
+
+//*****************************************************************************
+template <typename TMap, typename TBuild>
+void Run(const char* name, TBuild build)
+{
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<TMap> map(new TMap);
+
+  StartTimer();
+  build(*map);
+  Report(name, StopTimer());
+
+  sink = map->size();
+}
+
+//*****************************************************************************
+template <size_t SIZE>
+void Compare()
+{
+  typedef etl::map<uint32_t, uint32_t, SIZE>      Map;
+  typedef etl::flat_map<uint32_t, uint32_t, SIZE> Flatmap;
+
+  std::vector<std::pair<uint32_t, uint32_t> > all;
+  std::vector<std::pair<uint32_t, uint32_t> > evens;
+  std::vector<std::pair<uint32_t, uint32_t> > odds;
+
+  for (uint32_t i = 0U; i < SIZE; ++i)
+  {
+    all.push_back(std::make_pair(i, i));
+    ((i & 1U) ? odds : evens).push_back(std::make_pair(i, i));
+  }
+
+  std::cout << "Elements : " << SIZE << "\n";
+
+  Run<Map>("etl::map insert", [&](Map& map) { map.insert(all.begin(), all.end()); });
+  Run<Map>("etl::map insert_sorted", [&](Map& map) { map.insert_sorted(all.begin(), all.end()); });
+  Run<Flatmap>("etl::flat_map insert", [&](Flatmap& map) { map.insert(all.begin(), all.end()); });
+  Run<Flatmap>("etl::flat_map insert_sorted", [&](Flatmap& map) { map.insert_sorted(all.begin(), all.end()); });
+
+  // The build time of the evens is included in both.
+  Run<Flatmap>("etl::flat_map merge with insert", [&](Flatmap& map)
+  {
+    map.insert_sorted(evens.begin(), evens.end());
+    map.insert(odds.begin(), odds.end());
+  });
+
+  Run<Flatmap>("etl::flat_map merge with insert_sorted", [&](Flatmap& map)
+  {
+    map.insert_sorted(evens.begin(), evens.end());
+    map.insert_sorted(odds.begin(), odds.end());
+  });
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  Compare<1024>();
+  Compare<16384>();
+  Compare<65536>();
+
+  return 0;
+}
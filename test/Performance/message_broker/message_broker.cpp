@@ -0,0 +1,216 @@
+// message_broker.cpp : Compares etl::message_broker with etl::message_broker_indexed.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include message_broker.cpp -o message_broker
+//
+// 64 subscribers each subscribe to a random selection of the 256 message ids,
+// then messages with every id are sent to the broker.
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <memory>
+
+#include "etl/message_broker.h"
+#include "etl/message_broker_indexed.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t N_SUBSCRIBERS = 64UL;
+const size_t N_IDS         = 256UL;
+const size_t MESSAGES      = 1000000UL;
+
+//*****************************************************************************
+/// A message whose id is set at run time.
+//*****************************************************************************
+class Message : public etl::imessage
+{
+public:
+
+  Message(etl::message_id_t id_)
+    : id(id_)
+  {
+  }
+
+  etl::message_id_t get_message_id() const ETL_NOEXCEPT override
+  {
+    return id;
+  }
+
+private:
+
+  etl::message_id_t id;
+};
+
+//*****************************************************************************
+/// Counts the messages that it receives.
+//*****************************************************************************
+class Subscriber : public etl::imessage_router
+{
+public:
+
+  Subscriber(etl::message_router_id_t id_)
+    : imessage_router(id_)
+    , count(0UL)
+  {
+  }
+
+  using etl::imessage_router::receive;
+
+  void receive(const etl::imessage&) override
+  {
+    ++count;
+  }
+
+  bool accepts(etl::message_id_t) const override
+  {
+    return true;
+  }
+
+  bool is_null_router() const override
+  {
+    return false;
+  }
+
+  bool is_producer() const override
+  {
+    return false;
+  }
+
+  bool is_consumer() const override
+  {
+    return true;
+  }
+
+  size_t count;
+};
+
+//*****************************************************************************
+class Subscription : public etl::message_broker::subscription
+{
+public:
+
+  Subscription(etl::imessage_router& router, const std::vector<etl::message_id_t>& ids_)
+    : etl::message_broker::subscription(router)
+    , ids(ids_)
+  {
+  }
+
+  etl::message_broker::message_id_span_t message_id_list() const override
+  {
+    return etl::message_broker::message_id_span_t(ids.data(), ids.size());
+  }
+
+  std::vector<etl::message_id_t> ids;
+};
+
+//*****************************************************************************
+/// Returns the time in microseconds and the total number of deliveries.
+//*****************************************************************************
+template <typename TBroker>
+uint64_t Dispatch(TBroker& broker, std::vector<std::unique_ptr<Subscriber>>& subscribers, size_t& deliveries)
+{
+  for (size_t i = 0UL; i < subscribers.size(); ++i)
+  {
+    subscribers[i]->count = 0UL;
+  }
+
+  StartTimer();
+
+  for (size_t i = 0UL; i < MESSAGES; ++i)
+  {
+    broker.receive(Message(etl::message_id_t(i % N_IDS)));
+  }
+
+  uint64_t time = StopTimer();
+
+  deliveries = 0UL;
+
+  for (size_t i = 0UL; i < subscribers.size(); ++i)
+  {
+    deliveries += subscribers[i]->count;
+  }
+
+  return time;
+}
+
+//*****************************************************************************
+template <size_t IDS_PER_SUBSCRIBER>
+void Test()
+{
+  std::mt19937 generator(1);
+
+  std::vector<std::unique_ptr<Subscriber>>   subscribers;
+  std::vector<std::unique_ptr<Subscription>> subscriptions;
+
+  std::vector<etl::message_id_t> all_ids;
+
+  for (size_t i = 0UL; i < N_IDS; ++i)
+  {
+    all_ids.push_back(etl::message_id_t(i));
+  }
+
+  for (size_t i = 0UL; i < N_SUBSCRIBERS; ++i)
+  {
+    std::shuffle(all_ids.begin(), all_ids.end(), generator);
+
+    subscribers.emplace_back(new Subscriber(etl::message_router_id_t(i)));
+    subscriptions.emplace_back(new Subscription(*subscribers.back(), std::vector<etl::message_id_t>(all_ids.begin(), all_ids.begin() + IDS_PER_SUBSCRIBER)));
+  }
+
+  etl::message_broker linear_broker;
+  std::unique_ptr<etl::message_broker_indexed<N_SUBSCRIBERS * IDS_PER_SUBSCRIBER>> indexed_broker(new etl::message_broker_indexed<N_SUBSCRIBERS * IDS_PER_SUBSCRIBER>);
+
+  for (size_t i = 0UL; i < N_SUBSCRIBERS; ++i)
+  {
+    linear_broker.subscribe(*subscriptions[i]);
+    indexed_broker->subscribe(*subscriptions[i]);
+  }
+
+  size_t linear_deliveries;
+  size_t indexed_deliveries;
+
+  uint64_t linear_time  = Dispatch(linear_broker, subscribers, linear_deliveries);
+  uint64_t indexed_time = Dispatch(*indexed_broker, subscribers, indexed_deliveries);
+
+  std::cout << std::setw(20) << IDS_PER_SUBSCRIBER
+            << std::setw(20) << (double(linear_time) * 1000.0) / MESSAGES
+            << std::setw(20) << (double(indexed_time) * 1000.0) / MESSAGES
+            << ((linear_deliveries == indexed_deliveries) ? "" : "  (ERROR)") << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::cout << N_SUBSCRIBERS << " subscribers, " << N_IDS << " message ids\n";
+  std::cout << "Time per message (ns)\n\n";
+  std::cout << std::setw(20) << "Ids per subscriber"
+            << std::setw(20) << "message_broker"
+            << std::setw(20) << "indexed" << "\n";
+
+  std::cout << std::fixed << std::setprecision(1);
+
+  Test<1>();
+  Test<4>();
+  Test<16>();
+  Test<64>();
+  Test<256>();
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+// message_pool.cpp : Compares a locked etl::fixed_sized_memory_block_allocator
+// with etl::fixed_sized_memory_block_allocator_atomic, as the allocator of a
+// reference counted message pool shared between threads.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -pthread -I../../../include message_pool.cpp -o message_pool
+//
+// Each thread repeatedly creates a shared message from the pool and copies it,
+// so that every iteration is one allocation and one release.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t ITERATIONS  = 1000000UL;
+const size_t MAX_THREADS = 8UL;
+
+//*****************************************************************************
+struct Message : public etl::message<1>
+{
+  Message(size_t value_)
+    : value(value_)
+  {
+  }
+
+  size_t value;
+};
+
+typedef etl::atomic_counted_message_pool::pool_message_parameters<Message> Parameters;
+
+//*****************************************************************************
+/// A pool that locks a mutex around each call to the allocator.
+//*****************************************************************************
+class LockedPool : public etl::atomic_counted_message_pool
+{
+public:
+
+  LockedPool(etl::imemory_block_allocator& allocator)
+    : etl::atomic_counted_message_pool(allocator)
+  {
+  }
+
+  void lock() override
+  {
+    mutex.lock();
+  }
+
+  void unlock() override
+  {
+    mutex.unlock();
+  }
+
+private:
+
+  std::mutex mutex;
+};
+
+//*****************************************************************************
+/// Returns the time in microseconds.
+//*****************************************************************************
+uint64_t Run(etl::atomic_counted_message_pool& pool, size_t n_threads)
+{
+  std::vector<std::thread> threads;
+
+  StartTimer();
+
+  for (size_t t = 0UL; t < n_threads; ++t)
+  {
+    threads.emplace_back([&pool, n_threads]()
+    {
+      for (size_t i = 0UL; i < (ITERATIONS / n_threads); ++i)
+      {
+        etl::shared_message message(pool, Message(i));
+        etl::shared_message copy(message);
+      }
+    });
+  }
+
+  for (size_t t = 0UL; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  return StopTimer();
+}
+
+//*****************************************************************************
+int main()
+{
+  etl::fixed_sized_memory_block_allocator<Parameters::max_size, Parameters::max_alignment, MAX_THREADS>        locked_allocator;
+  etl::fixed_sized_memory_block_allocator_atomic<Parameters::max_size, Parameters::max_alignment, MAX_THREADS> atomic_allocator;
+
+  LockedPool                       locked_pool(locked_allocator);
+  etl::atomic_counted_message_pool atomic_pool(atomic_allocator);
+
+  std::cout << "Time per allocate/release (ns)\n\n";
+
+  std::cout << std::setw(10) << "Threads"
+            << std::setw(20) << "Locked"
+            << std::setw(20) << "Lock free" << "\n";
+
+  for (size_t n_threads = 1UL; n_threads <= MAX_THREADS; n_threads *= 2UL)
+  {
+    uint64_t locked_time = Run(locked_pool, n_threads);
+    uint64_t atomic_time = Run(atomic_pool, n_threads);
+
+    std::cout << std::setw(10) << n_threads
+              << std::setw(20) << (double(locked_time) * 1000.0) / ITERATIONS
+              << std::setw(20) << (double(atomic_time) * 1000.0) / ITERATIONS << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+// pool.cpp : Compares allocating and releasing etl::pool items one at a time
+// with the allocate_n and release_n batch functions.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include pool.cpp -o pool
+//
+// Batches of items are allocated and then released, both from an untouched
+// pool, where allocate_n takes contiguous items, and from a pool whose free
+// list has been used.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+#include "etl/pool.h"
+#include "etl/span.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+struct Node
+{
+  Node* p_next;
+  int   value;
+};
+
+const size_t POOL_SIZE = 256UL;
+const size_t ROUNDS    = 200000UL;
+
+typedef etl::pool<Node, POOL_SIZE> Pool;
+
+//*****************************************************************************
+template <size_t BATCH>
+uint64_t Single(Pool& pool, bool untouched)
+{
+  Node* items[BATCH];
+
+  StartTimer();
+
+  for (size_t r = 0UL; r < ROUNDS; ++r)
+  {
+    // Cheap, so is timed with the rest.
+    if (untouched)
+    {
+      pool.release_all();
+    }
+
+    for (size_t i = 0UL; i < BATCH; ++i)
+    {
+      items[i] = pool.allocate();
+    }
+
+    for (size_t i = 0UL; i < BATCH; ++i)
+    {
+      pool.release(items[i]);
+    }
+  }
+
+  return StopTimer();
+}
+
+//*****************************************************************************
+template <size_t BATCH>
+uint64_t Batch(Pool& pool, bool untouched)
+{
+  Node* items[BATCH];
+  etl::span<Node*> span(items);
+
+  StartTimer();
+
+  for (size_t r = 0UL; r < ROUNDS; ++r)
+  {
+    // Cheap, so is timed with the rest.
+    if (untouched)
+    {
+      pool.release_all();
+    }
+
+    pool.allocate_n(span);
+    pool.release_n(span);
+  }
+
+  return StopTimer();
+}
+
+//*****************************************************************************
+template <size_t BATCH>
+void Test()
+{
+  Pool pool;
+
+  const double scale = 1000.0 / double(ROUNDS);
+
+  uint64_t single_untouched = Single<BATCH>(pool, true);
+  uint64_t batch_untouched  = Batch<BATCH>(pool, true);
+  uint64_t single_used      = Single<BATCH>(pool, false);
+  uint64_t batch_used       = Batch<BATCH>(pool, false);
+
+  std::cout << std::setw(10) << BATCH
+            << std::setw(20) << double(single_untouched) * scale
+            << std::setw(20) << double(batch_untouched) * scale
+            << std::setw(20) << double(single_used) * scale
+            << std::setw(20) << double(batch_used) * scale << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::cout << "Time per batch allocate and release (ns)\n\n";
+
+  std::cout << std::setw(10) << "Batch"
+            << std::setw(20) << "Single (untouched)"
+            << std::setw(20) << "Batch (untouched)"
+            << std::setw(20) << "Single (used)"
+            << std::setw(20) << "Batch (used)" << "\n";
+
+  Test<16>();
+  Test<32>();
+  Test<64>();
+
+  return 0;
+}
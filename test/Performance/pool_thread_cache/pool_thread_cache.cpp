@@ -0,0 +1,140 @@
+// pool_thread_cache.cpp : Compares an etl::pool shared between threads with a
+// mutex, with the same pool used through etl::pool_thread_cache objects.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -pthread -I../../../include pool_thread_cache.cpp -o pool_thread_cache
+//
+// Each thread repeatedly allocates a batch of items and then releases them.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "etl/pool.h"
+#include "etl/pool_thread_cache.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t ITERATIONS    = 250000UL;
+const size_t BATCH         = 4UL;
+const size_t MAGAZINE_SIZE = 16UL;
+const size_t MAX_THREADS   = 8UL;
+const size_t POOL_SIZE     = MAX_THREADS * (MAGAZINE_SIZE + BATCH);
+
+typedef etl::pool<uint64_t, POOL_SIZE> Pool;
+
+//*****************************************************************************
+/// Returns the time in microseconds.
+//*****************************************************************************
+template <typename TFunction>
+uint64_t Run(size_t n_threads, TFunction function)
+{
+  std::vector<std::thread> threads;
+
+  StartTimer();
+
+  for (size_t t = 0UL; t < n_threads; ++t)
+  {
+    threads.emplace_back(function, ITERATIONS / n_threads);
+  }
+
+  for (size_t t = 0UL; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  return StopTimer();
+}
+
+//*****************************************************************************
+int main()
+{
+  Pool       locked_pool;
+  std::mutex mutex;
+
+  Pool                  cached_pool;
+  etl::pool_depot<Pool> depot(cached_pool);
+
+  std::cout << "Time per allocate/release (ns)\n\n";
+
+  std::cout << std::setw(10) << "Threads"
+            << std::setw(20) << "Locked"
+            << std::setw(20) << "Thread cache"
+            << std::setw(20) << "Cache hit rate" << "\n";
+
+  for (size_t n_threads = 1UL; n_threads <= MAX_THREADS; n_threads *= 2UL)
+  {
+    uint64_t locked_time = Run(n_threads, [&](size_t iterations)
+    {
+      uint64_t* items[BATCH];
+
+      for (size_t i = 0UL; i < iterations; ++i)
+      {
+        for (size_t j = 0UL; j < BATCH; ++j)
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          items[j] = locked_pool.allocate();
+        }
+
+        for (size_t j = 0UL; j < BATCH; ++j)
+        {
+          std::lock_guard<std::mutex> guard(mutex);
+          locked_pool.release(items[j]);
+        }
+      }
+    });
+
+    size_t     hits   = 0UL;
+    size_t     misses = 0UL;
+    std::mutex counter_mutex;
+
+    uint64_t cached_time = Run(n_threads, [&](size_t iterations)
+    {
+      etl::pool_thread_cache<MAGAZINE_SIZE> cache(depot);
+
+      uint64_t* items[BATCH];
+
+      for (size_t i = 0UL; i < iterations; ++i)
+      {
+        for (size_t j = 0UL; j < BATCH; ++j)
+        {
+          items[j] = cache.allocate<uint64_t>();
+        }
+
+        for (size_t j = 0UL; j < BATCH; ++j)
+        {
+          cache.release(items[j]);
+        }
+      }
+
+      std::lock_guard<std::mutex> guard(counter_mutex);
+      hits   += cache.allocate_hits() + cache.release_hits();
+      misses += cache.allocate_misses() + cache.release_misses();
+    });
+
+    const double operations = double(ITERATIONS * BATCH);
+
+    std::cout << std::setw(10) << n_threads
+              << std::setw(20) << (double(locked_time) * 1000.0) / operations
+              << std::setw(20) << (double(cached_time) * 1000.0) / operations
+              << std::setw(19) << (100.0 * double(hits)) / double(hits + misses) << "%\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,149 @@
+// queue_mpmc.cpp : Compares etl::queue_mpmc_atomic with etl::queue_mpmc_mutex under contention.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -pthread -I../../../include queue_mpmc.cpp -o queue_mpmc
+//
+// For each thread count N, N producers push ITEMS values in total while N
+// consumers pop them. The results are only meaningful when there are at least
+// 2N cores.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <atomic>
+
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const uint32_t ITEMS       = 4000000UL;
+const size_t   QUEUE_SIZE  = 1024UL;
+const size_t   MAX_THREADS = 16UL;
+
+//*****************************************************************************
+/// Spins, yielding occasionally so that the test completes on fewer cores.
+//*****************************************************************************
+inline void Backoff(uint32_t& spins)
+{
+  if (++spins == 256U)
+  {
+    spins = 0U;
+    std::this_thread::yield();
+  }
+}
+
+//*****************************************************************************
+/// Returns the number of items per microsecond.
+//*****************************************************************************
+template <typename TQueue>
+double Throughput(size_t thread_count, bool& ok)
+{
+  std::unique_ptr<TQueue> queue(new TQueue);
+
+  const uint32_t portion = ITEMS / uint32_t(thread_count);
+
+  std::atomic<uint64_t> sum(0U);
+  std::atomic<bool>     start(false);
+  std::vector<std::thread> threads;
+
+  for (size_t t = 0UL; t < thread_count; ++t)
+  {
+    threads.push_back(std::thread([&queue, &start, portion]()
+    {
+      uint32_t spins = 0U;
+
+      while (!start.load());
+
+      for (uint32_t i = 1U; i <= portion; ++i)
+      {
+        while (!queue->push(i))
+        {
+          Backoff(spins);
+        }
+      }
+    }));
+
+    threads.push_back(std::thread([&queue, &start, &sum, portion]()
+    {
+      uint32_t spins = 0U;
+      uint64_t local = 0U;
+
+      while (!start.load());
+
+      for (uint32_t i = 0U; i < portion; ++i)
+      {
+        uint32_t value;
+
+        while (!queue->pop(value))
+        {
+          Backoff(spins);
+        }
+
+        local += value;
+      }
+
+      sum += local;
+    }));
+  }
+
+  StartTimer();
+  start.store(true);
+
+  for (size_t t = 0UL; t < threads.size(); ++t)
+  {
+    threads[t].join();
+  }
+
+  uint64_t time = StopTimer();
+
+  ok = (sum.load() == (uint64_t(thread_count) * portion * (portion + 1U)) / 2U);
+
+  return (time == 0U) ? 0.0 : double(uint64_t(portion) * thread_count) / double(time);
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::queue_mpmc_atomic<uint32_t, QUEUE_SIZE> AtomicQueue;
+  typedef etl::queue_mpmc_mutex<uint32_t, QUEUE_SIZE>  MutexQueue;
+
+  const size_t hardware_threads = std::thread::hardware_concurrency();
+
+  std::cout << "Throughput (M items/s), " << hardware_threads << " hardware threads\n\n";
+  std::cout << std::setw(10) << "Threads"
+            << std::setw(20) << "queue_mpmc_mutex"
+            << std::setw(20) << "queue_mpmc_atomic" << "\n";
+
+  for (size_t thread_count = 1UL; thread_count <= MAX_THREADS; thread_count *= 2U)
+  {
+    bool mutex_ok;
+    bool atomic_ok;
+
+    double mutex_result  = Throughput<MutexQueue>(thread_count, mutex_ok);
+    double atomic_result = Throughput<AtomicQueue>(thread_count, atomic_ok);
+
+    std::cout << std::setw(6) << thread_count << " x 2" << std::fixed << std::setprecision(1)
+              << std::setw(20) << mutex_result
+              << std::setw(20) << atomic_result
+              << ((mutex_ok && atomic_ok) ? "" : "  (ERROR)") << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,250 @@
+// queue_spsc.cpp : Compares the COMPACT and PADDED layouts of etl::queue_spsc_atomic.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -pthread -I../../../include queue_spsc.cpp -o queue_spsc
+//
+// Throughput: one thread pushes ITEMS values while another pops them.
+// Batch:      as Throughput, but values are pushed and popped through spans of BATCH.
+// Latency:    two threads pass a value back and forth through a pair of queues.
+// The results are only meaningful when the two threads run on different cores.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <memory>
+#include <vector>
+
+#include "etl/queue_spsc_atomic.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const uint32_t ITEMS      = 20000000UL;
+const uint32_t ROUNDTRIPS = 1000000UL;
+const size_t   QUEUE_SIZE = 1024UL;
+
+//*****************************************************************************
+/// Spins, yielding occasionally so that the test completes on a single core.
+//*****************************************************************************
+inline void Backoff(uint32_t& spins)
+{
+  if (++spins == 1024U)
+  {
+    spins = 0U;
+    std::this_thread::yield();
+  }
+}
+
+//*****************************************************************************
+template <typename TQueue>
+void Throughput(const char* name)
+{
+  std::unique_ptr<TQueue> queue(new TQueue);
+
+  uint64_t sum = 0U;
+
+  StartTimer();
+
+  std::thread producer([&queue]()
+  {
+    uint32_t spins = 0U;
+
+    for (uint32_t i = 1U; i <= ITEMS; ++i)
+    {
+      while (!queue->push(i))
+      {
+        Backoff(spins);
+      }
+    }
+  });
+
+  uint32_t spins = 0U;
+
+  for (uint32_t i = 1U; i <= ITEMS; ++i)
+  {
+    uint32_t value;
+
+    while (!queue->pop(value))
+    {
+      Backoff(spins);
+    }
+
+    sum += value;
+  }
+
+  producer.join();
+
+  uint64_t time = StopTimer();
+
+  const bool ok = (sum == (uint64_t(ITEMS) * (ITEMS + 1U)) / 2U);
+
+  std::cout << std::setw(28) << name
+            << std::setw(10) << (time == 0U ? 0U : uint64_t(ITEMS) / time) << " M items/s"
+            << (ok ? "" : "  (ERROR)") << "\n";
+}
+
+//*****************************************************************************
+template <typename TQueue>
+void BatchThroughput(const char* name, size_t batch)
+{
+  std::unique_ptr<TQueue> queue(new TQueue);
+
+  uint64_t sum = 0U;
+
+  StartTimer();
+
+  std::thread producer([&queue, batch]()
+  {
+    std::vector<uint32_t> values(batch);
+    uint32_t spins = 0U;
+    uint32_t next  = 1U;
+
+    while (next <= ITEMS)
+    {
+      size_t count = 0U;
+
+      while ((count < batch) && ((next + count) <= ITEMS))
+      {
+        values[count] = uint32_t(next + count);
+        ++count;
+      }
+
+      size_t pushed = 0U;
+
+      while (pushed < count)
+      {
+        size_t n = queue->push(etl::span<const uint32_t>(values.data() + pushed, count - pushed));
+
+        if (n == 0U)
+        {
+          Backoff(spins);
+        }
+
+        pushed += n;
+      }
+
+      next += uint32_t(count);
+    }
+  });
+
+  std::vector<uint32_t> values(batch);
+  uint32_t spins    = 0U;
+  uint32_t received = 0U;
+
+  while (received < ITEMS)
+  {
+    size_t n = queue->pop(etl::span<uint32_t>(values.data(), values.size()));
+
+    if (n == 0U)
+    {
+      Backoff(spins);
+    }
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      sum += values[i];
+    }
+
+    received += uint32_t(n);
+  }
+
+  producer.join();
+
+  uint64_t time = StopTimer();
+
+  const bool ok = (sum == (uint64_t(ITEMS) * (ITEMS + 1U)) / 2U);
+
+  std::cout << std::setw(20) << name << " x " << std::setw(5) << batch
+            << std::setw(10) << (time == 0U ? 0U : uint64_t(ITEMS) / time) << " M items/s"
+            << (ok ? "" : "  (ERROR)") << "\n";
+}
+
+//*****************************************************************************
+template <typename TQueue>
+void Latency(const char* name)
+{
+  std::unique_ptr<TQueue> ping(new TQueue);
+  std::unique_ptr<TQueue> pong(new TQueue);
+
+  StartTimer();
+
+  std::thread echo([&ping, &pong]()
+  {
+    uint32_t spins = 0U;
+
+    for (uint32_t i = 0U; i < ROUNDTRIPS; ++i)
+    {
+      uint32_t value;
+
+      while (!ping->pop(value))
+      {
+        Backoff(spins);
+      }
+
+      while (!pong->push(value))
+      {
+        Backoff(spins);
+      }
+    }
+  });
+
+  uint32_t spins = 0U;
+
+  for (uint32_t i = 0U; i < ROUNDTRIPS; ++i)
+  {
+    uint32_t value;
+
+    while (!ping->push(i))
+    {
+      Backoff(spins);
+    }
+
+    while (!pong->pop(value))
+    {
+      Backoff(spins);
+    }
+  }
+
+  echo.join();
+
+  uint64_t time = StopTimer();
+
+  std::cout << std::setw(28) << name
+            << std::setw(10) << (time * 1000U) / ROUNDTRIPS << " ns/round trip\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::queue_spsc_atomic<uint32_t, QUEUE_SIZE>                                                                         Queue;
+  typedef etl::queue_spsc_atomic<uint32_t, QUEUE_SIZE, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_queue_layout::PADDED> PaddedQueue;
+
+  std::cout << "Throughput\n";
+  Throughput<Queue>("COMPACT");
+  Throughput<PaddedQueue>("PADDED");
+
+  std::cout << "\nBatch throughput\n";
+  BatchThroughput<Queue>("COMPACT", 32U);
+  BatchThroughput<PaddedQueue>("PADDED", 32U);
+  BatchThroughput<Queue>("COMPACT", 256U);
+  BatchThroughput<PaddedQueue>("PADDED", 256U);
+
+  std::cout << "\nLatency\n";
+  Latency<Queue>("COMPACT");
+  Latency<PaddedQueue>("PADDED");
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+// radix_sort.cpp : Compares the ETL radix sorts against comparison sorts.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include radix_sort.cpp -o radix_sort
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+
+#include "etl/radix.h"
+#include "etl/algorithm.h"
+#include "etl/span.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t TESTSIZE        = 1000000UL;
+const size_t TESTINTERATIONS = 5UL;
+
+struct Record
+{
+  uint32_t timestamp;
+  uint32_t payload[3];
+};
+
+//*****************************************************************************
+template <typename T, typename TSort, typename TCheck>
+void Run(const char* name, const std::vector<T>& input, TSort sort, TCheck check)
+{
+  std::vector<T> data;
+  uint64_t time = 0U;
+
+  for (size_t i = 0UL; i < TESTINTERATIONS; ++i)
+  {
+    data = input;
+
+    StartTimer();
+    sort(data);
+    time += StopTimer();
+
+    if (!std::is_sorted(data.begin(), data.end(), check))
+    {
+      std::cout << name << " failed to sort\n";
+    }
+  }
+
+  std::cout << "  " << std::left << std::setw(24) << name << std::right << std::setw(10) << (time / TESTINTERATIONS) << "us\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  // Timestamps.
+  std::vector<uint32_t> timestamps(TESTSIZE);
+  std::generate(timestamps.begin(), timestamps.end(), [&]() { return uint32_t(rng()); });
+
+  std::vector<uint32_t> buffer(TESTSIZE);
+  std::less<uint32_t>   less_u32;
+
+  std::cout << "uint32_t (" << TESTSIZE << ")\n";
+  Run("etl::radix_sort", timestamps, [&](std::vector<uint32_t>& d) { etl::radix_sort(d.begin(), d.end(), etl::span<uint32_t>(buffer.data(), buffer.size())); }, less_u32);
+  Run("etl::radix_sort_in_place", timestamps, [](std::vector<uint32_t>& d) { etl::radix_sort_in_place(d.begin(), d.end()); }, less_u32);
+  Run("etl::intro_sort", timestamps, [](std::vector<uint32_t>& d) { etl::intro_sort(d.begin(), d.end()); }, less_u32);
+  Run("std::sort", timestamps, [](std::vector<uint32_t>& d) { std::sort(d.begin(), d.end()); }, less_u32);
+
+  // Floating point.
+  std::vector<double> doubles(TESTSIZE);
+  std::uniform_real_distribution<double> distribution(-1.0e9, 1.0e9);
+  std::generate(doubles.begin(), doubles.end(), [&]() { return distribution(rng); });
+
+  std::vector<double> double_buffer(TESTSIZE);
+  std::less<double>   less_double;
+
+  std::cout << "double (" << TESTSIZE << ")\n";
+  Run("etl::radix_sort", doubles, [&](std::vector<double>& d) { etl::radix_sort(d.begin(), d.end(), etl::span<double>(double_buffer.data(), double_buffer.size())); }, less_double);
+  Run("etl::radix_sort_in_place", doubles, [](std::vector<double>& d) { etl::radix_sort_in_place(d.begin(), d.end()); }, less_double);
+  Run("std::sort", doubles, [](std::vector<double>& d) { std::sort(d.begin(), d.end()); }, less_double);
+
+  // Records keyed by timestamp.
+  std::vector<Record> records(TESTSIZE);
+  for (size_t i = 0UL; i < TESTSIZE; ++i)
+  {
+    records[i].timestamp = uint32_t(rng());
+  }
+
+  std::vector<Record> record_buffer(TESTSIZE);
+  auto record_less = [](const Record& lhs, const Record& rhs) { return lhs.timestamp < rhs.timestamp; };
+
+  std::cout << "Record by timestamp (" << TESTSIZE << ")\n";
+  Run("etl::radix_sort", records, [&](std::vector<Record>& d) { etl::radix_sort(d.begin(), d.end(), etl::span<Record>(record_buffer.data(), record_buffer.size()), &Record::timestamp); }, record_less);
+  Run("etl::radix_sort_in_place", records, [](std::vector<Record>& d) { etl::radix_sort_in_place(d.begin(), d.end(), &Record::timestamp); }, record_less);
+  Run("std::stable_sort", records, [&](std::vector<Record>& d) { std::stable_sort(d.begin(), d.end(), record_less); }, record_less);
+  Run("std::sort", records, [&](std::vector<Record>& d) { std::sort(d.begin(), d.end(), record_less); }, record_less);
+
+  return 0;
+}
@@ -0,0 +1,178 @@
+// sort.cpp : Compares the ETL sorts against each other and the STL sorts.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include sort.cpp -o sort
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+
+#include "etl/algorithm.h"
+#include "etl/vector.h"
+#include "etl/span.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t TESTSIZE        = 100000UL;
+const size_t TESTINTERATIONS = 10UL;
+
+typedef etl::vector<int, TESTSIZE> Data;
+
+Data input;
+Data data;
+Data buffer(TESTSIZE / 2);
+
+//*****************************************************************************
+void FillRandom()
+{
+  std::mt19937 rng(1);
+
+  input.resize(TESTSIZE);
+
+  for (size_t i = 0UL; i < TESTSIZE; ++i)
+  {
+    input[i] = int(rng());
+  }
+}
+
+//*****************************************************************************
+void FillSorted()
+{
+  input.resize(TESTSIZE);
+
+  for (size_t i = 0UL; i < TESTSIZE; ++i)
+  {
+    input[i] = int(i);
+  }
+}
+
+//*****************************************************************************
+void FillReversed()
+{
+  input.resize(TESTSIZE);
+
+  for (size_t i = 0UL; i < TESTSIZE; ++i)
+  {
+    input[i] = int(TESTSIZE - i);
+  }
+}
+
+//*****************************************************************************
+void FillFewUnique()
+{
+  std::mt19937 rng(1);
+
+  input.resize(TESTSIZE);
+
+  for (size_t i = 0UL; i < TESTSIZE; ++i)
+  {
+    input[i] = int(rng() % 8U);
+  }
+}
+
+//*****************************************************************************
+template <typename TSort>
+void Run(const char* name, TSort sort, size_t iterations = TESTINTERATIONS)
+{
+  uint64_t time = 0U;
+
+  for (size_t i = 0UL; i < iterations; ++i)
+  {
+    data.assign(input.begin(), input.end());
+
+    StartTimer();
+    sort(data.begin(), data.end());
+    time += StopTimer();
+
+    if (!std::is_sorted(data.begin(), data.end()))
+    {
+      std::cout << name << " failed to sort\n";
+    }
+  }
+
+  std::cout << "  " << std::left << std::setw(20) << name << std::right << std::setw(10) << (time / iterations) << "us\n";
+}
+
+//*****************************************************************************
+struct IntroSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { etl::intro_sort(first, last); }
+};
+
+struct ShellSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { etl::shell_sort(first, last); }
+};
+
+struct HeapSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { etl::heap_sort(first, last); }
+};
+
+struct StdSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { std::sort(first, last); }
+};
+
+struct MergeSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { etl::merge_sort(first, last); }
+};
+
+struct MergeSortBuffered
+{
+  void operator()(Data::iterator first, Data::iterator last) const { etl::merge_sort(first, last, etl::span<int>(buffer.data(), buffer.size())); }
+};
+
+struct StdStableSort
+{
+  void operator()(Data::iterator first, Data::iterator last) const { std::stable_sort(first, last); }
+};
+
+//*****************************************************************************
+void RunAll(const char* title)
+{
+  std::cout << title << " (" << TESTSIZE << " ints)\n";
+
+  Run("intro_sort", IntroSort());
+  Run("shell_sort", ShellSort(), 1UL); // Too slow to repeat at this size.
+  Run("heap_sort",  HeapSort());
+  Run("std::sort",  StdSort());
+
+  Run("merge_sort", MergeSort());
+  Run("merge_sort (buffer)", MergeSortBuffered());
+  Run("std::stable_sort", StdStableSort());
+}
+
+//*****************************************************************************
+int main()
+{
+  FillRandom();
+  RunAll("Random");
+
+  FillSorted();
+  RunAll("Sorted");
+
+  FillReversed();
+  RunAll("Reversed");
+
+  FillFewUnique();
+  RunAll("Few unique");
+
+  return 0;
+}
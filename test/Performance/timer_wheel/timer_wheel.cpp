@@ -0,0 +1,146 @@
+// timer_wheel.cpp : Compares etl::callback_timer with etl::callback_timer_wheel.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -DETL_CALLBACK_TIMER_USE_ATOMIC_LOCK -I../../../include timer_wheel.cpp -o timer_wheel
+//
+// Each test registers the maximum number of timers with a spread of periods and
+// then repeatedly starts, stops and restarts them while ticking the controller,
+// so that thousands of timers are started, stopped and expire.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <memory>
+
+#include "etl/callback_timer.h"
+#include "etl/callback_timer_wheel.h"
+#include "etl/function.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t   N_TIMERS   = 254UL;
+const size_t   OPERATIONS = 2000000UL;
+const uint32_t MAX_PERIOD = 10000UL;
+
+size_t expired = 0UL;
+
+void on_expired()
+{
+  ++expired;
+}
+
+//*****************************************************************************
+/// An operation on a timer: start, stop or tick.
+//*****************************************************************************
+struct Operation
+{
+  enum Type
+  {
+    Start,
+    Stop,
+    Tick
+  };
+
+  Type     type;
+  uint32_t value;
+};
+
+//*****************************************************************************
+/// Runs the operations on the controller and reports the time.
+//*****************************************************************************
+template <typename TController>
+void Run(const char* name, const std::vector<uint32_t>& periods, const std::vector<Operation>& operations)
+{
+  std::unique_ptr<TController> controller(new TController);
+
+  for (size_t i = 0UL; i < N_TIMERS; ++i)
+  {
+    controller->register_timer(on_expired, periods[i], etl::timer::mode::REPEATING);
+  }
+
+  for (size_t i = 0UL; i < N_TIMERS; ++i)
+  {
+    controller->start(etl::timer::id::type(i));
+  }
+
+  controller->enable(true);
+
+  expired = 0UL;
+
+  StartTimer();
+  for (size_t i = 0UL; i < operations.size(); ++i)
+  {
+    const Operation& operation = operations[i];
+
+    switch (operation.type)
+    {
+      case Operation::Start: controller->start(etl::timer::id::type(operation.value)); break;
+      case Operation::Stop:  controller->stop(etl::timer::id::type(operation.value));  break;
+      default:               controller->tick(operation.value);                        break;
+    }
+  }
+  uint64_t time = StopTimer();
+
+  std::cout << std::setw(24) << name
+            << std::setw(12) << time / 1000U << "ms"
+            << std::setw(12) << (time * 1000U) / operations.size() << "ns/op"
+            << std::setw(12) << expired << " expired\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  std::vector<uint32_t> periods(N_TIMERS);
+
+  for (size_t i = 0UL; i < N_TIMERS; ++i)
+  {
+    periods[i] = (rng() % MAX_PERIOD) + 1U;
+  }
+
+  std::vector<Operation> operations(OPERATIONS);
+
+  for (size_t i = 0UL; i < OPERATIONS; ++i)
+  {
+    const uint32_t r = rng() % 8U;
+
+    if (r < 4U)
+    {
+      operations[i].type  = Operation::Start;
+      operations[i].value = rng() % N_TIMERS;
+    }
+    else if (r < 6U)
+    {
+      operations[i].type  = Operation::Stop;
+      operations[i].value = rng() % N_TIMERS;
+    }
+    else
+    {
+      operations[i].type  = Operation::Tick;
+      operations[i].value = (rng() % 4U) + 1U;
+    }
+  }
+
+  std::cout << N_TIMERS << " timers, " << OPERATIONS << " start/stop/tick operations\n\n";
+
+  Run<etl::callback_timer<N_TIMERS> >("callback_timer", periods, operations);
+  Run<etl::callback_timer_wheel<N_TIMERS> >("callback_timer_wheel", periods, operations);
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+// unordered_flat_map.cpp : Compares etl::unordered_flat_map against etl::unordered_map and std::unordered_map.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include unordered_flat_map.cpp -o unordered_flat_map
+//
+// Define ETL_UNORDERED_FLAT_NO_SSE2 to measure the portable group probing.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+
+#include "etl/unordered_flat_map.h"
+#include "etl/unordered_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+}
+
+const size_t TESTSIZE        = 100000UL;
+const size_t TESTINTERATIONS = 10UL;
+
+typedef std::unordered_map<uint32_t, uint32_t>                 Stdmap;
+typedef etl::unordered_map<uint32_t, uint32_t, TESTSIZE>       Etlmap;
+typedef etl::unordered_flat_map<uint32_t, uint32_t, TESTSIZE>  Flatmap;
+
+// Stops the optimiser from discarding the lookups.
+volatile uint32_t sink;
+
+//*****************************************************************************
+template <typename TMap>
+void Run(const char* name, TMap& map, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& missing)
+{
+  uint64_t insert_time = 0U;
+  uint64_t hit_time    = 0U;
+  uint64_t miss_time   = 0U;
+  uint64_t erase_time  = 0U;
+
+  for (size_t i = 0UL; i < TESTINTERATIONS; ++i)
+  {
+    map.clear();
+
+    StartTimer();
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      map.insert(typename TMap::value_type(keys[j], uint32_t(j)));
+    }
+    insert_time += StopTimer();
+
+    uint32_t sum = 0U;
+
+    StartTimer();
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      sum += map.find(keys[j])->second;
+    }
+    hit_time += StopTimer();
+
+    StartTimer();
+    for (size_t j = 0UL; j < missing.size(); ++j)
+    {
+      sum += (map.find(missing[j]) == map.end()) ? 1U : 0U;
+    }
+    miss_time += StopTimer();
+
+    sink = sum;
+
+    StartTimer();
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      map.erase(keys[j]);
+    }
+    erase_time += StopTimer();
+  }
+
+  std::cout << "  " << std::left << std::setw(24) << name << std::right
+            << std::setw(10) << (insert_time / TESTINTERATIONS) << "us"
+            << std::setw(10) << (hit_time    / TESTINTERATIONS) << "us"
+            << std::setw(10) << (miss_time   / TESTINTERATIONS) << "us"
+            << std::setw(10) << (erase_time  / TESTINTERATIONS) << "us\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  // Distinct random keys, half present and half missing.
+  std::vector<uint32_t> all(TESTSIZE * 2U);
+  std::generate(all.begin(), all.end(), [&]() { return uint32_t(rng()); });
+  std::sort(all.begin(), all.end());
+  all.erase(std::unique(all.begin(), all.end()), all.end());
+  std::shuffle(all.begin(), all.end(), rng);
+
+  std::vector<uint32_t> keys(all.begin(), all.begin() + TESTSIZE);
+  std::vector<uint32_t> missing(all.begin() + TESTSIZE, all.end());
+
+  std::cout << "Group probing : " << (etl::traits::has_unordered_flat_sse2 ? "SSE2" : "Portable") << "\n";
+  std::cout << "Elements      : " << TESTSIZE << "\n\n";
+  std::cout << "  " << std::left << std::setw(24) << "" << std::right
+            << std::setw(12) << "insert" << std::setw(12) << "hit" << std::setw(12) << "miss" << std::setw(12) << "erase" << "\n";
+
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<Flatmap> flatmap(new Flatmap);
+  std::unique_ptr<Etlmap>  etlmap(new Etlmap);
+  Stdmap stdmap;
+  stdmap.reserve(TESTSIZE);
+
+  Run("etl::unordered_flat_map", *flatmap, keys, missing);
+  Run("etl::unordered_map", *etlmap, keys, missing);
+  Run("std::unordered_map", stdmap, keys, missing);
+
+  return 0;
+}
@@ -0,0 +1,128 @@
+// unordered_map_iteration.cpp : Times iteration, clear, insert and erase for
+// etl::unordered_map at several load factors.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include unordered_map_iteration.cpp -o unordered_map_iteration
+//
+// Times are per element.
+//
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <memory>
+
+#include "etl/unordered_map.h"
+
+std::chrono::high_resolution_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::high_resolution_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+const size_t ELEMENTS = 1024UL;
+const size_t PASSES   = 200UL;
+
+// Stops the optimiser from discarding the results.
+volatile size_t sink;
+
+//*****************************************************************************
+void Report(const char* name, uint64_t time, size_t operations)
+{
+  std::cout << "  " << std::left << std::setw(12) << name << std::right << std::fixed << std::setprecision(2)
+            << std::setw(10) << (double(time) / double(operations)) << "ns\n";
+}
+
+//*****************************************************************************
+template <size_t BUCKETS>
+void Run(const std::vector<uint32_t>& keys)
+{
+  typedef etl::unordered_map<uint32_t, uint32_t, ELEMENTS, BUCKETS> Map;
+
+  // The ETL containers are large, so keep them off the stack.
+  std::unique_ptr<Map> map(new Map);
+
+  std::cout << "Buckets per element : " << (BUCKETS / ELEMENTS) << "\n";
+
+  uint64_t insert_time  = 0U;
+  uint64_t iterate_time = 0U;
+  uint64_t erase_time   = 0U;
+  uint64_t clear_time   = 0U;
+  size_t   sum          = 0U;
+
+  for (size_t pass = 0UL; pass < PASSES; ++pass)
+  {
+    StartTimer();
+    for (size_t i = 0UL; i < keys.size(); ++i)
+    {
+      map->insert(typename Map::value_type(keys[i], keys[i]));
+    }
+    insert_time += StopTimer();
+
+    StartTimer();
+    for (typename Map::const_iterator itr = map->begin(); itr != map->end(); ++itr)
+    {
+      sum += itr->second;
+    }
+    iterate_time += StopTimer();
+
+    // Erase half, then clear the rest.
+    StartTimer();
+    for (size_t i = 0UL; i < (keys.size() / 2U); ++i)
+    {
+      map->erase(keys[i]);
+    }
+    erase_time += StopTimer();
+
+    StartTimer();
+    map->clear();
+    clear_time += StopTimer();
+  }
+
+  sink = sum;
+
+  Report("insert", insert_time, PASSES * keys.size());
+  Report("iterate", iterate_time, PASSES * keys.size());
+  Report("erase", erase_time, PASSES * (keys.size() / 2U));
+  Report("clear", clear_time, PASSES * (keys.size() - (keys.size() / 2U)));
+
+  std::cout << "\n";
+}
+
+//*****************************************************************************
+int main()
+{
+  std::mt19937 rng(1);
+
+  std::vector<uint32_t> keys;
+
+  while (keys.size() < ELEMENTS)
+  {
+    keys.push_back(uint32_t(rng()));
+
+    if (keys.size() == ELEMENTS)
+    {
+      std::sort(keys.begin(), keys.end());
+      keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    }
+  }
+
+  std::shuffle(keys.begin(), keys.end(), rng);
+
+  Run<ELEMENTS>(keys);
+  Run<ELEMENTS * 8U>(keys);
+  Run<ELEMENTS * 64U>(keys);
+
+  return 0;
+}
@@ -69,6 +69,8 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_UNORDERED_MULTIMAP
 #define ETL_POLYMORPHIC_UNORDERED_SET
 #define ETL_POLYMORPHIC_UNORDERED_MULTISET
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_MAP
+#define ETL_POLYMORPHIC_UNORDERED_FLAT_SET
 #define ETL_POLYMORPHIC_STRINGS
 #define ETL_POLYMORPHIC_POOL
 #define ETL_POLYMORPHIC_VECTOR
@@ -82,6 +84,7 @@ SOFTWARE.
   #define ETL_VECTOR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_MPMC_MUTEX_FORCE_CPP03_IMPLEMENTATION
+  #define ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION
   #define ETL_OPTIONAL_FORCE_CPP03_IMPLEMENTATION
@@ -51,6 +51,7 @@ SOFTWARE.
   #define ETL_VECTOR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_MPMC_MUTEX_FORCE_CPP03_IMPLEMENTATION
+  #define ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION
   #define ETL_OPTIONAL_FORCE_CPP03_IMPLEMENTATION
@@ -30,6 +30,9 @@ SOFTWARE.
 
 #include "etl/algorithm.h"
 #include "etl/container.h"
+#include "etl/span.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
@@ -43,6 +46,7 @@ SOFTWARE.
 #include <numeric>
 #include <random>
 #include <memory>
+#include <string>
 
 namespace
 {
@@ -612,6 +616,36 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(lower_bound_branchless)
+    {
+      // Every length, including empty, with duplicates and values past each end.
+      std::vector<int> data;
+
+      for (size_t length = 0UL; length < 40UL; ++length)
+      {
+        for (int i = -1; i <= int(length / 2U) + 1; ++i)
+        {
+          std::vector<int>::iterator lb1 = std::lower_bound(data.begin(), data.end(), i);
+          std::vector<int>::iterator lb2 = etl::lower_bound_branchless(data.begin(), data.end(), i);
+          std::vector<int>::iterator lb3 = etl::lower_bound_branchless(data.begin(), data.end(), i, std::less<int>());
+
+          CHECK(lb1 == lb2);
+          CHECK(lb1 == lb3);
+        }
+
+        data.push_back(int(length / 2U));
+      }
+
+      for (int i = 0; i < 11; ++i)
+      {
+        int* lb1 = std::lower_bound(std::begin(dataS), std::end(dataS), i);
+        int* lb2 = etl::lower_bound_branchless(random_iterator<int>(std::begin(dataS)), random_iterator<int>(std::end(dataS)), i);
+
+        CHECK_EQUAL(lb1, lb2);
+      }
+    }
+
     //*************************************************************************
     TEST(upper_bound_random_iterator)
     {
@@ -1140,6 +1174,26 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(rotate_return_value)
+    {
+      std::vector<int> initial_data = { 1, 2, 3, 4, 5, 6, 7 };
+
+      for (size_t i = 0UL; i <= initial_data.size(); ++i)
+      {
+        std::vector<int> data1(initial_data);
+        std::vector<int> data2(initial_data);
+
+        int* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        int* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+
+        CHECK_EQUAL(std::distance(data1.data(), result1), std::distance(data2.data(), result2));
+
+        bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
+        CHECK(isEqual);
+      }
+    }
+
     //*************************************************************************
     TEST(any_of)
     {
@@ -2074,6 +2128,319 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(intro_sort_default)
+    {
+      // Sizes either side of the insertion sort and ninther thresholds.
+      const size_t sizes[] = { 0, 1, 2, 3, 23, 24, 25, 127, 128, 129, 1000, 10000 };
+
+      for (size_t size : sizes)
+      {
+        std::vector<int> data(size, 0);
+        std::iota(data.begin(), data.end(), 1);
+
+        for (int i = 0; i < 10; ++i)
+        {
+          std::shuffle(data.begin(), data.end(), urng);
+
+          std::vector<int> data1 = data;
+          std::vector<int> data2 = data;
+
+          std::sort(data1.begin(), data1.end());
+          etl::intro_sort(data2.begin(), data2.end());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_patterns)
+    {
+      const size_t Size = 10000;
+
+      std::vector<std::vector<int>> inputs;
+
+      std::vector<int> sorted(Size);
+      std::iota(sorted.begin(), sorted.end(), 0);
+      inputs.push_back(sorted);
+
+      std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+      inputs.push_back(reversed);
+
+      std::vector<int> few_unique(Size);
+      std::uniform_int_distribution<int> few_unique_distribution(0, 3);
+      std::generate(few_unique.begin(), few_unique.end(), [&]() { return few_unique_distribution(urng); });
+      inputs.push_back(few_unique);
+
+      std::vector<int> all_equal(Size, 42);
+      inputs.push_back(all_equal);
+
+      std::vector<int> organ_pipe(Size);
+      for (size_t i = 0; i < Size; ++i)
+      {
+        organ_pipe[i] = int((i < (Size / 2)) ? i : (Size - i));
+      }
+      inputs.push_back(organ_pipe);
+
+      std::vector<int> sawtooth(Size);
+      for (size_t i = 0; i < Size; ++i)
+      {
+        sawtooth[i] = int(i % 100);
+      }
+      inputs.push_back(sawtooth);
+
+      std::vector<int> nearly_sorted(sorted);
+      for (size_t i = 0; i < 10; ++i)
+      {
+        std::swap(nearly_sorted[urng() % Size], nearly_sorted[urng() % Size]);
+      }
+      inputs.push_back(nearly_sorted);
+
+      for (const std::vector<int>& input : inputs)
+      {
+        std::vector<int> data1 = input;
+        std::vector<int> data2 = input;
+        std::vector<int> data3 = input;
+        std::vector<int> data4 = input;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        // Non-branchless partition.
+        etl::intro_sort(data3.begin(), data3.end(), [](int a, int b) { return a < b; });
+
+        std::sort(data4.begin(), data4.end(), std::greater<int>());
+        etl::intro_sort(data1.begin(), data1.end(), etl::greater<int>());
+
+        CHECK(std::equal(data1.begin(), data1.end(), data4.begin()));
+
+        std::sort(data1.begin(), data1.end());
+        CHECK(std::equal(data1.begin(), data1.end(), data2.begin()));
+        CHECK(std::equal(data1.begin(), data1.end(), data3.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_floating_point)
+    {
+      std::vector<double> data(1000);
+      std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+      std::generate(data.begin(), data.end(), [&]() { return distribution(urng); });
+
+      std::vector<double> data1 = data;
+      std::vector<double> data2 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::intro_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_non_arithmetic)
+    {
+      std::vector<std::string> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data.push_back(std::to_string(urng() % 200));
+      }
+
+      std::vector<std::string> data1 = data;
+      std::vector<std::string> data2 = data;
+
+      std::sort(data1.begin(), data1.end());
+      etl::intro_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_c_array)
+    {
+      int data1[] = { 5, 3, 9, 1, 7, 2, 8, 6, 4, 0 };
+      int data2[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::intro_sort(std::begin(data1), std::end(data1));
+
+      bool is_same = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_default)
+    {
+      const size_t sizes[] = { 0, 1, 2, 15, 16, 17, 33, 100, 1000, 5000 };
+
+      for (size_t size : sizes)
+      {
+        std::vector<NDC> data;
+
+        for (size_t i = 0; i < size; ++i)
+        {
+          data.push_back(NDC(int(urng() % 50), int(i)));
+        }
+
+        std::vector<NDC> data1(data);
+        std::vector<NDC> data2(data);
+
+        std::stable_sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_greater)
+    {
+      std::vector<NDC> data;
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        data.push_back(NDC(int(urng() % 50), int(i)));
+      }
+
+      std::vector<NDC> data1(data);
+      std::vector<NDC> data2(data);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer)
+    {
+      const size_t Size = 1000;
+
+      // Full, half, partial and empty buffers.
+      const size_t buffer_sizes[] = { Size, Size / 2, Size / 7, 1, 0 };
+
+      std::vector<NDC> data;
+
+      for (size_t i = 0; i < Size; ++i)
+      {
+        data.push_back(NDC(int(urng() % 50), int(i)));
+      }
+
+      std::vector<NDC> data1(data);
+      std::stable_sort(data1.begin(), data1.end());
+
+      for (size_t buffer_size : buffer_sizes)
+      {
+        std::vector<NDC> data2(data);
+        std::vector<NDC> buffer(buffer_size, NDC(0));
+        etl::span<NDC>   buffer_span = buffer.empty() ? etl::span<NDC>() : etl::span<NDC>(buffer.data(), buffer.size());
+
+        etl::merge_sort(data2.begin(), data2.end(), buffer_span);
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_with_buffer_greater)
+    {
+      std::vector<NDC> data;
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        data.push_back(NDC(int(urng() % 50), int(i)));
+      }
+
+      std::vector<NDC> data1(data);
+      std::vector<NDC> data2(data);
+      std::vector<NDC> buffer(data.size() / 2, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), etl::span<NDC>(buffer.data(), buffer.size()), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_patterns)
+    {
+      const size_t Size = 2000;
+
+      std::vector<int> sorted(Size);
+      std::iota(sorted.begin(), sorted.end(), 0);
+
+      std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+      std::vector<int> few_unique(Size);
+      std::generate(few_unique.begin(), few_unique.end(), [&]() { return int(urng() % 4); });
+
+      std::vector<std::vector<int>> inputs = { sorted, reversed, few_unique };
+
+      for (const std::vector<int>& input : inputs)
+      {
+        std::vector<int> data1(input);
+        std::vector<int> data2(input);
+
+        std::sort(data1.begin(), data1.end());
+        etl::merge_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(stable_sort_etl_containers_with_buffer)
+    {
+      etl::vector<NDC, 500> vector_data;
+      etl::deque<NDC, 500>  deque_data;
+
+      for (size_t i = 0; i < 500; ++i)
+      {
+        vector_data.push_back(NDC(int(urng() % 20), int(i)));
+        deque_data.push_back(vector_data.back());
+      }
+
+      std::vector<NDC> compare_data(vector_data.begin(), vector_data.end());
+      std::stable_sort(compare_data.begin(), compare_data.end());
+
+      etl::vector<NDC, 250> buffer(250, NDC(0));
+
+      etl::stable_sort(vector_data.begin(), vector_data.end(), etl::span<NDC>(buffer.data(), buffer.size()));
+      etl::stable_sort(deque_data.begin(), deque_data.end(), etl::span<NDC>(buffer.data(), buffer.size()));
+
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), vector_data.begin(), NDC::are_identical));
+      CHECK(std::equal(compare_data.begin(), compare_data.end(), deque_data.begin(), NDC::are_identical));
+    }
+
     //*************************************************************************
     TEST(multimax)
     {
@@ -332,6 +332,144 @@ namespace
       CHECK(stream.empty());
     }
 
+    //*************************************************************************
+    TEST(test_wrapped_write_ends_readable_data_at_old_write_index)
+    {
+      etl::bip_buffer_spsc_atomic<int, 10> stream;
+      etl::ibip_buffer_spsc_atomic<int>& istream = stream;
+
+      // Fill to 9 and read it all, so that the end of the readable data is 9.
+      auto writer = istream.write_reserve(9U);
+      CHECK_EQUAL(9U, writer.size());
+      istream.write_commit(writer);
+
+      auto reader = istream.read_reserve(9U);
+      CHECK_EQUAL(9U, reader.size());
+      istream.read_commit(reader);
+
+      // Wrap to 0 and read back to 7.
+      writer = istream.write_reserve(7U);
+      CHECK_EQUAL(7U, writer.size());
+      istream.write_commit(writer);
+
+      reader = istream.read_reserve(7U);
+      CHECK_EQUAL(7U, reader.size());
+      istream.read_commit(reader);
+
+      CHECK(stream.empty());
+
+      // Too big for the space after 7, so the write wraps to 0 again.
+      writer = istream.write_reserve(5U);
+      CHECK_EQUAL(5U, writer.size());
+
+      for (size_t i = 0U; i < writer.size(); ++i)
+      {
+        writer[i] = int(i + 1U);
+      }
+
+      istream.write_commit(writer);
+
+      // The reader must not see the old elements 7 to 9 first.
+      reader = istream.read_reserve(5U);
+      CHECK_EQUAL(5U, reader.size());
+
+      for (size_t i = 0U; i < reader.size(); ++i)
+      {
+        CHECK_EQUAL(int(i + 1U), reader[i]);
+      }
+
+      istream.read_commit(reader);
+
+      CHECK(stream.empty());
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    TEST(test_read_reserve_wait_timeout)
+    {
+      etl::bip_buffer_spsc_atomic<int, 5> stream;
+
+      CHECK_EQUAL(0U, stream.read_reserve_wait(5U, 0U).size());
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      CHECK_EQUAL(0U, stream.read_reserve_wait(5U, 2000U).size());
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+      CHECK(elapsed >= std::chrono::microseconds(2000));
+
+      etl::span<int> writer = stream.write_reserve_wait(2U);
+      CHECK_EQUAL(2U, writer.size());
+      writer[0] = 1;
+      writer[1] = 2;
+      stream.write_commit(writer);
+
+      etl::span<int> reader = stream.read_reserve_wait(5U, 2000U);
+      CHECK_EQUAL(2U, reader.size());
+      CHECK_EQUAL(1, reader[0]);
+      CHECK_EQUAL(2, reader[1]);
+      stream.read_commit(reader);
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_wait_timeout)
+    {
+      etl::bip_buffer_spsc_atomic<int, 4> stream;
+
+      stream.write_commit(stream.write_reserve_wait(4U, 0U));
+      CHECK_EQUAL(0U, stream.write_reserve_wait(1U, 2000U).size());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_wait_threads)
+    {
+      etl::bip_buffer_spsc_atomic<int, 16> stream;
+
+      const int Length = 100000;
+
+      std::thread writer_thread([&stream]()
+      {
+        int next = 0;
+
+        while (next < Length)
+        {
+          etl::span<int> writer = stream.write_reserve_wait(size_t(Length - next) < 5U ? size_t(Length - next) : 5U);
+
+          for (size_t i = 0U; i < writer.size(); ++i)
+          {
+            writer[i] = next++;
+          }
+
+          stream.write_commit(writer);
+
+          // Let the reader go to sleep now and then.
+          if ((next % 10000) < 5)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          }
+        }
+      });
+
+      bool in_order = true;
+      int  expected = 0;
+
+      while (expected < Length)
+      {
+        etl::span<int> reader = stream.read_reserve_wait();
+
+        for (size_t i = 0U; i < reader.size(); ++i)
+        {
+          in_order = in_order && (reader[i] == expected++);
+        }
+
+        stream.read_commit(reader);
+      }
+
+      writer_thread.join();
+
+      CHECK(in_order);
+    }
+#endif
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
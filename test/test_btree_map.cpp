@@ -0,0 +1,861 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "data.h"
+
+#include "etl/btree_map.h"
+
+namespace
+{
+  static const size_t SIZE = 10UL;
+
+  typedef TestDataNDC<std::string> NDC;
+  typedef TestDataM<std::string>   MC;
+
+  typedef ETL_OR_STD::pair<int, NDC> ElementNDC;
+
+  typedef etl::btree_map<int, NDC, SIZE> DataNDC;
+  typedef etl::ibtree_map<int, NDC>      IDataNDC;
+
+  typedef etl::btree_map<int, MC, SIZE> DataM;
+
+  typedef std::map<int, NDC> Compare_DataNDC;
+
+  NDC N0 = NDC("A");
+  NDC N1 = NDC("B");
+  NDC N2 = NDC("C");
+  NDC N3 = NDC("D");
+  NDC N4 = NDC("E");
+  NDC N5 = NDC("F");
+  NDC N6 = NDC("G");
+  NDC N7 = NDC("H");
+  NDC N8 = NDC("I");
+  NDC N9 = NDC("J");
+  NDC N10 = NDC("K");
+
+  std::vector<ElementNDC> initial_data;
+  std::vector<ElementNDC> unsorted_data;
+  std::vector<ElementNDC> excess_data;
+
+  struct Key
+  {
+    Key(int k_)
+      : k(k_)
+    {
+    }
+
+    int k;
+  };
+
+  bool operator <(const Key& lhs, const int& rhs)
+  {
+    return (lhs.k < rhs);
+  }
+
+  bool operator <(const int& lhs, const Key& rhs)
+  {
+    return (lhs < rhs.k);
+  }
+
+  //*************************************************************************
+  // A key so large that the nodes hold the fewest keys and elements, so that
+  // a few hundred elements make a tree several levels deep.
+  //*************************************************************************
+  struct Wide_Key
+  {
+    Wide_Key(int value_)
+      : value(value_)
+    {
+      std::fill(std::begin(padding), std::end(padding), char(value_));
+    }
+
+    int  value;
+    char padding[ETL_BTREE_MAP_NODE_SIZE / 4];
+  };
+
+  bool operator <(const Wide_Key& lhs, const Wide_Key& rhs)
+  {
+    return lhs.value < rhs.value;
+  }
+
+  typedef etl::btree_map<Wide_Key, int, 500> WideData;
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  //*************************************************************************
+  // A mapped value so large that the leaves hold the fewest elements, while
+  // the internal nodes hold many int keys.
+  //*************************************************************************
+  typedef etl::btree_map<int, Wide_Key, 2000> WideMappedData;
+
+  int Value_Of(int value)
+  {
+    return value;
+  }
+
+  int Value_Of(const Wide_Key& key)
+  {
+    return key.value;
+  }
+
+  //*************************************************************************
+  // Checks the contents in both directions.
+  //*************************************************************************
+  template <typename TData>
+  bool Check_Wide_Equal(const TData& data, const std::map<int, int>& compare_data)
+  {
+    if (data.size() != compare_data.size())
+    {
+      return false;
+    }
+
+    typename TData::const_iterator itr = data.begin();
+
+    for (std::map<int, int>::const_iterator compare_itr = compare_data.begin(); compare_itr != compare_data.end(); ++compare_itr, ++itr)
+    {
+      if ((Value_Of(itr->first) != compare_itr->first) || (Value_Of(itr->second) != compare_itr->second))
+      {
+        return false;
+      }
+    }
+
+    if (itr != data.end())
+    {
+      return false;
+    }
+
+    for (std::map<int, int>::const_reverse_iterator compare_itr = compare_data.rbegin(); compare_itr != compare_data.rend(); ++compare_itr)
+    {
+      --itr;
+
+      if (Value_Of(itr->first) != compare_itr->first)
+      {
+        return false;
+      }
+    }
+
+    return itr == data.begin();
+  }
+
+  //*************************************************************************
+  // Inserts and erases at random, splitting, rebalancing and merging nodes
+  // at every level.
+  //*************************************************************************
+  template <typename TData>
+  void Random_Insert_And_Erase(TData& data)
+  {
+    typedef typename TData::key_type    Key_Type;
+    typedef typename TData::mapped_type Mapped_Type;
+
+    std::map<int, int> compare_data;
+
+    std::mt19937 generator(12345);
+    std::uniform_int_distribution<int> key_distribution(0, int(data.max_size() * 2U) - 1);
+    std::uniform_int_distribution<int> action_distribution(0, 3);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      const int key    = key_distribution(generator);
+      const int action = action_distribution(generator);
+
+      if ((action == 0) && !compare_data.empty())
+      {
+        // Erase by iterator, and check the iterator returned.
+        std::map<int, int>::iterator compare_itr = compare_data.lower_bound(key);
+
+        if (compare_itr == compare_data.end())
+        {
+          compare_itr = compare_data.begin();
+        }
+
+        typename TData::iterator itr = data.find(Key_Type(compare_itr->first));
+        CHECK(itr != data.end());
+
+        itr         = data.erase(itr);
+        compare_itr = compare_data.erase(compare_itr);
+
+        if (compare_itr == compare_data.end())
+        {
+          CHECK(itr == data.end());
+        }
+        else
+        {
+          CHECK(itr != data.end());
+          CHECK_EQUAL(compare_itr->first, Value_Of(itr->first));
+        }
+      }
+      else if (action == 1)
+      {
+        CHECK_EQUAL(compare_data.erase(key), data.erase(Key_Type(key)));
+      }
+      else if (!data.full() || (compare_data.count(key) != 0U))
+      {
+        typename TData::iterator itr = data.find(Key_Type(key));
+
+        if (itr == data.end())
+        {
+          data.insert(std::make_pair(Key_Type(key), Mapped_Type(i)));
+        }
+        else
+        {
+          itr->second = Mapped_Type(i);
+        }
+
+        compare_data[key] = i;
+      }
+
+      if ((i % 1000) == 0)
+      {
+        CHECK(Check_Wide_Equal(data, compare_data));
+      }
+    }
+
+    CHECK(Check_Wide_Equal(data, compare_data));
+
+    // Erase ranges from the middle.
+    while (data.size() > 10U)
+    {
+      typename TData::iterator first = data.begin();
+      std::advance(first, data.size() / 3U);
+
+      typename TData::iterator last = first;
+      std::advance(last, data.size() / 3U);
+
+      std::map<int, int>::iterator compare_first = compare_data.find(Value_Of(first->first));
+      std::map<int, int>::iterator compare_last  = compare_data.find(Value_Of(last->first));
+
+      typename TData::iterator itr = data.erase(first, last);
+      compare_data.erase(compare_first, compare_last);
+
+      CHECK_EQUAL(compare_last->first, Value_Of(itr->first));
+      CHECK(Check_Wide_Equal(data, compare_data));
+    }
+  }
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(0, N0), ElementNDC(1, N1), ElementNDC(2, N2), ElementNDC(3, N3), ElementNDC(4, N4),
+          ElementNDC(5, N5), ElementNDC(6, N6), ElementNDC(7, N7), ElementNDC(8, N8), ElementNDC(9, N9)
+        };
+
+        ElementNDC u[] =
+        {
+          ElementNDC(7, N7), ElementNDC(2, N2), ElementNDC(9, N9), ElementNDC(0, N0), ElementNDC(5, N5),
+          ElementNDC(3, N3), ElementNDC(8, N8), ElementNDC(1, N1), ElementNDC(6, N6), ElementNDC(4, N4)
+        };
+
+        ElementNDC x[] =
+        {
+          ElementNDC(0, N0), ElementNDC(1, N1), ElementNDC(2, N2), ElementNDC(3, N3), ElementNDC(4, N4),
+          ElementNDC(5, N5), ElementNDC(6, N6), ElementNDC(7, N7), ElementNDC(8, N8), ElementNDC(9, N9),
+          ElementNDC(10, N10)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        unsorted_data.assign(std::begin(u), std::end(u));
+        excess_data.assign(std::begin(x), std::end(x));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_DataNDC compare_data(unsorted_data.begin(), unsorted_data.end());
+
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(data.full());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::btree_map_full);
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      DataNDC data = { ElementNDC(2, N2), ElementNDC(0, N0), ElementNDC(1, N1) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(N0, data.at(0));
+      CHECK_EQUAL(N1, data.at(1));
+      CHECK_EQUAL(N2, data.at(2));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor_and_assignment)
+    {
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+      DataNDC copy(data);
+
+      CHECK(copy == data);
+
+      DataNDC other;
+      other.insert(ElementNDC(99, N10));
+      other = data;
+
+      CHECK(other == data);
+
+      IDataNDC& idata = other;
+      idata = copy;
+
+      CHECK(other == copy);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor_and_assignment)
+    {
+      DataM data;
+      data.insert(std::make_pair(2, MC("C")));
+      data.insert(std::make_pair(0, MC("A")));
+      data.insert(std::make_pair(1, MC("B")));
+
+      DataM moved(std::move(data));
+
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(std::string("A"), moved.at(0).value);
+      CHECK_EQUAL(std::string("B"), moved.at(1).value);
+      CHECK_EQUAL(std::string("C"), moved.at(2).value);
+
+      DataM other;
+      other = std::move(moved);
+
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, other.size());
+      CHECK_EQUAL(std::string("C"), other.at(2).value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index)
+    {
+      etl::btree_map<int, std::string, SIZE> strings;
+      strings[5] = "5";
+      strings[1] = "1";
+      strings[3];
+
+      CHECK_EQUAL(3U, strings.size());
+      CHECK_EQUAL(std::string("1"), strings.at(1));
+      CHECK_EQUAL(std::string(""), strings.at(3));
+      CHECK_EQUAL(std::string("5"), strings.at(5));
+
+      strings[3] = "3";
+      CHECK_EQUAL(std::string("3"), strings[3]);
+      CHECK_EQUAL(3U, strings.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_full)
+    {
+      etl::btree_map<int, int, SIZE> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_NO_THROW(data[9]);
+      CHECK_THROW(data[10], etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(N0, data.at(0));
+      CHECK_EQUAL(N9, cdata.at(9));
+      CHECK_THROW(data.at(10), etl::btree_map_out_of_bounds);
+      CHECK_THROW(cdata.at(-1), etl::btree_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      for (size_t i = 0UL; i < unsorted_data.size(); ++i)
+      {
+        ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(unsorted_data[i]);
+        compare_data.insert(unsorted_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(unsorted_data[i].first, result.first->first);
+        CHECK_EQUAL(unsorted_data[i].second, result.first->second);
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      // Already there.
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC(5, N10));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N5, result.first->second);
+
+      CHECK_THROW(data.insert(ElementNDC(10, N10)), etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_and_hint)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin() + 5, initial_data.end());
+      data.insert(data.begin(), initial_data[2]);
+      data.insert(initial_data.begin(), initial_data.begin() + 2);
+
+      CHECK_EQUAL(8U, data.size());
+      CHECK(!data.contains(3));
+      CHECK(!data.contains(4));
+      CHECK(data.contains(2));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moves)
+    {
+      DataM data;
+
+      data.insert(std::make_pair(3, MC("D")));
+      data.insert(std::make_pair(1, MC("B")));
+      data.insert(data.begin(), std::make_pair(2, MC("C")));
+      data.insert(std::make_pair(0, MC("A")));
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(std::string("A"), data.at(0).value);
+      CHECK_EQUAL(std::string("B"), data.at(1).value);
+      CHECK_EQUAL(std::string("C"), data.at(2).value);
+      CHECK_EQUAL(std::string("D"), data.at(3).value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.erase(5), data.erase(5));
+      CHECK_EQUAL(compare_data.erase(5), data.erase(5));
+      CHECK_EQUAL(compare_data.erase(0), data.erase(0));
+      CHECK_EQUAL(compare_data.erase(9), data.erase(9));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key_using_transparent_comparator)
+    {
+      using EMap = etl::btree_map<int, NDC, SIZE, etl::less<>>;
+
+      EMap data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(Key(5)));
+      CHECK_EQUAL(0U, data.erase(Key(5)));
+      CHECK_EQUAL(SIZE - 1U, data.size());
+      CHECK(!data.contains(Key(5)));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_iterators)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator i_data = data.erase(data.find(3));
+      compare_data.erase(compare_data.find(3));
+
+      CHECK_EQUAL(4, i_data->first);
+
+      DataNDC::const_iterator i_first = data.find(5);
+      DataNDC::const_iterator i_last  = data.find(8);
+
+      i_data = data.erase(i_first, i_last);
+      compare_data.erase(compare_data.find(5), compare_data.find(8));
+
+      CHECK_EQUAL(8, i_data->first);
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      i_data = data.erase(data.find(9));
+
+      CHECK(i_data == data.end());
+
+      i_data = data.erase(data.begin(), data.end());
+
+      CHECK(i_data == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      NDC::reset_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.end());
+
+        CHECK_EQUAL(SIZE, NDC::get_instance_count());
+
+        data.erase(4);
+
+        CHECK_EQUAL(SIZE - 1U, NDC::get_instance_count());
+
+        data.clear();
+
+        CHECK_EQUAL(0U, data.size());
+        CHECK_EQUAL(0U, NDC::get_instance_count());
+
+        data.insert(initial_data.begin(), initial_data.end());
+      }
+
+      CHECK_EQUAL(0U, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterator)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(Check_Equal(data.cbegin(), data.cend(), compare_data.cbegin()));
+      CHECK(Check_Equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+      CHECK(Check_Equal(data.crbegin(), data.crend(), compare_data.crbegin()));
+
+      CHECK_EQUAL(ptrdiff_t(SIZE), std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(N9, (*std::prev(data.end())).second);
+
+      // The mapped values may be modified through an iterator.
+      for (DataNDC::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        itr->second = N10;
+      }
+
+      CHECK_EQUAL(N10, data.at(0));
+      CHECK_EQUAL(N10, data.at(9));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(3, data.find(3)->first);
+      CHECK_EQUAL(N3, cdata.find(3)->second);
+      CHECK(data.find(10) == data.end());
+      CHECK(cdata.find(-1) == cdata.end());
+      CHECK_EQUAL(1U, data.count(3));
+      CHECK_EQUAL(0U, data.count(10));
+      CHECK(data.contains(9));
+      CHECK(!data.contains(10));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_using_transparent_comparator)
+    {
+      using EMap = etl::btree_map<int, NDC, SIZE, etl::less<>>;
+
+      EMap data(initial_data.begin(), initial_data.end());
+      const EMap& cdata = data;
+
+      CHECK_EQUAL(3, data.find(Key(3))->first);
+      CHECK(cdata.find(Key(10)) == cdata.end());
+      CHECK_EQUAL(N3, data.at(Key(3)));
+      CHECK_EQUAL(N4, cdata.at(Key(4)));
+      CHECK_EQUAL(1U, data.count(Key(3)));
+      CHECK(data.contains(Key(9)));
+      CHECK(!data.contains(Key(10)));
+      CHECK_EQUAL(3, data.lower_bound(Key(3))->first);
+      CHECK_EQUAL(4, cdata.upper_bound(Key(3))->first);
+      CHECK_EQUAL(3, data.equal_range(Key(3)).first->first);
+      CHECK_EQUAL(4, cdata.equal_range(Key(3)).second->first);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_bounds)
+    {
+      std::map<int, int> compare_data;
+      etl::btree_map<int, int, 1000> data;
+
+      // Enough elements for several leaves.
+      for (int i = 0; i < 2000; i += 2)
+      {
+        compare_data.insert(std::make_pair(i, i));
+        data.insert(std::make_pair(i, i));
+      }
+
+      const etl::btree_map<int, int, 1000>& cdata = data;
+
+      for (int i = -1; i <= 2000; ++i)
+      {
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(i)), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(i)), std::distance(data.begin(), data.upper_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(i)), std::distance(cdata.begin(), cdata.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(i)), std::distance(cdata.begin(), cdata.upper_bound(i)));
+
+        std::pair<std::map<int, int>::iterator, std::map<int, int>::iterator> compare_range = compare_data.equal_range(i);
+        ETL_OR_STD::pair<etl::btree_map<int, int, 1000>::iterator, etl::btree_map<int, int, 1000>::iterator> range = data.equal_range(i);
+        ETL_OR_STD::pair<etl::btree_map<int, int, 1000>::const_iterator, etl::btree_map<int, int, 1000>::const_iterator> crange = cdata.equal_range(i);
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.first), std::distance(data.begin(), range.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.second), std::distance(data.begin(), range.second));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.first), std::distance(cdata.begin(), crange.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.second), std::distance(cdata.begin(), crange.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fill_in_every_order)
+    {
+      // The node pool must be large enough, whatever the order of insertion.
+      WideData data;
+      std::map<int, int> compare_data;
+
+      std::vector<int> keys;
+
+      for (int i = 0; i < int(data.max_size()); ++i)
+      {
+        keys.push_back(i);
+      }
+
+      std::vector<int> reversed(keys.rbegin(), keys.rend());
+      std::vector<int> shuffled(keys);
+      std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(1));
+
+      const std::vector<int>* orders[] = { &keys, &reversed, &shuffled };
+
+      for (size_t i = 0UL; i < 3UL; ++i)
+      {
+        data.clear();
+        compare_data.clear();
+
+        for (size_t j = 0UL; j < orders[i]->size(); ++j)
+        {
+          int key = (*orders[i])[j];
+
+          CHECK(data.insert(std::make_pair(Wide_Key(key), key)).second);
+          compare_data.insert(std::make_pair(key, key));
+        }
+
+        CHECK(data.full());
+        CHECK(Check_Wide_Equal(data, compare_data));
+        CHECK_THROW(data.insert(std::make_pair(Wide_Key(-1), -1)), etl::btree_map_full);
+
+        // Erase every other element, then refill.
+        for (int key = 0; key < int(data.max_size()); key += 2)
+        {
+          CHECK_EQUAL(1U, data.erase(Wide_Key(key)));
+          compare_data.erase(key);
+        }
+
+        CHECK(Check_Wide_Equal(data, compare_data));
+
+        for (int key = 0; key < int(data.max_size()); key += 2)
+        {
+          data[Wide_Key(key)] = key;
+          compare_data[key] = key;
+        }
+
+        CHECK(Check_Wide_Equal(data, compare_data));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_and_erase)
+    {
+      WideData       wide_keys;
+      WideMappedData wide_values;
+
+      Random_Insert_And_Erase(wide_keys);
+      Random_Insert_And_Erase(wide_values);
+    }
+
+    //*************************************************************************
+    TEST(test_btree_map_ext)
+    {
+      typedef etl::btree_map_pool_size<int, int, 100> Pool_Size;
+
+      etl::generic_pool<Pool_Size::Node_Size, Pool_Size::Node_Alignment, Pool_Size::Node_Count> pool1;
+      etl::generic_pool<Pool_Size::Node_Size, Pool_Size::Node_Alignment, Pool_Size::Node_Count> pool2;
+
+      etl::btree_map_ext<int, int> data(pool1, 100U);
+
+      CHECK_EQUAL(100U, data.max_size());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[99 - i] = i;
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(std::make_pair(100, 100)), etl::btree_map_full);
+
+      etl::btree_map_ext<int, int> copy(data, pool2, 100U);
+
+      CHECK(copy == data);
+
+      data.clear();
+
+      CHECK_EQUAL(0U, pool1.size());
+      CHECK_EQUAL(0, copy.begin()->first);
+      CHECK_EQUAL(99, copy.begin()->second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+      CHECK(!(data1 < data2));
+      CHECK(data1 <= data2);
+      CHECK(data1 >= data2);
+
+      data2.at(5) = N10;
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+      CHECK(data2 > data1);
+
+      data2.erase(5);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_key_compare)
+    {
+      etl::btree_map<int, int, SIZE, etl::greater<int> > data;
+
+      data[1] = 1;
+      data[3] = 3;
+      data[2] = 2;
+
+      etl::btree_map<int, int, SIZE, etl::greater<int> >::const_iterator itr = data.begin();
+
+      CHECK_EQUAL(3, (itr++)->first);
+      CHECK_EQUAL(2, (itr++)->first);
+      CHECK_EQUAL(1, (itr++)->first);
+      CHECK(data.key_comp()(3, 1));
+      CHECK(data.value_comp()(std::make_pair(3, 0), std::make_pair(1, 0)));
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    TEST_FIXTURE(SetupFixture, test_btree_map_template_deduction)
+    {
+      using Pair = ETL_OR_STD::pair<const int, NDC>;
+
+      etl::btree_map data{ Pair(0, NDC("A")), Pair(1, NDC("B")), Pair(2, NDC("C")) };
+
+      CHECK((std::is_same_v<etl::btree_map<int, NDC, 3U>, decltype(data)>));
+
+      CHECK_EQUAL(NDC("A"), data.at(0));
+      CHECK_EQUAL(NDC("B"), data.at(1));
+      CHECK_EQUAL(NDC("C"), data.at(2));
+    }
+#endif
+
+    //*************************************************************************
+#if ETL_HAS_INITIALIZER_LIST
+    TEST_FIXTURE(SetupFixture, test_make_btree_map)
+    {
+      using Pair = ETL_OR_STD::pair<int, NDC>;
+
+      auto data = etl::make_btree_map<int, NDC>(Pair(2, NDC("C")), Pair(0, NDC("A")), Pair(1, NDC("B")));
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(NDC("A"), data.at(0));
+      CHECK_EQUAL(NDC("B"), data.at(1));
+      CHECK_EQUAL(NDC("C"), data.at(2));
+    }
+#endif
+  };
+}
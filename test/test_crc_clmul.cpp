@@ -0,0 +1,441 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc16.h"
+#include "etl/crc16_a.h"
+#include "etl/crc16_arc.h"
+#include "etl/crc16_aug_ccitt.h"
+#include "etl/crc16_buypass.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_cdma2000.h"
+#include "etl/crc16_dds110.h"
+#include "etl/crc16_dectr.h"
+#include "etl/crc16_dectx.h"
+#include "etl/crc16_dnp.h"
+#include "etl/crc16_en13757.h"
+#include "etl/crc16_genibus.h"
+#include "etl/crc16_kermit.h"
+#include "etl/crc16_m17.h"
+#include "etl/crc16_maxim.h"
+#include "etl/crc16_mcrf4xx.h"
+#include "etl/crc16_modbus.h"
+#include "etl/crc16_profibus.h"
+#include "etl/crc16_riello.h"
+#include "etl/crc16_t10dif.h"
+#include "etl/crc16_teledisk.h"
+#include "etl/crc16_tms37157.h"
+#include "etl/crc16_usb.h"
+#include "etl/crc16_x25.h"
+#include "etl/crc16_xmodem.h"
+#include "etl/crc32.h"
+#include "etl/crc32_bzip2.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_d.h"
+#include "etl/crc32_jamcrc.h"
+#include "etl/crc32_mpeg2.h"
+#include "etl/crc32_posix.h"
+#include "etl/crc32_q.h"
+#include "etl/crc32_xfer.h"
+#include "etl/crc64_ecma.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc8_cdma2000.h"
+#include "etl/crc8_darc.h"
+#include "etl/crc8_dvbs2.h"
+#include "etl/crc8_ebu.h"
+#include "etl/crc8_icode.h"
+#include "etl/crc8_itu.h"
+#include "etl/crc8_maxim.h"
+#include "etl/crc8_rohc.h"
+#include "etl/crc8_wcdma.h"
+
+//*****************************************************************************
+// Cross checks the contiguous range paths, including the carry-less multiply
+// folding backend when enabled and supported, against the byte-at-a-time
+// table implementation for every CRC parameter set.
+//*****************************************************************************
+
+namespace
+{
+  std::vector<uint8_t> make_data()
+  {
+    std::vector<uint8_t> data(1100U);
+
+    uint32_t value = 0x12345678UL;
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      value = (value * 1103515245UL) + 12345UL;
+      data[i] = uint8_t(value >> 16U);
+    }
+
+    return data;
+  }
+
+  const std::vector<uint8_t> data = make_data();
+
+  //***************************************************************************
+  template <typename TCrc, typename TCrcContiguous>
+  bool check_crc_type()
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const uint8_t* p_data = data.data();
+
+    // Every length up to a few fold blocks, then larger steps.
+    for (size_t length = 0UL; length <= data.size(); length += ((length < 300UL) ? 1UL : 61UL))
+    {
+      // Byte by byte, using an iterator that is not a pointer.
+      value_type expected = TCrc(data.begin(), data.begin() + length);
+      value_type crc      = TCrcContiguous(p_data, p_data + length);
+
+      if (expected != crc)
+      {
+        return false;
+      }
+
+      // Split in to two contiguous ranges, the first misaligned.
+      const size_t split = length / 3U;
+
+      TCrcContiguous crc_calculator;
+      crc_calculator.add(p_data, p_data + split);
+      crc_calculator.add(p_data + split, p_data + length);
+
+      if (expected != crc_calculator.value())
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename TCrc256, typename TCrc4, typename TCrc16, typename TCrc8x256, typename TCrc16x256>
+  bool check_crc()
+  {
+    return check_crc_type<TCrc256, TCrc256>()   &&
+           check_crc_type<TCrc256, TCrc4>()     &&
+           check_crc_type<TCrc256, TCrc16>()    &&
+           check_crc_type<TCrc256, TCrc8x256>() &&
+           check_crc_type<TCrc256, TCrc16x256>();
+  }
+
+  SUITE(test_crc_clmul)
+  {
+    //*************************************************************************
+    TEST(test_clmul_backend_state)
+    {
+#if ETL_HAS_CRC_CLMUL
+      CHECK(etl::traits::has_crc_clmul);
+#else
+      CHECK(!etl::traits::has_crc_clmul);
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_crc16)
+    {
+      CHECK((check_crc<etl::crc16_t256, etl::crc16_t4, etl::crc16_t16, etl::crc16_t8x256, etl::crc16_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_a)
+    {
+      CHECK((check_crc<etl::crc16_a_t256, etl::crc16_a_t4, etl::crc16_a_t16, etl::crc16_a_t8x256, etl::crc16_a_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_arc)
+    {
+      CHECK((check_crc<etl::crc16_arc_t256, etl::crc16_arc_t4, etl::crc16_arc_t16, etl::crc16_arc_t8x256, etl::crc16_arc_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_aug_ccitt)
+    {
+      CHECK((check_crc<etl::crc16_aug_ccitt_t256, etl::crc16_aug_ccitt_t4, etl::crc16_aug_ccitt_t16, etl::crc16_aug_ccitt_t8x256, etl::crc16_aug_ccitt_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_buypass)
+    {
+      CHECK((check_crc<etl::crc16_buypass_t256, etl::crc16_buypass_t4, etl::crc16_buypass_t16, etl::crc16_buypass_t8x256, etl::crc16_buypass_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_ccitt)
+    {
+      CHECK((check_crc<etl::crc16_ccitt_t256, etl::crc16_ccitt_t4, etl::crc16_ccitt_t16, etl::crc16_ccitt_t8x256, etl::crc16_ccitt_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_cdma2000)
+    {
+      CHECK((check_crc<etl::crc16_cdma2000_t256, etl::crc16_cdma2000_t4, etl::crc16_cdma2000_t16, etl::crc16_cdma2000_t8x256, etl::crc16_cdma2000_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_dds110)
+    {
+      CHECK((check_crc<etl::crc16_dds110_t256, etl::crc16_dds110_t4, etl::crc16_dds110_t16, etl::crc16_dds110_t8x256, etl::crc16_dds110_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_dect_r)
+    {
+      CHECK((check_crc<etl::crc16_dect_r_t256, etl::crc16_dect_r_t4, etl::crc16_dect_r_t16, etl::crc16_dect_r_t8x256, etl::crc16_dect_r_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_dect_x)
+    {
+      CHECK((check_crc<etl::crc16_dect_x_t256, etl::crc16_dect_x_t4, etl::crc16_dect_x_t16, etl::crc16_dect_x_t8x256, etl::crc16_dect_x_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_dnp)
+    {
+      CHECK((check_crc<etl::crc16_dnp_t256, etl::crc16_dnp_t4, etl::crc16_dnp_t16, etl::crc16_dnp_t8x256, etl::crc16_dnp_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_en13757)
+    {
+      CHECK((check_crc<etl::crc16_en13757_t256, etl::crc16_en13757_t4, etl::crc16_en13757_t16, etl::crc16_en13757_t8x256, etl::crc16_en13757_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_genibus)
+    {
+      CHECK((check_crc<etl::crc16_genibus_t256, etl::crc16_genibus_t4, etl::crc16_genibus_t16, etl::crc16_genibus_t8x256, etl::crc16_genibus_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_kermit)
+    {
+      CHECK((check_crc<etl::crc16_kermit_t256, etl::crc16_kermit_t4, etl::crc16_kermit_t16, etl::crc16_kermit_t8x256, etl::crc16_kermit_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_m17)
+    {
+      CHECK((check_crc<etl::crc16_m17_t256, etl::crc16_m17_t4, etl::crc16_m17_t16, etl::crc16_m17_t8x256, etl::crc16_m17_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_maxim)
+    {
+      CHECK((check_crc<etl::crc16_maxim_t256, etl::crc16_maxim_t4, etl::crc16_maxim_t16, etl::crc16_maxim_t8x256, etl::crc16_maxim_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_mcrf4xx)
+    {
+      CHECK((check_crc<etl::crc16_mcrf4xx_t256, etl::crc16_mcrf4xx_t4, etl::crc16_mcrf4xx_t16, etl::crc16_mcrf4xx_t8x256, etl::crc16_mcrf4xx_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_modbus)
+    {
+      CHECK((check_crc<etl::crc16_modbus_t256, etl::crc16_modbus_t4, etl::crc16_modbus_t16, etl::crc16_modbus_t8x256, etl::crc16_modbus_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_profibus)
+    {
+      CHECK((check_crc<etl::crc16_profibus_t256, etl::crc16_profibus_t4, etl::crc16_profibus_t16, etl::crc16_profibus_t8x256, etl::crc16_profibus_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_riello)
+    {
+      CHECK((check_crc<etl::crc16_riello_t256, etl::crc16_riello_t4, etl::crc16_riello_t16, etl::crc16_riello_t8x256, etl::crc16_riello_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_t10dif)
+    {
+      CHECK((check_crc<etl::crc16_t10dif_t256, etl::crc16_t10dif_t4, etl::crc16_t10dif_t16, etl::crc16_t10dif_t8x256, etl::crc16_t10dif_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_teledisk)
+    {
+      CHECK((check_crc<etl::crc16_teledisk_t256, etl::crc16_teledisk_t4, etl::crc16_teledisk_t16, etl::crc16_teledisk_t8x256, etl::crc16_teledisk_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_tms37157)
+    {
+      CHECK((check_crc<etl::crc16_tms37157_t256, etl::crc16_tms37157_t4, etl::crc16_tms37157_t16, etl::crc16_tms37157_t8x256, etl::crc16_tms37157_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_usb)
+    {
+      CHECK((check_crc<etl::crc16_usb_t256, etl::crc16_usb_t4, etl::crc16_usb_t16, etl::crc16_usb_t8x256, etl::crc16_usb_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_x25)
+    {
+      CHECK((check_crc<etl::crc16_x25_t256, etl::crc16_x25_t4, etl::crc16_x25_t16, etl::crc16_x25_t8x256, etl::crc16_x25_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_xmodem)
+    {
+      CHECK((check_crc<etl::crc16_xmodem_t256, etl::crc16_xmodem_t4, etl::crc16_xmodem_t16, etl::crc16_xmodem_t8x256, etl::crc16_xmodem_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32)
+    {
+      CHECK((check_crc<etl::crc32_t256, etl::crc32_t4, etl::crc32_t16, etl::crc32_t8x256, etl::crc32_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_bzip2)
+    {
+      CHECK((check_crc<etl::crc32_bzip2_t256, etl::crc32_bzip2_t4, etl::crc32_bzip2_t16, etl::crc32_bzip2_t8x256, etl::crc32_bzip2_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c)
+    {
+      CHECK((check_crc<etl::crc32_c_t256, etl::crc32_c_t4, etl::crc32_c_t16, etl::crc32_c_t8x256, etl::crc32_c_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_d)
+    {
+      CHECK((check_crc<etl::crc32_d_t256, etl::crc32_d_t4, etl::crc32_d_t16, etl::crc32_d_t8x256, etl::crc32_d_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_jamcrc)
+    {
+      CHECK((check_crc<etl::crc32_jamcrc_t256, etl::crc32_jamcrc_t4, etl::crc32_jamcrc_t16, etl::crc32_jamcrc_t8x256, etl::crc32_jamcrc_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_mpeg2)
+    {
+      CHECK((check_crc<etl::crc32_mpeg2_t256, etl::crc32_mpeg2_t4, etl::crc32_mpeg2_t16, etl::crc32_mpeg2_t8x256, etl::crc32_mpeg2_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_posix)
+    {
+      CHECK((check_crc<etl::crc32_posix_t256, etl::crc32_posix_t4, etl::crc32_posix_t16, etl::crc32_posix_t8x256, etl::crc32_posix_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_q)
+    {
+      CHECK((check_crc<etl::crc32_q_t256, etl::crc32_q_t4, etl::crc32_q_t16, etl::crc32_q_t8x256, etl::crc32_q_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_xfer)
+    {
+      CHECK((check_crc<etl::crc32_xfer_t256, etl::crc32_xfer_t4, etl::crc32_xfer_t16, etl::crc32_xfer_t8x256, etl::crc32_xfer_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma)
+    {
+      CHECK((check_crc<etl::crc64_ecma_t256, etl::crc64_ecma_t4, etl::crc64_ecma_t16, etl::crc64_ecma_t8x256, etl::crc64_ecma_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ccitt)
+    {
+      CHECK((check_crc<etl::crc8_ccitt_t256, etl::crc8_ccitt_t4, etl::crc8_ccitt_t16, etl::crc8_ccitt_t8x256, etl::crc8_ccitt_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_cdma2000)
+    {
+      CHECK((check_crc<etl::crc8_cdma2000_t256, etl::crc8_cdma2000_t4, etl::crc8_cdma2000_t16, etl::crc8_cdma2000_t8x256, etl::crc8_cdma2000_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_darc)
+    {
+      CHECK((check_crc<etl::crc8_darc_t256, etl::crc8_darc_t4, etl::crc8_darc_t16, etl::crc8_darc_t8x256, etl::crc8_darc_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_dvbs2)
+    {
+      CHECK((check_crc<etl::crc8_dvbs2_t256, etl::crc8_dvbs2_t4, etl::crc8_dvbs2_t16, etl::crc8_dvbs2_t8x256, etl::crc8_dvbs2_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_ebu)
+    {
+      CHECK((check_crc<etl::crc8_ebu_t256, etl::crc8_ebu_t4, etl::crc8_ebu_t16, etl::crc8_ebu_t8x256, etl::crc8_ebu_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_icode)
+    {
+      CHECK((check_crc<etl::crc8_icode_t256, etl::crc8_icode_t4, etl::crc8_icode_t16, etl::crc8_icode_t8x256, etl::crc8_icode_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_itu)
+    {
+      CHECK((check_crc<etl::crc8_itu_t256, etl::crc8_itu_t4, etl::crc8_itu_t16, etl::crc8_itu_t8x256, etl::crc8_itu_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_maxim)
+    {
+      CHECK((check_crc<etl::crc8_maxim_t256, etl::crc8_maxim_t4, etl::crc8_maxim_t16, etl::crc8_maxim_t8x256, etl::crc8_maxim_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_rohc)
+    {
+      CHECK((check_crc<etl::crc8_rohc_t256, etl::crc8_rohc_t4, etl::crc8_rohc_t16, etl::crc8_rohc_t8x256, etl::crc8_rohc_t16x256>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc8_wcdma)
+    {
+      CHECK((check_crc<etl::crc8_wcdma_t256, etl::crc8_wcdma_t4, etl::crc8_wcdma_t16, etl::crc8_wcdma_t8x256, etl::crc8_wcdma_t16x256>()));
+    }
+  };
+}
@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc_combine.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc8_rohc.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_dectr.h"
+#include "etl/crc16_x25.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc32_posix.h"
+#include "etl/crc64_ecma.h"
+
+namespace
+{
+  std::vector<uint8_t> make_data(size_t size)
+  {
+    std::vector<uint8_t> data(size);
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 37U) + (i >> 3U) + 11U);
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_combine_all_splits()
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const std::vector<uint8_t> data = make_data(100U);
+
+    const value_type expected = TCrc(data.begin(), data.end());
+
+    for (size_t split = 0UL; split <= data.size(); ++split)
+    {
+      const value_type crc_a = TCrc(data.begin(), data.begin() + split);
+      const value_type crc_b = TCrc(data.begin() + split, data.end());
+
+      if (etl::crc_combine<TCrc>(crc_a, crc_b, data.size() - split) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  bool check_chunked()
+  {
+    typedef typename TCrc::value_type value_type;
+
+    const std::vector<uint8_t> data = make_data(1000U);
+
+    const value_type expected = TCrc(data.begin(), data.end());
+
+    for (size_t number_of_chunks = 1UL; number_of_chunks <= 16UL; ++number_of_chunks)
+    {
+      std::vector<value_type> chunk_crcs(number_of_chunks);
+
+      value_type crc = etl::crc_chunked<TCrc>(etl::span<const uint8_t>(data.data(), data.size()), 
+                                              etl::span<value_type>(chunk_crcs.data(), chunk_crcs.size()));
+
+      if (crc != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_crc_combine)
+  {
+    //*************************************************************************
+    TEST(test_combine_reflected)
+    {
+      CHECK(check_combine_all_splits<etl::crc8_rohc>());
+      CHECK(check_combine_all_splits<etl::crc16_x25>());
+      CHECK(check_combine_all_splits<etl::crc32>());
+      CHECK(check_combine_all_splits<etl::crc32_c>());
+    }
+
+    //*************************************************************************
+    TEST(test_combine_not_reflected)
+    {
+      CHECK(check_combine_all_splits<etl::crc8_ccitt>());
+      CHECK(check_combine_all_splits<etl::crc16_ccitt>());
+      CHECK(check_combine_all_splits<etl::crc16_dectr>());
+      CHECK(check_combine_all_splits<etl::crc32_posix>());
+      CHECK(check_combine_all_splits<etl::crc64_ecma>());
+    }
+
+    //*************************************************************************
+    TEST(test_combine_member)
+    {
+      std::string data1("12345");
+      std::string data2("6789");
+
+      uint32_t crc1 = etl::crc32(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32(data2.begin(), data2.end());
+
+      CHECK_EQUAL(0xCBF43926UL, etl::crc32::combine(crc1, crc2, data2.size()));
+      CHECK_EQUAL(0xCBF43926UL, etl::crc32_t16x256::combine(crc1, crc2, data2.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_combine_large_length)
+    {
+      const std::vector<uint8_t> data = make_data(100000U);
+
+      const uint32_t expected = etl::crc32_c(data.begin(), data.end());
+
+      const uint32_t crc_a = etl::crc32_c(data.begin(), data.begin() + 3U);
+      const uint32_t crc_b = etl::crc32_c(data.begin() + 3U, data.end());
+
+      CHECK_EQUAL(expected, etl::crc_combine<etl::crc32_c>(crc_a, crc_b, data.size() - 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_chunk)
+    {
+      const std::vector<uint8_t> data = make_data(10U);
+      etl::span<const uint8_t> buffer(data.data(), data.size());
+
+      etl::span<const uint8_t> chunk0 = etl::crc_chunk(buffer, 0U, 3U);
+      etl::span<const uint8_t> chunk1 = etl::crc_chunk(buffer, 1U, 3U);
+      etl::span<const uint8_t> chunk2 = etl::crc_chunk(buffer, 2U, 3U);
+
+      CHECK(chunk0.data() == data.data());
+      CHECK_EQUAL(3U, chunk0.size());
+      CHECK(chunk1.data() == data.data() + 3U);
+      CHECK_EQUAL(3U, chunk1.size());
+      CHECK(chunk2.data() == data.data() + 6U);
+      CHECK_EQUAL(4U, chunk2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_chunk_invalid)
+    {
+      const std::vector<uint8_t> data = make_data(10U);
+      etl::span<const uint8_t> buffer(data.data(), data.size());
+
+      CHECK_THROW(etl::crc_chunk(buffer, 0U, 0U), etl::crc_combine_invalid_chunks);
+      CHECK_THROW(etl::crc_chunk(buffer, 3U, 3U), etl::crc_combine_invalid_chunks);
+    }
+
+    //*************************************************************************
+    TEST(test_chunked)
+    {
+      CHECK(check_chunked<etl::crc16_ccitt>());
+      CHECK(check_chunked<etl::crc32>());
+      CHECK(check_chunked<etl::crc32_c_t8x256>());
+      CHECK(check_chunked<etl::crc64_ecma>());
+    }
+
+    //*************************************************************************
+    TEST(test_combine_chunks)
+    {
+      const std::vector<uint8_t> data = make_data(1000U);
+      etl::span<const uint8_t> buffer(data.data(), data.size());
+
+      uint32_t chunk_crcs[5];
+
+      // Each chunk may be calculated independently, i.e. on its own thread.
+      for (size_t i = 4U; i < 5U; --i)
+      {
+        etl::span<const uint8_t> chunk = etl::crc_chunk(buffer, i, 5U);
+        chunk_crcs[i] = etl::crc32(chunk.begin(), chunk.end());
+      }
+
+      uint32_t crc = etl::crc_combine_chunks<etl::crc32>(etl::span<const uint32_t>(chunk_crcs), data.size());
+
+      CHECK_EQUAL(uint32_t(etl::crc32(data.begin(), data.end())), crc);
+    }
+  };
+}
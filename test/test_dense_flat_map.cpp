@@ -0,0 +1,631 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/dense_flat_map.h"
+
+namespace
+{
+  static const size_t SIZE = 10UL;
+
+  typedef TestDataNDC<std::string> NDC;
+  typedef TestDataM<std::string>   MC;
+
+  typedef ETL_OR_STD::pair<int, NDC> ElementNDC;
+
+  typedef etl::dense_flat_map<int, NDC, SIZE> DataNDC;
+  typedef etl::idense_flat_map<int, NDC>      IDataNDC;
+
+  typedef etl::dense_flat_map<int, MC, SIZE> DataM;
+
+  typedef std::map<int, NDC> Compare_DataNDC;
+
+  NDC N0 = NDC("A");
+  NDC N1 = NDC("B");
+  NDC N2 = NDC("C");
+  NDC N3 = NDC("D");
+  NDC N4 = NDC("E");
+  NDC N5 = NDC("F");
+  NDC N6 = NDC("G");
+  NDC N7 = NDC("H");
+  NDC N8 = NDC("I");
+  NDC N9 = NDC("J");
+  NDC N10 = NDC("K");
+
+  std::vector<ElementNDC> initial_data;
+  std::vector<ElementNDC> unsorted_data;
+  std::vector<ElementNDC> excess_data;
+
+  struct Key
+  {
+    Key(int k_)
+      : k(k_)
+    {
+    }
+
+    int k;
+  };
+
+  bool operator <(const Key& lhs, const int& rhs)
+  {
+    return (lhs.k < rhs);
+  }
+
+  bool operator <(const int& lhs, const Key& rhs)
+  {
+    return (lhs < rhs.k);
+  }
+
+  //*************************************************************************
+  template <typename T1, typename T2>
+  bool Check_Equal(T1 begin1, T1 end1, T2 begin2)
+  {
+    while (begin1 != end1)
+    {
+      if ((begin1->first != begin2->first) || (begin1->second != begin2->second))
+      {
+        return false;
+      }
+
+      ++begin1;
+      ++begin2;
+    }
+
+    return true;
+  }
+
+  SUITE(test_dense_flat_map)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(0, N0), ElementNDC(1, N1), ElementNDC(2, N2), ElementNDC(3, N3), ElementNDC(4, N4),
+          ElementNDC(5, N5), ElementNDC(6, N6), ElementNDC(7, N7), ElementNDC(8, N8), ElementNDC(9, N9)
+        };
+
+        ElementNDC u[] =
+        {
+          ElementNDC(7, N7), ElementNDC(2, N2), ElementNDC(9, N9), ElementNDC(0, N0), ElementNDC(5, N5),
+          ElementNDC(3, N3), ElementNDC(8, N8), ElementNDC(1, N1), ElementNDC(6, N6), ElementNDC(4, N4)
+        };
+
+        ElementNDC x[] =
+        {
+          ElementNDC(0, N0), ElementNDC(1, N1), ElementNDC(2, N2), ElementNDC(3, N3), ElementNDC(4, N4),
+          ElementNDC(5, N5), ElementNDC(6, N6), ElementNDC(7, N7), ElementNDC(8, N8), ElementNDC(9, N9),
+          ElementNDC(10, N10)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        unsorted_data.assign(std::begin(u), std::end(u));
+        excess_data.assign(std::begin(x), std::end(x));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_DataNDC compare_data(unsorted_data.begin(), unsorted_data.end());
+
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(data.full());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::dense_flat_map_full);
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      DataNDC data = { ElementNDC(2, N2), ElementNDC(0, N0), ElementNDC(1, N1) };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(N0, data.at(0));
+      CHECK_EQUAL(N1, data.at(1));
+      CHECK_EQUAL(N2, data.at(2));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor_and_assignment)
+    {
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+      DataNDC copy(data);
+
+      CHECK(copy == data);
+
+      DataNDC other;
+      other.insert(ElementNDC(99, N10));
+      other = data;
+
+      CHECK(other == data);
+
+      IDataNDC& idata = other;
+      idata = copy;
+
+      CHECK(other == copy);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor_and_assignment)
+    {
+      DataM data;
+      data.insert(std::make_pair(2, MC("C")));
+      data.insert(std::make_pair(0, MC("A")));
+      data.insert(std::make_pair(1, MC("B")));
+
+      DataM moved(std::move(data));
+
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(std::string("A"), moved.at(0).value);
+      CHECK_EQUAL(std::string("B"), moved.at(1).value);
+      CHECK_EQUAL(std::string("C"), moved.at(2).value);
+
+      DataM other;
+      other = std::move(moved);
+
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, other.size());
+      CHECK_EQUAL(std::string("C"), other.at(2).value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index)
+    {
+      etl::dense_flat_map<int, std::string, SIZE> strings;
+      strings[5] = "5";
+      strings[1] = "1";
+      strings[3];
+
+      CHECK_EQUAL(3U, strings.size());
+      CHECK_EQUAL(std::string("1"), strings.values()[0]);
+      CHECK_EQUAL(std::string(""), strings.values()[1]);
+      CHECK_EQUAL(std::string("5"), strings.values()[2]);
+
+      strings[3] = "3";
+      CHECK_EQUAL(std::string("3"), strings[3]);
+      CHECK_EQUAL(3U, strings.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_full)
+    {
+      etl::dense_flat_map<int, int, SIZE> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_NO_THROW(data[9]);
+      CHECK_THROW(data[10], etl::dense_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(N0, data.at(0));
+      CHECK_EQUAL(N9, cdata.at(9));
+      CHECK_THROW(data.at(10), etl::dense_flat_map_out_of_bounds);
+      CHECK_THROW(cdata.at(-1), etl::dense_flat_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      for (size_t i = 0UL; i < unsorted_data.size(); ++i)
+      {
+        ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(unsorted_data[i]);
+        compare_data.insert(unsorted_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(unsorted_data[i].first, result.first->first);
+        CHECK_EQUAL(unsorted_data[i].second, result.first->second);
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      // Already there.
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC(5, N10));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N5, result.first->second);
+
+      CHECK_THROW(data.insert(ElementNDC(10, N10)), etl::dense_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_and_hint)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin() + 5, initial_data.end());
+      data.insert(data.begin(), initial_data[2]);
+      data.insert(initial_data.begin(), initial_data.begin() + 2);
+
+      CHECK_EQUAL(8U, data.size());
+      CHECK(std::is_sorted(data.keys().begin(), data.keys().end()));
+      CHECK(!data.contains(3));
+      CHECK(!data.contains(4));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moves)
+    {
+      DataM data;
+
+      data.insert(std::make_pair(3, MC("D")));
+      data.insert(std::make_pair(1, MC("B")));
+      data.insert(std::make_pair(2, MC("C")));
+      data.insert(std::make_pair(0, MC("A")));
+
+      CHECK_EQUAL(4U, data.size());
+
+      int i = 0;
+
+      for (DataM::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(i, itr->first);
+        CHECK_EQUAL(std::string(1, char('A' + i)), itr->second.value);
+        ++i;
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_emplace)
+    {
+      etl::dense_flat_map<int, std::string, SIZE> data;
+
+      ETL_OR_STD::pair<etl::dense_flat_map<int, std::string, SIZE>::iterator, bool> result;
+
+      result = data.emplace(2, 3U, 'b');
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("bbb"), result.first->second);
+
+      result = data.emplace(1, "a");
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("a"), result.first->second);
+
+      result = data.emplace(2, "c");
+      CHECK(!result.second);
+      CHECK_EQUAL(std::string("bbb"), result.first->second);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.begin()->first);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.erase(5), data.erase(5));
+      CHECK_EQUAL(compare_data.erase(5), data.erase(5));
+      CHECK_EQUAL(compare_data.erase(0), data.erase(0));
+      CHECK_EQUAL(compare_data.erase(9), data.erase(9));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key_using_transparent_comparator)
+    {
+      using EMap = etl::dense_flat_map<int, NDC, SIZE, etl::less<>>;
+
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      EMap data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.erase(5), data.erase(Key(5)));
+      CHECK_EQUAL(compare_data.erase(5), data.erase(Key(5)));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_iterators)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator i_data = data.erase(data.find(3));
+      compare_data.erase(compare_data.find(3));
+
+      CHECK_EQUAL(4, i_data->first);
+
+      DataNDC::const_iterator i_first = data.find(5);
+      DataNDC::const_iterator i_last  = data.find(8);
+
+      i_data = data.erase(i_first, i_last);
+      compare_data.erase(compare_data.find(5), compare_data.find(8));
+
+      CHECK_EQUAL(8, i_data->first);
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+
+      i_data = data.erase(data.begin(), data.end());
+
+      CHECK(i_data == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      NDC::reset_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.end());
+
+        CHECK_EQUAL(SIZE, NDC::get_instance_count());
+
+        data.erase(4);
+
+        CHECK_EQUAL(SIZE - 1U, NDC::get_instance_count());
+
+        data.clear();
+
+        CHECK_EQUAL(0U, data.size());
+        CHECK_EQUAL(0U, NDC::get_instance_count());
+
+        data.insert(initial_data.begin(), initial_data.end());
+      }
+
+      CHECK_EQUAL(0U, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterator)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(Check_Equal(data.cbegin(), data.cend(), compare_data.cbegin()));
+      CHECK(Check_Equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+      CHECK(Check_Equal(data.crbegin(), data.crend(), compare_data.crbegin()));
+
+      CHECK_EQUAL(ptrdiff_t(SIZE), data.end() - data.begin());
+      CHECK_EQUAL(3, (data.begin() + 3)->first);
+      CHECK_EQUAL(N3, data.begin()[3].second);
+      CHECK_EQUAL(N9, (*(data.end() - 1)).second);
+      CHECK(data.begin() < data.end());
+
+      // The mapped values may be modified through an iterator.
+      for (DataNDC::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        itr->second = N10;
+      }
+
+      CHECK(std::count(data.values().begin(), data.values().end(), N10) == ptrdiff_t(SIZE));
+
+      // A reference may be converted to a value.
+      ElementNDC element = *data.begin();
+      CHECK_EQUAL(0, element.first);
+      CHECK_EQUAL(N10, element.second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_keys_and_values)
+    {
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+
+      etl::span<const int> keys   = data.keys();
+      etl::span<NDC>       values = data.values();
+
+      CHECK_EQUAL(SIZE, keys.size());
+      CHECK_EQUAL(SIZE, values.size());
+
+      for (size_t i = 0UL; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(int(i), keys[i]);
+        CHECK_EQUAL(initial_data[i].second, values[i]);
+      }
+
+      // The keys and values are each contiguous.
+      CHECK(&keys[SIZE - 1U] == &keys[0] + (SIZE - 1U));
+      CHECK(&values[SIZE - 1U] == &values[0] + (SIZE - 1U));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK_EQUAL(3, data.find(3)->first);
+      CHECK_EQUAL(N3, cdata.find(3)->second);
+      CHECK(data.find(10) == data.end());
+      CHECK(cdata.find(-1) == cdata.end());
+      CHECK_EQUAL(1U, data.count(3));
+      CHECK_EQUAL(0U, data.count(10));
+      CHECK(data.contains(9));
+      CHECK(!data.contains(10));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_using_transparent_comparator)
+    {
+      using EMap = etl::dense_flat_map<int, NDC, SIZE, etl::less<>>;
+
+      EMap data(initial_data.begin(), initial_data.end());
+      const EMap& cdata = data;
+
+      CHECK_EQUAL(3, data.find(Key(3))->first);
+      CHECK(cdata.find(Key(10)) == cdata.end());
+      CHECK_EQUAL(N3, data.at(Key(3)));
+      CHECK_EQUAL(N4, cdata.at(Key(4)));
+      CHECK_EQUAL(1U, data.count(Key(3)));
+      CHECK(data.contains(Key(9)));
+      CHECK(!data.contains(Key(10)));
+      CHECK_EQUAL(3, data.lower_bound(Key(3))->first);
+      CHECK_EQUAL(4, cdata.upper_bound(Key(3))->first);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_bounds)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      for (int i = 0; i < 10; i += 2)
+      {
+        compare_data.insert(ElementNDC(i, N0));
+        data.insert(ElementNDC(i, N0));
+      }
+
+      const DataNDC& cdata = data;
+
+      for (int i = -1; i <= 10; ++i)
+      {
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(i)), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(i)), std::distance(data.begin(), data.upper_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(i)), std::distance(cdata.begin(), cdata.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(i)), std::distance(cdata.begin(), cdata.upper_bound(i)));
+
+        ETL_OR_STD::pair<Compare_DataNDC::iterator, Compare_DataNDC::iterator> compare_range = compare_data.equal_range(i);
+        ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator>                 range         = data.equal_range(i);
+        ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator>     crange        = cdata.equal_range(i);
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.first), std::distance(data.begin(), range.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.second), std::distance(data.begin(), range.second));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.first), std::distance(cdata.begin(), crange.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.second), std::distance(cdata.begin(), crange.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2.at(5) = N10;
+
+      CHECK(data1 != data2);
+
+      data2.erase(5);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_key_compare)
+    {
+      etl::dense_flat_map<int, int, SIZE, etl::greater<int> > data;
+
+      data[1] = 1;
+      data[3] = 3;
+      data[2] = 2;
+
+      CHECK_EQUAL(3, data.keys()[0]);
+      CHECK_EQUAL(2, data.keys()[1]);
+      CHECK_EQUAL(1, data.keys()[2]);
+      CHECK(data.key_comp()(3, 1));
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    TEST_FIXTURE(SetupFixture, test_dense_flat_map_template_deduction)
+    {
+      using Pair = ETL_OR_STD::pair<const int, NDC>;
+
+      etl::dense_flat_map data{ Pair(0, NDC("A")), Pair(1, NDC("B")), Pair(2, NDC("C")) };
+
+      CHECK((std::is_same_v<etl::dense_flat_map<int, NDC, 3U>, decltype(data)>));
+
+      CHECK_EQUAL(NDC("A"), data.at(0));
+      CHECK_EQUAL(NDC("B"), data.at(1));
+      CHECK_EQUAL(NDC("C"), data.at(2));
+    }
+#endif
+
+    //*************************************************************************
+#if ETL_HAS_INITIALIZER_LIST
+    TEST_FIXTURE(SetupFixture, test_make_dense_flat_map)
+    {
+      using Pair = ETL_OR_STD::pair<int, NDC>;
+
+      auto data = etl::make_dense_flat_map<int, NDC>(Pair(2, NDC("C")), Pair(0, NDC("A")), Pair(1, NDC("B")));
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(NDC("A"), data.at(0));
+      CHECK_EQUAL(NDC("B"), data.at(1));
+      CHECK_EQUAL(NDC("C"), data.at(2));
+    }
+#endif
+  };
+}
@@ -0,0 +1,444 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/dense_flat_set.h"
+
+namespace
+{
+  static const size_t SIZE = 10UL;
+
+  typedef TestDataNDC<std::string> NDC;
+  typedef TestDataM<std::string>   MC;
+
+  typedef etl::dense_flat_set<NDC, SIZE> DataNDC;
+  typedef etl::idense_flat_set<NDC>      IDataNDC;
+
+  typedef etl::dense_flat_set<MC, SIZE> DataM;
+
+  typedef std::set<NDC> Compare_DataNDC;
+
+  NDC N0 = NDC("A");
+  NDC N1 = NDC("B");
+  NDC N2 = NDC("C");
+  NDC N3 = NDC("D");
+  NDC N4 = NDC("E");
+  NDC N5 = NDC("F");
+  NDC N6 = NDC("G");
+  NDC N7 = NDC("H");
+  NDC N8 = NDC("I");
+  NDC N9 = NDC("J");
+  NDC N10 = NDC("K");
+
+  std::vector<NDC> initial_data;
+  std::vector<NDC> unsorted_data;
+  std::vector<NDC> excess_data;
+
+  struct Key
+  {
+    Key(int k_)
+      : k(k_)
+    {
+    }
+
+    int k;
+  };
+
+  bool operator <(const Key& lhs, const int& rhs)
+  {
+    return (lhs.k < rhs);
+  }
+
+  bool operator <(const int& lhs, const Key& rhs)
+  {
+    return (lhs < rhs.k);
+  }
+
+  SUITE(test_dense_flat_set)
+  {
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        NDC n[] = { N0, N1, N2, N3, N4, N5, N6, N7, N8, N9 };
+        NDC u[] = { N7, N2, N9, N0, N5, N3, N8, N1, N6, N4 };
+        NDC x[] = { N0, N1, N2, N3, N4, N5, N6, N7, N8, N9, N10 };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        unsorted_data.assign(std::begin(u), std::end(u));
+        excess_data.assign(std::begin(x), std::end(x));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      Compare_DataNDC compare_data(unsorted_data.begin(), unsorted_data.end());
+
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(data.full());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_initializer_list)
+    {
+      DataNDC data = { N2, N0, N1 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(N0, data.data()[0]);
+      CHECK_EQUAL(N1, data.data()[1]);
+      CHECK_EQUAL(N2, data.data()[2]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor_and_assignment)
+    {
+      DataNDC data(unsorted_data.begin(), unsorted_data.end());
+      DataNDC copy(data);
+
+      CHECK(copy == data);
+
+      DataNDC other;
+      other.insert(N10);
+      other = data;
+
+      CHECK(other == data);
+
+      IDataNDC& idata = other;
+      idata = copy;
+
+      CHECK(other == copy);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor_and_assignment)
+    {
+      DataM data;
+      data.insert(MC("C"));
+      data.insert(MC("A"));
+      data.insert(MC("B"));
+
+      DataM moved(std::move(data));
+
+      CHECK(data.empty());
+      CHECK_EQUAL(3U, moved.size());
+      CHECK_EQUAL(std::string("A"), moved.begin()[0].value);
+      CHECK_EQUAL(std::string("B"), moved.begin()[1].value);
+      CHECK_EQUAL(std::string("C"), moved.begin()[2].value);
+
+      DataM other;
+      other = std::move(moved);
+
+      CHECK(moved.empty());
+      CHECK_EQUAL(3U, other.size());
+      CHECK_EQUAL(std::string("C"), other.begin()[2].value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data;
+
+      for (size_t i = 0UL; i < unsorted_data.size(); ++i)
+      {
+        ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(unsorted_data[i]);
+        compare_data.insert(unsorted_data[i]);
+
+        CHECK(result.second);
+        CHECK_EQUAL(unsorted_data[i], *result.first);
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      // Already there.
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(N5);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N5, *result.first);
+
+      CHECK_THROW(data.insert(N10), etl::dense_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::dense_flat_set_full);
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moves)
+    {
+      DataM data;
+
+      data.insert(MC("D"));
+      data.insert(data.begin(), MC("B"));
+      data.insert(MC("C"));
+      data.insert(MC("A"));
+
+      CHECK_EQUAL(4U, data.size());
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(std::string(1, char('A' + i)), data.begin()[i].value);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_emplace)
+    {
+      etl::dense_flat_set<std::string, SIZE> data;
+
+      ETL_OR_STD::pair<etl::dense_flat_set<std::string, SIZE>::iterator, bool> result;
+
+      result = data.emplace(3U, 'b');
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("bbb"), *result.first);
+
+      result = data.emplace("a");
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("a"), *result.first);
+
+      result = data.emplace("bbb");
+      CHECK(!result.second);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("a"), *data.begin());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(compare_data.erase(N5), data.erase(N5));
+      CHECK_EQUAL(compare_data.erase(N5), data.erase(N5));
+      CHECK_EQUAL(compare_data.erase(N0), data.erase(N0));
+
+      DataNDC::iterator i_data = data.erase(data.find(N3));
+      compare_data.erase(compare_data.find(N3));
+
+      CHECK_EQUAL(N4, *i_data);
+
+      i_data = data.erase(data.find(N6), data.find(N9));
+      compare_data.erase(compare_data.find(N6), compare_data.find(N9));
+
+      CHECK_EQUAL(N9, *i_data);
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      NDC::reset_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.end());
+
+        CHECK_EQUAL(SIZE, NDC::get_instance_count());
+
+        data.erase(N4);
+
+        CHECK_EQUAL(SIZE - 1U, NDC::get_instance_count());
+
+        data.clear();
+
+        CHECK_EQUAL(0U, data.size());
+        CHECK_EQUAL(0U, NDC::get_instance_count());
+
+        data.insert(initial_data.begin(), initial_data.end());
+      }
+
+      CHECK_EQUAL(0U, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterator)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(std::equal(data.cbegin(), data.cend(), compare_data.cbegin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare_data.rbegin()));
+      CHECK(std::equal(data.crbegin(), data.crend(), compare_data.crbegin()));
+
+      // The keys are contiguous.
+      CHECK(data.data() == data.begin());
+      CHECK(data.data() + SIZE == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(N3, *data.find(N3));
+      CHECK(data.find(N10) == data.end());
+      CHECK_EQUAL(1U, data.count(N3));
+      CHECK_EQUAL(0U, data.count(N10));
+      CHECK(data.contains(N9));
+      CHECK(!data.contains(N10));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_using_transparent_comparator)
+    {
+      using ESet = etl::dense_flat_set<int, SIZE, etl::less<>>;
+
+      ESet data = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      CHECK_EQUAL(3, *data.find(Key(3)));
+      CHECK(data.find(Key(10)) == data.end());
+      CHECK_EQUAL(1U, data.count(Key(3)));
+      CHECK(data.contains(Key(9)));
+      CHECK(!data.contains(Key(10)));
+      CHECK_EQUAL(3, *data.lower_bound(Key(3)));
+      CHECK_EQUAL(4, *data.upper_bound(Key(3)));
+
+      CHECK_EQUAL(1U, data.erase(Key(5)));
+      CHECK_EQUAL(0U, data.erase(Key(5)));
+      CHECK_EQUAL(9U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_bounds)
+    {
+      std::set<int> compare_data;
+      etl::dense_flat_set<int, SIZE> data;
+
+      for (int i = 0; i < 10; i += 2)
+      {
+        compare_data.insert(i);
+        data.insert(i);
+      }
+
+      for (int i = -1; i <= 10; ++i)
+      {
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.lower_bound(i)), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_data.upper_bound(i)), std::distance(data.begin(), data.upper_bound(i)));
+
+        ETL_OR_STD::pair<std::set<int>::iterator, std::set<int>::iterator> compare_range = compare_data.equal_range(i);
+        ETL_OR_STD::pair<const int*, const int*>                           range         = data.equal_range(i);
+
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.first), std::distance(data.begin(), range.first));
+        CHECK_EQUAL(std::distance(compare_data.begin(), compare_range.second), std::distance(data.begin(), range.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(unsorted_data.begin(), unsorted_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2.erase(N5);
+
+      CHECK(data1 != data2);
+
+      data2.insert(N10);
+
+      CHECK(data1 != data2);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_key_compare)
+    {
+      etl::dense_flat_set<int, SIZE, etl::greater<int> > data = { 1, 3, 2 };
+
+      CHECK_EQUAL(3, data.data()[0]);
+      CHECK_EQUAL(2, data.data()[1]);
+      CHECK_EQUAL(1, data.data()[2]);
+      CHECK(data.key_comp()(3, 1));
+      CHECK(data.value_comp()(3, 1));
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    TEST_FIXTURE(SetupFixture, test_dense_flat_set_template_deduction)
+    {
+      etl::dense_flat_set data{ NDC("C"), NDC("A"), NDC("B") };
+
+      CHECK((std::is_same_v<etl::dense_flat_set<NDC, 3U>, decltype(data)>));
+
+      CHECK_EQUAL(NDC("A"), data.data()[0]);
+      CHECK_EQUAL(NDC("B"), data.data()[1]);
+      CHECK_EQUAL(NDC("C"), data.data()[2]);
+    }
+#endif
+
+    //*************************************************************************
+#if ETL_HAS_INITIALIZER_LIST
+    TEST_FIXTURE(SetupFixture, test_make_dense_flat_set)
+    {
+      auto data = etl::make_dense_flat_set<NDC>(NDC("C"), NDC("A"), NDC("B"));
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(NDC("A"), data.data()[0]);
+      CHECK_EQUAL(NDC("B"), data.data()[1]);
+      CHECK_EQUAL(NDC("C"), data.data()[2]);
+    }
+#endif
+  };
+}
@@ -74,6 +74,10 @@ namespace
       CHECK_EQUAL((ETL_HAS_ISTRING_REPAIR == 1),               etl::traits::has_istring_repair);
       CHECK_EQUAL((ETL_HAS_IVECTOR_REPAIR == 1),               etl::traits::has_ivector_repair);
       CHECK_EQUAL((ETL_HAS_IDEQUE_REPAIR == 1),                etl::traits::has_ideque_repair);
+      CHECK_EQUAL((ETL_HAS_CRC_CLMUL == 1),                    etl::traits::has_crc_clmul);
+      CHECK_EQUAL((ETL_HAS_UNORDERED_FLAT_SSE2 == 1),          etl::traits::has_unordered_flat_sse2);
+      CHECK_EQUAL((ETL_HAS_HASH_WYHASH == 1),                  etl::traits::has_hash_wyhash);
+      CHECK_EQUAL((ETL_HAS_SPSC_ATOMIC_WAIT == 1),             etl::traits::has_spsc_atomic_wait);
       CHECK_EQUAL((ETL_HAS_MUTABLE_ARRAY_VIEW == 1),           etl::traits::has_mutable_array_view);     
       CHECK_EQUAL((ETL_IS_DEBUG_BUILD == 1),                   etl::traits::is_debug_build);
       CHECK_EQUAL(__cplusplus,                                 etl::traits::cplusplus);
@@ -82,6 +86,7 @@ namespace
       CHECK_EQUAL(ETL_VERSION_PATCH,                           etl::traits::version_patch);
       CHECK_EQUAL(ETL_VERSION_VALUE,                           etl::traits::version);
       CHECK_EQUAL(17,                                          etl::traits::language_standard);
+      CHECK_EQUAL(size_t(ETL_CACHE_LINE_SIZE),                 etl::traits::cache_line_size);
 
       CHECK_ARRAY_EQUAL(ETL_VERSION, etl::traits::version_string,    etl::strlen(ETL_VERSION));
       CHECK_ARRAY_EQUAL(ETL_VERSION, etl::traits::version_wstring,   etl::strlen(ETL_VERSION_W));
@@ -0,0 +1,242 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <string>
+
+#include "data.h"
+
+#include "etl/eytzinger_view.h"
+#include "etl/flat_map.h"
+#include "etl/reference_flat_set.h"
+
+namespace
+{
+  typedef TestDataNDC<std::string> NDC;
+
+  struct Key
+  {
+    Key(int k_)
+      : k(k_)
+    {
+    }
+
+    int k;
+  };
+
+  bool operator <(const Key& lhs, const int& rhs)
+  {
+    return (lhs.k < rhs);
+  }
+
+  bool operator <(const int& lhs, const Key& rhs)
+  {
+    return (lhs < rhs.k);
+  }
+
+  SUITE(test_eytzinger_view)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::eytzinger_view<int, 10> view;
+
+      CHECK_EQUAL(0U, view.size());
+      CHECK(view.empty());
+      CHECK(!view.full());
+      CHECK_EQUAL(10U, view.capacity());
+      CHECK_EQUAL(10U, view.max_size());
+      CHECK_EQUAL(0U, view.lower_bound(1));
+      CHECK_EQUAL(0U, view.upper_bound(1));
+      CHECK_EQUAL(0U, view.find(1));
+      CHECK(!view.contains(1));
+    }
+
+    //*************************************************************************
+    TEST(test_search_every_size)
+    {
+      // Every tree shape, from empty to several levels, with duplicates.
+      etl::eytzinger_view<int, 70> view;
+      std::vector<int> data;
+
+      for (size_t size = 0UL; size <= 70UL; ++size)
+      {
+        view.assign(data.begin(), data.end());
+
+        CHECK_EQUAL(data.size(), view.size());
+
+        for (int key = -1; key <= int(size) + 1; ++key)
+        {
+          const size_t lower = size_t(std::lower_bound(data.begin(), data.end(), key) - data.begin());
+          const size_t upper = size_t(std::upper_bound(data.begin(), data.end(), key) - data.begin());
+          const bool   found = std::binary_search(data.begin(), data.end(), key);
+
+          CHECK_EQUAL(lower, view.lower_bound(key));
+          CHECK_EQUAL(upper, view.upper_bound(key));
+          CHECK_EQUAL(upper - lower, view.count(key));
+          CHECK_EQUAL(found, view.contains(key));
+          CHECK_EQUAL(found ? lower : data.size(), view.find(key));
+        }
+
+        // Odd sizes add a duplicate of the last key.
+        data.push_back(int((size + 1U) / 2U) * 2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_view_of_flat_map)
+    {
+      typedef etl::flat_map<int, std::string, 8> Map;
+
+      Map map;
+      map[40] = "40";
+      map[10] = "10";
+      map[30] = "30";
+      map[20] = "20";
+
+      etl::eytzinger_view<int, 8> view(map.begin(), map.end(), [](const Map::value_type& element) { return element.first; });
+
+      CHECK_EQUAL(4U, view.size());
+
+      size_t index = view.find(30);
+      CHECK_EQUAL(2U, index);
+      CHECK_EQUAL(std::string("30"), std::next(map.begin(), index)->second);
+
+      CHECK_EQUAL(map.size(), view.find(35));
+      CHECK_EQUAL(3U, view.lower_bound(35));
+      CHECK_EQUAL(0U, view.lower_bound(5));
+    }
+
+    //*************************************************************************
+    TEST(test_view_of_reference_flat_set)
+    {
+      typedef etl::reference_flat_set<int, 8> Set;
+
+      int values[] = { 3, 1, 4, 5, 9, 2, 6 };
+
+      Set set;
+
+      for (size_t i = 0UL; i < (sizeof(values) / sizeof(values[0])); ++i)
+      {
+        set.insert(values[i]);
+      }
+
+      etl::eytzinger_view<int, 8> view(set.begin(), set.end());
+
+      CHECK_EQUAL(set.size(), view.size());
+
+      for (int key = 0; key < 10; ++key)
+      {
+        size_t index = view.find(key);
+
+        if (set.find(key) == set.end())
+        {
+          CHECK_EQUAL(view.size(), index);
+        }
+        else
+        {
+          CHECK_EQUAL(key, *std::next(set.begin(), index));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::eytzinger_view<int, 4> view;
+
+      int too_many[] = { 1, 2, 3, 4, 5 };
+      int unsorted[] = { 1, 3, 2 };
+
+      CHECK_THROW(view.assign(std::begin(too_many), std::end(too_many)), etl::eytzinger_view_full);
+      CHECK(view.empty());
+
+      CHECK_THROW(view.assign(std::begin(unsorted), std::end(unsorted)), etl::eytzinger_view_unsorted);
+      CHECK(view.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_keys_are_destroyed)
+    {
+      NDC::reset_instance_count();
+
+      std::vector<NDC> data;
+      data.push_back(NDC("A"));
+      data.push_back(NDC("B"));
+      data.push_back(NDC("C"));
+
+      {
+        etl::eytzinger_view<NDC, 4> view(data.begin(), data.end());
+        etl::ieytzinger_view<NDC>& iview = view;
+
+        CHECK_EQUAL(6, NDC::get_instance_count());
+        CHECK_EQUAL(1U, iview.find(NDC("B")));
+
+        iview.assign(data.begin(), data.begin() + 2);
+
+        CHECK_EQUAL(5, NDC::get_instance_count());
+        CHECK_EQUAL(2U, iview.find(NDC("C")));
+      }
+
+      CHECK_EQUAL(3, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_key_compare)
+    {
+      int data[] = { 9, 7, 5, 3, 1 };
+
+      etl::eytzinger_view<int, 5, etl::greater<int> > view(std::begin(data), std::end(data));
+
+      CHECK_EQUAL(0U, view.find(9));
+      CHECK_EQUAL(4U, view.find(1));
+      CHECK_EQUAL(2U, view.lower_bound(6));
+      CHECK(view.key_comp()(9, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_using_transparent_comparator)
+    {
+      int data[] = { 1, 3, 5, 7 };
+
+      etl::eytzinger_view<int, 4, etl::less<> > view(std::begin(data), std::end(data));
+
+      CHECK_EQUAL(1U, view.find(Key(3)));
+      CHECK_EQUAL(4U, view.find(Key(4)));
+      CHECK_EQUAL(2U, view.lower_bound(Key(4)));
+      CHECK_EQUAL(2U, view.upper_bound(Key(3)));
+      CHECK_EQUAL(1U, view.count(Key(5)));
+      CHECK(view.contains(Key(7)));
+      CHECK(!view.contains(Key(8)));
+    }
+  };
+}
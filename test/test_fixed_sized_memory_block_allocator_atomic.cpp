@@ -0,0 +1,431 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_sized_memory_block_allocator_atomic.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+
+#include <thread>
+#include <vector>
+#include <set>
+
+namespace
+{
+  using Allocator8  = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int8_t),  alignof(int8_t),  4>;
+  using Allocator16 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int16_t), alignof(int16_t), 4>;
+  using Allocator32 = etl::fixed_sized_memory_block_allocator_atomic<sizeof(int32_t), alignof(int32_t), 4>;
+
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  SUITE(test_fixed_sized_memory_block_allocator_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocator_no_successor_use_all_allocation)
+    {
+      Allocator16 allocator16;
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(int16_t)));
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(p3 != nullptr);
+      CHECK(p4 != nullptr);
+      CHECK(p5 == nullptr);
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(!allocator16.release(p5));
+    }
+
+    //*************************************************************************
+    template <typename TAllocator>
+    void check_use_all_blocks(TAllocator& allocator)
+    {
+      std::set<void*> blocks;
+
+      for (size_t i = 0U; i < TAllocator::Size; ++i)
+      {
+        blocks.insert(allocator.allocate(sizeof(int8_t), alignof(int8_t)));
+      }
+
+      CHECK_EQUAL(TAllocator::Size, blocks.size());
+      CHECK(blocks.find(nullptr) == blocks.end());
+      CHECK(allocator.allocate(sizeof(int8_t), alignof(int8_t)) == nullptr);
+
+      for (std::set<void*>::iterator itr = blocks.begin(); itr != blocks.end(); ++itr)
+      {
+        CHECK(allocator.release(*itr));
+      }
+
+      CHECK(allocator.allocate(sizeof(int8_t), alignof(int8_t)) != nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_index_sizes)
+    {
+      // The index field is sized from the number of blocks.
+      etl::fixed_sized_memory_block_allocator_atomic<1U, 1U, 1U>   allocator1;
+      etl::fixed_sized_memory_block_allocator_atomic<1U, 1U, 127U> allocator127;
+      etl::fixed_sized_memory_block_allocator_atomic<1U, 1U, 128U> allocator128;
+
+      check_use_all_blocks(allocator1);
+      check_use_all_blocks(allocator127);
+      check_use_all_blocks(allocator128);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_has_successors)
+    {
+      Allocator16 allocator16;
+      Allocator16 allocator16s;
+      Allocator16 allocator16ss;
+
+      allocator16.set_successor(allocator16s);
+      allocator16s.set_successor(allocator16ss);
+
+      CHECK(allocator16.has_successor()   == true);
+      CHECK(allocator16s.has_successor()  == true);
+      CHECK(allocator16ss.has_successor() == false);
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_successors_use_all_allocation)
+    {          
+      Allocator16 allocator16;
+      Allocator16 allocator16s;
+      Allocator16 allocator16ss;
+      
+      allocator16.set_successor(allocator16s);
+      allocator16s.set_successor(allocator16ss);
+
+      int16_t* p1 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p2 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p3 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p4 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p5 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p6 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p7 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p8 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p9 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p10 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p11 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p12 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+      int16_t* p13 = static_cast<int16_t*>(allocator16.allocate(sizeof(int16_t), alignof(uint16_t)));
+
+      CHECK(p1  != nullptr);
+      CHECK(p2  != nullptr);
+      CHECK(p3  != nullptr);
+      CHECK(p4  != nullptr);
+      CHECK(p5  != nullptr);
+      CHECK(p6  != nullptr);
+      CHECK(p7  != nullptr);
+      CHECK(p8  != nullptr);
+      CHECK(p9  != nullptr);
+      CHECK(p10 != nullptr);
+      CHECK(p11 != nullptr);
+      CHECK(p12 != nullptr);
+      CHECK(p13 == nullptr);
+
+      CHECK(allocator16.release(p1));
+      CHECK(allocator16.release(p2));
+      CHECK(allocator16.release(p3));
+      CHECK(allocator16.release(p4));
+      CHECK(allocator16.release(p5));
+      CHECK(allocator16.release(p6));
+      CHECK(allocator16.release(p7));
+      CHECK(allocator16.release(p8));
+      CHECK(allocator16.release(p9));
+      CHECK(allocator16.release(p10));
+      CHECK(allocator16.release(p11));
+      CHECK(allocator16.release(p12));
+      CHECK(!allocator16.release(p13));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_with_different_block_sized_successors)
+    {
+      Allocator8  allocator8;
+      Allocator16 allocator16;
+      Allocator32 allocator32;
+
+      allocator8.set_successor(allocator16, allocator32);
+
+      int8_t*  p1  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator8
+      int16_t* p2  = static_cast<int16_t*>(allocator8.allocate(sizeof(int16_t), alignof(uint16_t))); // Take from allocator16
+      int32_t* p3  = static_cast<int32_t*>(allocator8.allocate(sizeof(int32_t), alignof(uint32_t))); // Take from allocator32
+      int64_t* p4  = static_cast<int64_t*>(allocator8.allocate(sizeof(int64_t), alignof(uint64_t))); // Unable to allocate
+      int8_t*  p5  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator8
+      int8_t*  p6  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator8
+      int8_t*  p7  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator8. allocator8 is now full.
+      int8_t*  p8  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator16
+      int8_t*  p9  = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator16
+      int8_t*  p10 = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator16. allocator16 now is full.
+      int8_t*  p11 = static_cast<int8_t*>(allocator8.allocate(sizeof(int8_t),   alignof(uint8_t)));  // Take from allocator32
+
+      CHECK(p1  != nullptr);
+      CHECK(p2  != nullptr);
+      CHECK(p3  != nullptr);
+      CHECK(p4  == nullptr);
+      CHECK(p5  != nullptr);
+      CHECK(p6  != nullptr);
+      CHECK(p7  != nullptr);
+      CHECK(p8  != nullptr);
+      CHECK(p9  != nullptr);
+      CHECK(p10 != nullptr);
+      CHECK(p11 != nullptr);
+
+      // Take from allocator8
+      CHECK(allocator8.is_owner_of(p1));
+      CHECK(!allocator16.is_owner_of(p1));
+      CHECK(!allocator32.is_owner_of(p1));
+
+      // Take from allocator16
+      CHECK(allocator8.is_owner_of(p2));
+      CHECK(allocator16.is_owner_of(p2));
+      CHECK(!allocator32.is_owner_of(p2));
+
+      // Take from allocator32
+      CHECK(allocator8.is_owner_of(p3));
+      CHECK(allocator16.is_owner_of(p3));
+      CHECK(allocator32.is_owner_of(p3));
+            
+      // Unable to allocate
+      CHECK(!allocator8.is_owner_of(p4));
+      CHECK(!allocator16.is_owner_of(p4));
+      CHECK(!allocator32.is_owner_of(p4));
+
+      // Take from allocator8
+      CHECK(allocator8.is_owner_of(p5));
+      CHECK(!allocator16.is_owner_of(p5));
+      CHECK(!allocator32.is_owner_of(p5));
+
+      // Take from allocator8
+      CHECK(allocator8.is_owner_of(p6));
+      CHECK(!allocator16.is_owner_of(p6));
+      CHECK(!allocator32.is_owner_of(p6));
+
+      // Take from allocator8.
+      CHECK(allocator8.is_owner_of(p7));
+      CHECK(!allocator16.is_owner_of(p7));
+      CHECK(!allocator32.is_owner_of(p7));
+
+      // Take from allocator16
+      CHECK(allocator8.is_owner_of(p8));
+      CHECK(allocator16.is_owner_of(p8));
+      CHECK(!allocator32.is_owner_of(p8));
+
+      // Take from allocator16
+      CHECK(allocator8.is_owner_of(p9));
+      CHECK(allocator16.is_owner_of(p9));
+      CHECK(!allocator32.is_owner_of(p9));
+
+      // Take from allocator16.
+      CHECK(allocator8.is_owner_of(p10));
+      CHECK(allocator16.is_owner_of(p10));
+      CHECK(!allocator32.is_owner_of(p10));
+
+      // Take from allocator32
+      CHECK(allocator8.is_owner_of(p11));
+      CHECK(allocator16.is_owner_of(p11));
+      CHECK(allocator32.is_owner_of(p11));
+
+      CHECK(allocator8.release(p1));
+      CHECK(allocator8.release(p2));
+      CHECK(allocator8.release(p3));
+      CHECK(!allocator8.release(p4));
+      CHECK(allocator8.release(p5));
+      CHECK(allocator8.release(p6));
+      CHECK(allocator8.release(p7));
+      CHECK(allocator8.release(p8));
+      CHECK(allocator8.release(p9));
+      CHECK(allocator8.release(p10));
+      CHECK(allocator8.release(p11));
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_reuse_and_ownership)
+    {
+      using Allocator = etl::fixed_sized_memory_block_allocator_atomic<24, 8, 3>;
+
+      Allocator allocator;
+
+      CHECK(allocator.allocate(25, 8) == nullptr); // Too big.
+      CHECK(allocator.allocate(8, 16) == nullptr); // Alignment too large.
+
+      std::set<char*> blocks;
+
+      for (int i = 0; i < 3; ++i)
+      {
+        char* p = static_cast<char*>(allocator.allocate(24, 8));
+        CHECK(p != nullptr);
+        CHECK((reinterpret_cast<uintptr_t>(p) % 8U) == 0U);
+        blocks.insert(p);
+      }
+
+      CHECK_EQUAL(3U, blocks.size());
+      CHECK(allocator.allocate(1, 1) == nullptr);
+
+      char* p = *blocks.begin();
+
+      CHECK(allocator.is_owner_of(p));
+      CHECK(!allocator.is_owner_of(p + 1)); // Not the start of a block.
+      CHECK(!allocator.release(p + 1));
+
+      CHECK(allocator.release(p));
+      CHECK(allocator.allocate(24, 8) == p); // The released block is reused.
+
+      for (std::set<char*>::iterator itr = blocks.begin(); itr != blocks.end(); ++itr)
+      {
+        CHECK(allocator.release(*itr));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocator_multiple_threads)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 20000U;
+      const size_t Blocks     = 8U;
+
+      using Allocator = etl::fixed_sized_memory_block_allocator_atomic<sizeof(size_t), alignof(size_t), Blocks>;
+
+      Allocator allocator;
+      std::atomic<size_t> errors(0U);
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&allocator, &errors, t]()
+        {
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            size_t* p = static_cast<size_t*>(allocator.allocate(sizeof(size_t), alignof(size_t)));
+
+            if (p == nullptr)
+            {
+              std::this_thread::yield();
+              continue;
+            }
+
+            // No other thread may have the block.
+            *p = t;
+            std::this_thread::yield();
+
+            if (*p != t)
+            {
+              ++errors;
+            }
+
+            if (!allocator.release(p))
+            {
+              ++errors;
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(0U, errors.load());
+
+      // All of the blocks are free again.
+      std::set<void*> blocks;
+
+      for (size_t i = 0U; i < Blocks; ++i)
+      {
+        blocks.insert(allocator.allocate(sizeof(size_t), alignof(size_t)));
+      }
+
+      CHECK_EQUAL(Blocks, blocks.size());
+      CHECK(blocks.count(nullptr) == 0U);
+      CHECK(allocator.allocate(sizeof(size_t), alignof(size_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool_multiple_threads)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 20000U;
+
+      using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1>;
+      using Allocator = etl::fixed_sized_memory_block_allocator_atomic<pool_message_parameters::max_size, pool_message_parameters::max_alignment, Threads>;
+
+      // No lock is needed.
+      Allocator allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      std::atomic<size_t> errors(0U);
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&pool, &errors, t]()
+        {
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            const int value = int((t * Iterations) + i);
+
+            etl::shared_message message(pool, Message1(value));
+            etl::shared_message copy(message);
+
+            if (static_cast<const Message1&>(copy.get_message()).value != value)
+            {
+              ++errors;
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(0U, errors.load());
+    }
+  }
+}
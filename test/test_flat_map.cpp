@@ -1554,5 +1554,122 @@ namespace
       CHECK(data.contains(Key(1)));
       CHECK(!data.contains(Key(99)));
     }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_empty_map)
+    {
+      typedef etl::flat_map<int, int, 64> Data;
+
+      for (int size = 0; size <= 64; ++size)
+      {
+        std::vector<ElementInt> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+          values.push_back(ElementInt(i * 2, i));
+        }
+
+        Data data;
+        data.insert_sorted(values.begin(), values.end());
+
+        CHECK_EQUAL(values.size(), data.size());
+        CHECK(Check_Equal(values.begin(), values.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_map)
+    {
+      typedef etl::flat_map<int, int, 64> Data;
+
+      for (int step = 1; step < 6; ++step)
+      {
+        Data data;
+        std::map<int, int> compare;
+
+        for (int i = 0; i < 32; i += step)
+        {
+          data.insert(ElementInt(i, i));
+          compare.insert(ElementInt(i, i));
+        }
+
+        // Overlapping the existing keys, with repeats.
+        std::vector<ElementInt> values;
+
+        for (int i = -step; i <= 40; i += step + 1)
+        {
+          values.push_back(ElementInt(i, -i));
+          values.push_back(ElementInt(i, 100));
+        }
+
+        data.insert_sorted(values.begin(), values.end());
+        compare.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_unsorted_range)
+    {
+      DataInt data;
+      data.insert(ElementInt(2, 9));
+
+      std::vector<ElementInt> values = { { 1, 0 }, { 3, 0 }, { 2, 0 }, { 0, 0 }, { 3, 5 }, { 4, 0 } };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      std::map<int, int> compare = { { 2, 9 } };
+      compare.insert(values.begin(), values.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(ElementInt(i * 2, i));
+      }
+
+      // Fits, once the keys that are already there are skipped.
+      std::vector<ElementInt> values = { { 0, 0 }, { 2, 0 }, { 3, 0 }, { 5, 0 } };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(data.find(3) != data.end());
+      CHECK(data.find(5) != data.end());
+
+      values = { { 7, 0 } };
+
+      CHECK_THROW(data.insert_sorted(values.begin(), values.end()), etl::flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.begin() + 4);
+
+      data.assign_sorted(initial_data.begin() + 2, initial_data.end());
+
+      CHECK_EQUAL(initial_data.size() - 2U, data.size());
+      CHECK(Check_Equal(initial_data.begin() + 2, initial_data.end(), data.begin()));
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+
+      // Merge the first two back in.
+      data.insert_sorted(initial_data.begin(), initial_data.begin() + 2);
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(Check_Equal(initial_data.begin(), initial_data.end(), data.begin()));
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+    }
   };
 }
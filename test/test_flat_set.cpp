@@ -1232,5 +1232,121 @@ namespace
       CHECK(data.contains(Key(N5)));
       CHECK(!data.contains(Key(NX)));
     }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_empty_set)
+    {
+      typedef etl::flat_set<int, 64> Data;
+
+      for (int size = 0; size <= 64; ++size)
+      {
+        std::vector<int> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+          values.push_back(i * 2);
+        }
+
+        Data data;
+        data.insert_sorted(values.begin(), values.end());
+
+        CHECK_EQUAL(values.size(), data.size());
+        CHECK(std::equal(values.begin(), values.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_set)
+    {
+      typedef etl::flat_set<int, 64> Data;
+
+      for (int step = 1; step < 6; ++step)
+      {
+        Data data;
+        std::set<int> compare;
+
+        for (int i = 0; i < 32; i += step)
+        {
+          data.insert(i);
+          compare.insert(i);
+        }
+
+        // Overlapping the existing values, with repeats.
+        std::vector<int> values;
+
+        for (int i = -step; i <= 40; i += step + 1)
+        {
+          values.push_back(i);
+          values.push_back(i);
+        }
+
+        data.insert_sorted(values.begin(), values.end());
+        compare.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_unsorted_range)
+    {
+      DataInt data;
+      data.insert(2);
+
+      std::vector<int> values = { 1, 3, 2, 0, 3, 4 };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      std::set<int> compare = { 0, 1, 2, 3, 4 };
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.insert(i * 2);
+      }
+
+      // Fits, once the values that are already there are skipped.
+      std::vector<int> values = { 0, 2, 3, 5 };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      CHECK(data.full());
+      CHECK(data.find(3) != data.end());
+      CHECK(data.find(5) != data.end());
+
+      values = { 7 };
+
+      CHECK_THROW(data.insert_sorted(values.begin(), values.end()), etl::flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_sorted)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.begin() + 4);
+
+      data.assign_sorted(initial_data.begin() + 2, initial_data.end());
+
+      CHECK_EQUAL(initial_data.size() - 2U, data.size());
+      CHECK(std::equal(initial_data.begin() + 2, initial_data.end(), data.begin()));
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+
+      // Merge the first two back in.
+      data.insert_sorted(initial_data.begin(), initial_data.begin() + 2);
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(std::equal(initial_data.begin(), initial_data.end(), data.begin()));
+      CHECK_EQUAL(current_count + int(data.size()), NDC::get_instance_count());
+    }
   };
 }
@@ -83,6 +83,42 @@ namespace
     return (lhs < rhs.k);
   }
 
+  //***************************************************************************
+  // Gives the tests access to the tree, to check that it is balanced.
+  //***************************************************************************
+  class Sorted_Data : public etl::map<int, int, 64>
+  {
+  public:
+
+    // The height of the tree, or -1 if it is not balanced or a weight is wrong.
+    int height() const
+    {
+      return height(root_node);
+    }
+
+  private:
+
+    static int height(const Node* node)
+    {
+      if (node == nullptr)
+      {
+        return 0;
+      }
+
+      const int left  = height(node->children[kLeft]);
+      const int right = height(node->children[kRight]);
+
+      const uint_least8_t weight = (left > right) ? uint_least8_t(kLeft) : ((right > left) ? uint_least8_t(kRight) : uint_least8_t(kNeither));
+
+      if ((left < 0) || (right < 0) || (std::abs(left - right) > 1) || (node->weight != weight))
+      {
+        return -1;
+      }
+
+      return 1 + std::max(left, right);
+    }
+  };
+
   SUITE(test_map)
   {
     //*************************************************************************
@@ -1630,5 +1666,140 @@ namespace
       CHECK(!data.contains(std::string("99")));
       CHECK(!data.contains(Key("99")));
     }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_empty_map)
+    {
+      for (int size = 0; size <= 64; ++size)
+      {
+        std::vector<std::pair<int, int>> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+          values.push_back(std::make_pair(i * 2, i));
+        }
+
+        Sorted_Data data;
+        data.insert_sorted(values.begin(), values.end());
+
+        CHECK_EQUAL(values.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(values.begin(), values.end(), data.begin()));
+
+        // The built tree still balances as it shrinks and grows.
+        std::map<int, int> compare(values.begin(), values.end());
+
+        for (int i = 0; i < size; i += 3)
+        {
+          data.erase(i * 2);
+          compare.erase(i * 2);
+        }
+
+        for (int i = 0; !data.full(); ++i)
+        {
+          data.insert(std::make_pair((i * 2) + 1, i));
+          compare.insert(std::make_pair((i * 2) + 1, i));
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_map)
+    {
+      for (int step = 1; step < 6; ++step)
+      {
+        Sorted_Data data;
+        std::map<int, int> compare;
+
+        for (int i = 0; i < 32; i += step)
+        {
+          data.insert(std::make_pair(i, i));
+          compare.insert(std::make_pair(i, i));
+        }
+
+        // Overlapping the existing keys, with repeats.
+        std::vector<std::pair<int, int>> values;
+
+        for (int i = -step; i <= 40; i += step + 1)
+        {
+          values.push_back(std::make_pair(i, -i));
+          values.push_back(std::make_pair(i, 100));
+        }
+
+        data.insert_sorted(values.begin(), values.end());
+        compare.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_unsorted_range)
+    {
+      Sorted_Data data;
+      data.insert(std::make_pair(2, 9));
+
+      std::vector<std::pair<int, int>> values = { { 1, 0 }, { 3, 0 }, { 2, 0 }, { 0, 0 }, { 3, 5 }, { 4, 0 } };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      std::map<int, int> compare = { { 2, 9 } };
+      compare.insert(values.begin(), values.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      Sorted_Data data;
+      std::map<int, int> compare;
+
+      for (int i = 0; i < 120; i += 2)
+      {
+        data.insert(std::make_pair(i, i));
+        compare.insert(std::make_pair(i, i));
+      }
+
+      std::vector<std::pair<int, int>> values;
+
+      for (int i = 1; i < 20; i += 2)
+      {
+        values.push_back(std::make_pair(i, i));
+      }
+
+      CHECK_THROW(data.insert_sorted(values.begin(), values.end()), etl::map_full);
+
+      // The values that fitted were inserted.
+      compare.insert(values.begin(), values.begin() + 4);
+
+      CHECK(data.full());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_sorted)
+    {
+      Sorted_Data data;
+      data.insert(std::make_pair(1, 1));
+      data.insert(std::make_pair(5, 5));
+
+      std::vector<std::pair<int, int>> values = { { 0, 0 }, { 2, 2 }, { 4, 4 }, { 6, 6 } };
+
+      data.assign_sorted(values.begin(), values.end());
+
+      CHECK_EQUAL(values.size(), data.size());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(values.begin(), values.end(), data.begin()));
+    }
   };
 }
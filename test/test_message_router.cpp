@@ -32,6 +32,8 @@ SOFTWARE.
 #include "etl/queue.h"
 #include "etl/largest.h"
 
+#include <array>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -264,6 +266,65 @@ namespace
     int sender_id;
   };
 
+  //***************************************************************************
+  // Messages and a router for testing routers with many message types.
+  //***************************************************************************
+  template <etl::message_id_t ID>
+  struct TableMessage : public etl::message<ID>
+  {
+  };
+
+  template <typename... TMessages>
+  class TableRouter : public etl::message_router<TableRouter<TMessages...>, TMessages...>
+  {
+  public:
+
+    typedef etl::message_router<TableRouter<TMessages...>, TMessages...> base_t;
+
+    TableRouter()
+      : base_t(ROUTER3)
+      , message_unknown_count(0)
+    {
+      message_counts.fill(0);
+    }
+
+    TableRouter(etl::imessage_router& successor_)
+      : base_t(ROUTER3, successor_)
+      , message_unknown_count(0)
+    {
+      message_counts.fill(0);
+    }
+
+    template <typename TMessage>
+    void on_receive(const TMessage&)
+    {
+      ++message_counts[TMessage::ID];
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    std::array<int, 256> message_counts;
+    int message_unknown_count;
+  };
+
+  // Ids 1 to 10 and 13.
+  typedef TableRouter<TableMessage<1>, TableMessage<2>, TableMessage<3>, TableMessage<4>, TableMessage<5>, TableMessage<6>,
+                      TableMessage<7>, TableMessage<8>, TableMessage<9>, TableMessage<10>, TableMessage<13> > DenseRouter;
+
+  // Ids 0 to 250 in steps of 25, not in order.
+  typedef TableRouter<TableMessage<250>, TableMessage<25>, TableMessage<0>, TableMessage<75>, TableMessage<50>, TableMessage<100>,
+                      TableMessage<125>, TableMessage<175>, TableMessage<150>, TableMessage<200>, TableMessage<225> > SparseRouter;
+
+  template <etl::message_id_t... IDs>
+  void send_table_messages(etl::imessage_router& router)
+  {
+    int dummy[] = { (router.receive(TableMessage<IDs>()), 0)... };
+    (void)dummy;
+  }
+
   etl::imessage_router* p_router;
 
   SUITE(test_message_router)
@@ -650,5 +711,71 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+    //*************************************************************************
+    TEST(message_router_many_types_dense_ids)
+    {
+      DenseRouter router;
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+      CHECK(DenseRouter::Uses_Dispatch_Table);
+#endif
+
+      send_table_messages<1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 13>(router);
+      send_table_messages<0, 11, 12, 14, 255>(router);
+
+      for (size_t id = 0U; id < 256U; ++id)
+      {
+        const bool expected = ((id >= 1U) && (id <= 10U)) || (id == 13U);
+
+        CHECK_EQUAL(expected ? 1 : 0, router.message_counts[id]);
+        CHECK_EQUAL(expected, router.accepts(etl::message_id_t(id)));
+      }
+
+      CHECK_EQUAL(5, router.message_unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(message_router_many_types_sparse_ids)
+    {
+      SparseRouter router;
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+      CHECK(SparseRouter::Uses_Dispatch_Table);
+#endif
+
+      send_table_messages<0, 25, 50, 75, 100, 125, 150, 175, 200, 225, 250>(router);
+      send_table_messages<1, 24, 26, 249, 251, 255>(router);
+
+      for (size_t id = 0U; id < 256U; ++id)
+      {
+        const bool expected = (id % 25U) == 0U;
+
+        CHECK_EQUAL(expected ? 1 : 0, router.message_counts[id]);
+        CHECK_EQUAL(expected, router.accepts(etl::message_id_t(id)));
+      }
+
+      CHECK_EQUAL(6, router.message_unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(message_router_many_types_successor)
+    {
+      SparseRouter successor;
+      DenseRouter  router(successor);
+
+      send_table_messages<1, 25, 11>(router);
+
+      CHECK_EQUAL(1, router.message_counts[1]);
+      CHECK_EQUAL(0, router.message_counts[25]);
+      CHECK_EQUAL(0, router.message_unknown_count);
+
+      CHECK_EQUAL(1, successor.message_counts[25]);
+      CHECK_EQUAL(1, successor.message_unknown_count);
+
+      CHECK(router.accepts(1U));
+      CHECK(router.accepts(25U));
+      CHECK(!router.accepts(11U));
+    }
   };
 }
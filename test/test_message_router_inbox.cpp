@@ -0,0 +1,344 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/message_router_inbox.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <thread>
+#include <mutex>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1
+  };
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  //*************************************************************************
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  //*************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(ROUTER1)
+      , message1_count(0)
+      , message1_sum(0)
+      , message2_count(0)
+      , unknown_count(0)
+    {
+    }
+
+    void on_receive(const Message1& msg)
+    {
+      ++message1_count;
+      message1_sum += msg.value;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++message2_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++unknown_count;
+    }
+
+    int message1_count;
+    long long message1_sum;
+    int message2_count;
+    int unknown_count;
+  };
+
+  //*************************************************************************
+  // A pool that may be used from several threads.
+  //*************************************************************************
+  class Pool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    Pool(etl::imemory_block_allocator& allocator)
+      : etl::atomic_counted_message_pool(allocator)
+    {
+    }
+
+  protected:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex mutex;
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2, Message3>;
+
+  template <size_t Size>
+  using Allocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size, pool_message_parameters::max_alignment, Size>;
+
+  SUITE(test_message_router_inbox)
+  {
+    //*************************************************************************
+    TEST(test_post_then_process)
+    {
+      Allocator<4> allocator;
+      Pool pool(allocator);
+      Router router;
+      etl::message_router_inbox<Pool, 4> inbox(router, pool);
+
+      CHECK_EQUAL(ROUTER1, inbox.get_message_router_id());
+      CHECK(&router == &inbox.get_destination());
+      CHECK(inbox.empty());
+      CHECK_EQUAL(4U, inbox.max_size());
+
+      CHECK(inbox.post(Message1(1)));
+      CHECK(inbox.post(Message2()));
+      inbox.receive(Message1(2));
+      CHECK(inbox.post(etl::shared_message(pool, Message1(3))));
+
+      CHECK_EQUAL(4U, inbox.size());
+      CHECK(inbox.full());
+
+      // Nothing is received until the queue is processed.
+      CHECK_EQUAL(0, router.message1_count);
+      CHECK_EQUAL(0, router.message2_count);
+
+      CHECK_EQUAL(4U, inbox.process_queue());
+      CHECK(inbox.empty());
+
+      CHECK_EQUAL(3, router.message1_count);
+      CHECK_EQUAL(6, router.message1_sum);
+      CHECK_EQUAL(1, router.message2_count);
+      CHECK_EQUAL(0, router.unknown_count);
+
+      // The messages have been returned to the pool.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(inbox.post(Message2()));
+      }
+
+      CHECK_EQUAL(4U, inbox.process_queue());
+      CHECK_EQUAL(5, router.message2_count);
+    }
+
+    //*************************************************************************
+    TEST(test_process_queue_max)
+    {
+      Allocator<8> allocator;
+      Pool pool(allocator);
+      Router router;
+      etl::message_router_inbox<Pool, 8> inbox(router, pool);
+
+      for (int i = 1; i <= 5; ++i)
+      {
+        inbox.post(Message1(i));
+      }
+
+      CHECK_EQUAL(2U, inbox.process_queue(2U));
+      CHECK_EQUAL(2, router.message1_count);
+      CHECK_EQUAL(3, router.message1_sum);
+
+      CHECK_EQUAL(0U, inbox.process_queue(0U));
+      CHECK_EQUAL(2, router.message1_count);
+
+      CHECK_EQUAL(3U, inbox.process_queue(10U));
+      CHECK_EQUAL(5, router.message1_count);
+      CHECK_EQUAL(15, router.message1_sum);
+
+      CHECK_EQUAL(0U, inbox.process_queue());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Allocator<4> allocator;
+      Pool pool(allocator);
+      Router router;
+      etl::message_router_inbox<Pool, 2> inbox(router, pool);
+
+      CHECK(inbox.post(Message1(1)));
+      CHECK(inbox.post(Message1(2)));
+      CHECK(!inbox.post(Message1(3)));
+      CHECK_THROW(inbox.receive(Message1(4)), etl::message_router_inbox_full);
+      CHECK_THROW(inbox.receive(etl::shared_message(pool, Message1(5))), etl::message_router_inbox_full);
+
+      inbox.clear();
+      CHECK(inbox.empty());
+
+      // Cleared messages have been returned to the pool.
+      CHECK(inbox.post(Message1(6)));
+      CHECK(inbox.post(Message1(7)));
+      CHECK_EQUAL(2U, inbox.process_queue());
+      CHECK_EQUAL(13, router.message1_sum);
+    }
+
+    //*************************************************************************
+    TEST(test_router_interface)
+    {
+      Allocator<4> allocator;
+      Pool pool(allocator);
+      Router router;
+      etl::message_router_inbox<Pool, 4> inbox(router, pool);
+
+      etl::imessage_router& irouter = inbox;
+
+      CHECK(irouter.accepts(MESSAGE1));
+      CHECK(irouter.accepts(MESSAGE2));
+      CHECK(!irouter.accepts(MESSAGE3));
+      CHECK(irouter.is_consumer());
+
+      irouter.receive(etl::shared_message(pool, Message1(1)));
+      irouter.receive(ROUTER1, etl::shared_message(pool, Message1(2)));
+      irouter.receive(ROUTER1 + 1, etl::shared_message(pool, Message1(4))); // Not for this router.
+      CHECK_EQUAL(2U, inbox.size());
+
+      // The type of a message that is not shared is unknown, so it cannot be queued.
+      const etl::imessage& message = Message2();
+      CHECK_THROW(irouter.receive(message), etl::message_router_inbox_not_shared);
+      CHECK_EQUAL(2U, inbox.size());
+
+      inbox.receive(Message3());
+      CHECK_EQUAL(3U, inbox.process_queue());
+      CHECK_EQUAL(2, router.message1_count);
+      CHECK_EQUAL(3, router.message1_sum);
+      CHECK_EQUAL(1, router.unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_releases_messages)
+    {
+      Allocator<2> allocator;
+      Pool pool(allocator);
+      Router router;
+
+      {
+        etl::message_router_inbox<Pool, 2> inbox(router, pool);
+
+        inbox.post(Message1(1));
+        inbox.post(Message1(2));
+      }
+
+      etl::message_router_inbox<Pool, 2> inbox(router, pool);
+
+      CHECK(inbox.post(Message1(1)));
+      CHECK(inbox.post(Message1(2)));
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      const int Producers = 4;
+      const int Messages  = 10000;
+
+      Allocator<64> allocator;
+      Pool pool(allocator);
+      Router router;
+      etl::message_router_inbox<Pool, 32> inbox(router, pool);
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&inbox, p]()
+        {
+          for (int i = 1; i <= Messages; ++i)
+          {
+            while (!inbox.post(Message1(i + (p * Messages))))
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      // Process on this thread, which owns the router.
+      const int Total = Producers * Messages;
+
+      while (router.message1_count < Total)
+      {
+        if (inbox.process_queue(8U) == 0U)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t p = 0U; p < producers.size(); ++p)
+      {
+        producers[p].join();
+      }
+
+      CHECK_EQUAL(Total, router.message1_count);
+      CHECK_EQUAL((static_cast<long long>(Total) * (Total + 1)) / 2, router.message1_sum);
+      CHECK(inbox.empty());
+    }
+  }
+}
+
+#endif
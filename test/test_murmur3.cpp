@@ -33,12 +33,29 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <list>
 #include <stdint.h>
+#include <string.h>
 
 #include "etl/murmur3.h"
 
 namespace
 {
+  //***************************************************************************
+  // Random test data, with room to start at an unaligned offset.
+  //***************************************************************************
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length + 16U);
+
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 0x9DU) ^ (i >> 3U) ^ 0xA5U);
+    }
+
+    return data;
+  }
+
   SUITE(test_murmur3)
   {
     //*************************************************************************
@@ -122,6 +139,169 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_contiguous_lengths_and_offsets)
+    {
+      std::vector<uint8_t> data = make_data(64U);
+
+      for (size_t length = 0U; length <= 64U; ++length)
+      {
+        uint32_t compare;
+        MurmurHash3_x86_32(&data[0], int(length), 0x1234U, &compare);
+
+        for (size_t offset = 1U; offset < 8U; ++offset)
+        {
+          // An unaligned copy of the same bytes.
+          std::vector<uint8_t> copy(length + offset);
+          memcpy(&copy[offset], &data[0], length);
+
+          const uint8_t* begin = &copy[0] + offset;
+          uint32_t hash = etl::murmur3<uint32_t>(begin, begin + length, 0x1234U);
+
+          CHECK_EQUAL(compare, hash);
+        }
+
+        // Non-contiguous iterators take the byte at a time path.
+        std::list<uint8_t> list(data.begin(), data.begin() + length);
+        uint32_t hash = etl::murmur3<uint32_t>(list.begin(), list.end(), 0x1234U);
+
+        CHECK_EQUAL(compare, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_add_range_split)
+    {
+      std::vector<uint8_t> data = make_data(37U);
+
+      uint32_t compare;
+      MurmurHash3_x86_32(&data[0], 37, 0, &compare);
+
+      // Each split leaves a partially filled block between the two ranges.
+      for (size_t split = 0U; split <= 37U; ++split)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        murmur3_32_calculator.add(&data[0], &data[0] + split);
+        murmur3_32_calculator.add(&data[0] + split, &data[0] + 37U);
+
+        CHECK_EQUAL(compare, murmur3_32_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_signed_chars)
+    {
+      // Bytes with the top bit set must not sign extend.
+      const char text[] = "\xC0\xFF\x80\x7F\x81\xFE\x01";
+      const size_t length = sizeof(text) - 1U;
+
+      uint32_t compare;
+      MurmurHash3_x86_32(text, int(length), 0, &compare);
+
+      std::string str(text, length);
+
+      CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(text, text + length)));
+      CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(str.begin(), str.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_constructor)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_128::value_type hash = etl::murmur3_128(data.begin(), data.end());
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_add_values)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      etl::murmur3_128 murmur3_128_calculator(42U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        murmur3_128_calculator.add(data[i]);
+      }
+
+      etl::murmur3_128::value_type hash = murmur3_128_calculator;
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 42U, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_contiguous_lengths_and_offsets)
+    {
+      std::vector<uint8_t> data = make_data(80U);
+
+      for (size_t length = 0U; length <= 80U; ++length)
+      {
+        uint64_t compare[2];
+        MurmurHash3_x64_128(&data[0], int(length), 0x1234U, compare);
+
+        for (size_t offset = 1U; offset < 8U; ++offset)
+        {
+          std::vector<uint8_t> copy(length + offset);
+          memcpy(&copy[offset], &data[0], length);
+
+          const uint8_t* begin = &copy[0] + offset;
+          etl::murmur3_128::value_type hash = etl::murmur3_128(begin, begin + length, 0x1234U);
+
+          CHECK_EQUAL(compare[0], hash[0]);
+          CHECK_EQUAL(compare[1], hash[1]);
+        }
+
+        std::list<uint8_t> list(data.begin(), data.begin() + length);
+        etl::murmur3_128::value_type hash = etl::murmur3_128(list.begin(), list.end(), 0x1234U);
+
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_add_range_split)
+    {
+      std::vector<uint8_t> data = make_data(53U);
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(&data[0], 53, 0, compare);
+
+      for (size_t split = 0U; split <= 53U; ++split)
+      {
+        etl::murmur3_128 murmur3_128_calculator;
+
+        murmur3_128_calculator.add(&data[0], &data[0] + split);
+        murmur3_128_calculator.add(&data[0] + split, &data[0] + 53U);
+
+        etl::murmur3_128::value_type hash = murmur3_128_calculator.value();
+
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_128_add_after_finalise)
+    {
+      etl::murmur3_128 murmur3_128_calculator;
+      murmur3_128_calculator.add(uint8_t(1U));
+      murmur3_128_calculator.value();
+
+      CHECK_THROW(murmur3_128_calculator.add(uint8_t(2U)), etl::hash_finalised);
+    }
   };
 }
 
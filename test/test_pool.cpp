@@ -473,4 +473,158 @@ namespace
     CHECK_EQUAL(3, memPool.available());
     CHECK_EQUAL(0, memPool.size());
   }
+
+  //*************************************************************************
+  TEST(test_allocate_n_release_n)
+  {
+    etl::pool<Test_Data, 8> pool;
+
+    Test_Data* items[5];
+    etl::span<Test_Data*> span(items);
+
+    // The untouched buffer gives contiguous items.
+    CHECK(pool.allocate_n(span));
+    CHECK_EQUAL(5U, pool.size());
+
+    for (size_t i = 1U; i < 5U; ++i)
+    {
+      CHECK(items[i] > items[i - 1]);
+      CHECK_EQUAL(size_t(reinterpret_cast<char*>(items[1]) - reinterpret_cast<char*>(items[0])),
+                  size_t(reinterpret_cast<char*>(items[i]) - reinterpret_cast<char*>(items[i - 1])));
+    }
+
+    // Single allocations carry on from the contiguous items.
+    Test_Data* p1 = pool.allocate();
+    Test_Data* p2 = pool.allocate();
+    Test_Data* p3 = pool.allocate();
+
+    CHECK(p1 == items[4] + (items[4] - items[3]));
+    CHECK(p2 == p1 + (items[4] - items[3]));
+    CHECK(p3 == p2 + (items[4] - items[3]));
+    CHECK(pool.full());
+    CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+
+    Test_Data* copy[5] = { items[0], items[1], items[2], items[3], items[4] };
+
+    pool.release_n(span);
+    CHECK_EQUAL(3U, pool.size());
+
+    // The released chain is allocated again in the same order.
+    std::fill_n(items, 5, nullptr);
+    CHECK(pool.allocate_n(span));
+
+    for (size_t i = 0U; i < 5U; ++i)
+    {
+      CHECK(items[i] == copy[i]);
+    }
+
+    pool.release(p2);
+    pool.release(p1);
+
+    Test_Data* two[2];
+    CHECK(pool.allocate_n(etl::span<Test_Data*>(two)));
+    CHECK(two[0] == p1);
+    CHECK(two[1] == p2);
+    CHECK(pool.full());
+
+    pool.release(p3);
+    pool.release_n(etl::span<Test_Data*>(two));
+    pool.release_n(span);
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_errors)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[5];
+
+    CHECK_THROW(pool.allocate_n(etl::span<int*>(items)), etl::pool_no_allocation);
+    CHECK(pool.empty());
+
+    struct Big
+    {
+      char c[32];
+    };
+
+    Big* big[1];
+    CHECK_THROW(pool.allocate_n(etl::span<Big*>(big)), etl::pool_element_size);
+
+    CHECK(pool.allocate_n(etl::span<int*>(items, 0U)));
+    CHECK(pool.allocate_n(etl::span<int*>(items, 2U)));
+
+    int not_in_pool;
+    items[2] = &not_in_pool;
+
+    // Nothing is released if any item is not in the pool.
+    CHECK_THROW(pool.release_n(etl::span<int*>(items, 3U)), etl::pool_object_not_in_pool);
+    CHECK_EQUAL(2U, pool.size());
+
+    pool.release_n(etl::span<int*>(items, 2U));
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_contiguous)
+  {
+    etl::pool<int, 8> pool;
+
+    int* items[4];
+    etl::span<int*> span(items);
+
+    CHECK(pool.allocate_n_contiguous(span));
+    CHECK(items[1] > items[0]);
+
+    int* p = pool.allocate();
+    pool.release(items[0]);
+
+    // The first free item is no longer in the untouched part of the buffer.
+    int* more[2];
+    CHECK(!pool.allocate_n_contiguous(etl::span<int*>(more)));
+    CHECK_EQUAL(4U, pool.size());
+
+    items[0] = pool.allocate();
+
+    // Now it is again.
+    CHECK(pool.allocate_n_contiguous(etl::span<int*>(more)));
+    CHECK(more[0] > p);
+    CHECK(more[1] > more[0]);
+
+    int* too_many[2];
+    CHECK(!pool.allocate_n_contiguous(etl::span<int*>(too_many)));
+    CHECK_EQUAL(7U, pool.size());
+
+    pool.release_n(span);
+    pool.release_n(etl::span<int*>(more));
+    pool.release(p);
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_create_n_destroy_n)
+  {
+    etl::pool<D2, 4> pool;
+
+    D2* items[3];
+    etl::span<D2*> span(items);
+
+    CHECK(pool.create_n(span, "1", "2"));
+    CHECK_EQUAL(3U, pool.size());
+
+    for (size_t i = 0U; i < 3U; ++i)
+    {
+      CHECK_EQUAL(D2("1", "2"), *items[i]);
+    }
+
+    pool.destroy_n(span);
+    CHECK(pool.empty());
+
+    D0* d0[4];
+    etl::pool<D0, 4> pool0;
+    CHECK(pool0.create_n(etl::span<D0*>(d0)));
+    CHECK(pool0.full());
+    pool0.destroy_n(etl::span<D0*>(d0));
+    CHECK(pool0.empty());
+  }
 }
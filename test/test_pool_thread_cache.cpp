@@ -0,0 +1,309 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+
+#include "etl/pool_thread_cache.h"
+#include "etl/pool.h"
+#include "etl/generic_pool.h"
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, const std::string& b_)
+      : a(a_)
+      , b(b_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+  };
+
+  SUITE(test_pool_thread_cache)
+  {
+    //*************************************************************************
+    TEST(test_depot_takes_the_pool)
+    {
+      etl::pool<int, 8> pool;
+
+      int* p = pool.allocate();
+
+      {
+        etl::pool_depot<etl::pool<int, 8> > depot(pool);
+
+        CHECK(pool.full());
+        CHECK_EQUAL(7U, depot.max_size());
+        CHECK_EQUAL(7U, depot.available());
+        CHECK_EQUAL(sizeof(int), depot.type_size());
+        CHECK_EQUAL(alignof(int), depot.alignment());
+        CHECK(!depot.is_in_pool(p)); // Allocated before the depot was made.
+      }
+
+      // The depot returns its items on destruction.
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.release(p);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      etl::pool<int, 8> pool;
+      etl::pool_depot<etl::pool<int, 8> > depot(pool);
+      etl::pool_thread_cache<4> cache(depot);
+
+      std::set<int*> items;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        int* p = nullptr;
+        CHECK_NO_THROW(p = cache.allocate<int>());
+        CHECK(depot.is_in_pool(p));
+        items.insert(p);
+      }
+
+      CHECK_EQUAL(8U, items.size());
+      CHECK_EQUAL(0U, depot.available());
+      CHECK_THROW(cache.allocate<int>(), etl::pool_no_allocation);
+
+      // Each miss takes half a magazine from the depot.
+      CHECK_EQUAL(4U, cache.allocate_hits());
+      CHECK_EQUAL(5U, cache.allocate_misses());
+
+      for (std::set<int*>::iterator itr = items.begin(); itr != items.end(); ++itr)
+      {
+        CHECK_NO_THROW(cache.release(*itr));
+      }
+
+      // Each miss returns half a magazine to the depot.
+      CHECK_EQUAL(6U, cache.release_hits());
+      CHECK_EQUAL(2U, cache.release_misses());
+      CHECK_EQUAL(4U, cache.size());
+      CHECK_EQUAL(4U, depot.available());
+
+      cache.flush();
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(8U, depot.available());
+
+      cache.reset_counters();
+
+      CHECK_EQUAL(0U, cache.allocate_hits());
+      CHECK_EQUAL(0U, cache.allocate_misses());
+      CHECK_EQUAL(0U, cache.release_hits());
+      CHECK_EQUAL(0U, cache.release_misses());
+    }
+
+    //*************************************************************************
+    TEST(test_release_to_another_cache)
+    {
+      etl::pool<int, 8> pool;
+      etl::pool_depot<etl::pool<int, 8> > depot(pool);
+
+      {
+        etl::pool_thread_cache<2> cache1(depot);
+        etl::pool_thread_cache<2> cache2(depot);
+
+        int* p1 = cache1.allocate<int>();
+        int* p2 = cache1.allocate<int>();
+
+        cache2.release(p1);
+        cache2.release(p2);
+
+        CHECK_EQUAL(0U, cache1.size());
+        CHECK_EQUAL(2U, cache2.size());
+        CHECK_EQUAL(6U, depot.available());
+      }
+
+      // The caches return their items on destruction.
+      CHECK_EQUAL(8U, depot.available());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::pool<int, 4> pool;
+      etl::pool_depot<etl::pool<int, 4> > depot(pool);
+      etl::pool_thread_cache<2> cache(depot);
+
+      int not_in_pool;
+
+      CHECK(!depot.is_in_pool(&not_in_pool));
+      CHECK_THROW(cache.release(&not_in_pool), etl::pool_object_not_in_pool);
+      CHECK_THROW(cache.allocate<double>(), etl::pool_element_size);
+    }
+
+    //*************************************************************************
+    TEST(test_index_sizes)
+    {
+      // The index field is sized from the pool size.
+      etl::pool<int, 1>   pool1;
+      etl::pool<int, 128> pool128;
+      etl::pool_depot<etl::pool<int, 1> >   depot1(pool1);
+      etl::pool_depot<etl::pool<int, 128> > depot128(pool128);
+      etl::pool_thread_cache<128> cache1(depot1);
+      etl::pool_thread_cache<128> cache128(depot128);
+
+      std::set<int*> items;
+
+      items.insert(cache1.allocate<int>());
+      CHECK_THROW(cache1.allocate<int>(), etl::pool_no_allocation);
+
+      for (size_t i = 0U; i < 128U; ++i)
+      {
+        items.insert(cache128.allocate<int>());
+      }
+
+      CHECK_EQUAL(129U, items.size());
+      CHECK_THROW(cache128.allocate<int>(), etl::pool_no_allocation);
+
+      for (std::set<int*>::iterator itr = items.begin(); itr != items.end(); ++itr)
+      {
+        if (depot1.is_in_pool(*itr))
+        {
+          cache1.release(*itr);
+        }
+        else
+        {
+          cache128.release(*itr);
+        }
+      }
+
+      cache1.flush();
+      cache128.flush();
+
+      CHECK_EQUAL(1U, depot1.available());
+      CHECK_EQUAL(128U, depot128.available());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      typedef etl::generic_pool<sizeof(D2), alignof(D2), 4> Pool;
+
+      Pool pool;
+      etl::pool_depot<Pool> depot(pool);
+      etl::pool_thread_cache<2> cache(depot);
+
+      D2* p = cache.create<D2>("1", "2");
+
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+
+      cache.destroy(p);
+
+      CHECK_EQUAL(1U, cache.size());
+      CHECK_EQUAL(3U, depot.available());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_threads)
+    {
+      const size_t Threads    = 4U;
+      const size_t Iterations = 20000U;
+      const size_t Batch      = 4U;
+
+      typedef etl::pool<size_t, 32> Pool;
+
+      Pool pool;
+      etl::pool_depot<Pool> depot(pool);
+
+      std::atomic<size_t> errors(0U);
+      std::atomic<size_t> hits(0U);
+      std::atomic<size_t> misses(0U);
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&depot, &errors, &hits, &misses, t]()
+        {
+          // Each thread holds no more than 8 items, so allocation never fails.
+          etl::pool_thread_cache<4> cache(depot);
+
+          size_t* items[Batch];
+
+          for (size_t i = 0U; i < Iterations; ++i)
+          {
+            for (size_t j = 0U; j < Batch; ++j)
+            {
+              items[j] = cache.allocate<size_t>();
+              *items[j] = t;
+            }
+
+            std::this_thread::yield();
+
+            // No other thread may have the items.
+            for (size_t j = 0U; j < Batch; ++j)
+            {
+              if (*items[j] != t)
+              {
+                ++errors;
+              }
+
+              cache.release(items[j]);
+            }
+          }
+
+          hits   += cache.allocate_hits() + cache.release_hits();
+          misses += cache.allocate_misses() + cache.release_misses();
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(0U, errors.load());
+      CHECK_EQUAL(Threads * Iterations * Batch * 2U, hits.load() + misses.load());
+      CHECK(hits.load() > misses.load());
+
+      // All of the items are back in the depot.
+      CHECK_EQUAL(32U, depot.available());
+
+      etl::pool_thread_cache<32> cache(depot);
+      std::set<size_t*> items;
+
+      for (size_t i = 0U; i < 32U; ++i)
+      {
+        items.insert(cache.allocate<size_t>());
+      }
+
+      CHECK_EQUAL(32U, items.size());
+    }
+  }
+}
@@ -0,0 +1,610 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+#include <string>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(4U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_front_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      typedef etl::iqueue_mpmc_atomic<int>::slot_type Slot;
+
+      etl::aligned_storage<sizeof(Slot), etl::alignment_of<Slot>::value>::type buffer[3];
+
+      etl::queue_mpmc_atomic_ext<int> queue(buffer, 3U);
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(3U, iqueue.max_size());
+      CHECK_EQUAL(3U, iqueue.capacity());
+      CHECK(iqueue.empty());
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.push(3));
+      CHECK(!iqueue.push(4));
+      CHECK(iqueue.full());
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.push(4));
+      CHECK(!iqueue.push(5));
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK(!iqueue.pop(i));
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_ext_zero_size)
+    {
+      typedef etl::iqueue_mpmc_atomic<int>::slot_type Slot;
+
+      etl::aligned_storage<sizeof(Slot), etl::alignment_of<Slot>::value>::type buffer[1];
+
+      CHECK_THROW(etl::queue_mpmc_atomic_ext<int> queue(buffer, 0U), etl::queue_mpmc_atomic_invalid_size);
+    }
+
+    //*************************************************************************
+    TEST(test_many_laps)
+    {
+      etl::queue_mpmc_atomic<int, 3> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 1000; ++lap)
+      {
+        // Vary the fill level so that the positions move through every slot.
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+
+        for (int i = 0; i <= (lap % 3); ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+
+        CHECK_EQUAL(size_t(next_push - next_pop), size_t(queue.size()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_small_memory_model)
+    {
+      etl::queue_mpmc_atomic<int, 255, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      CHECK_EQUAL(255U, queue.max_size());
+
+      for (int lap = 0; lap < 4; ++lap)
+      {
+        for (int i = 0; i < 255; ++i)
+        {
+          CHECK(queue.push(i));
+        }
+
+        CHECK(!queue.push(255));
+        CHECK_EQUAL(255U, queue.size());
+        CHECK_EQUAL(0U, queue.available());
+
+        for (int i = 0; i < 255; ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(i, value);
+        }
+
+        CHECK(queue.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_destroys_values)
+    {
+      etl::queue_mpmc_atomic<std::string, 4> queue;
+
+      queue.push(std::string("a long string that is not held in the small buffer 1"));
+      queue.push(std::string("a long string that is not held in the small buffer 2"));
+      queue.emplace("a long string that is not held in the small buffer 3");
+
+      std::string value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(std::string("a long string that is not held in the small buffer 1"), value);
+
+      // The remaining values are destroyed by the queue.
+    }
+
+    //*************************************************************************
+    etl::queue_mpmc_atomic<int, 10> thread_queue;
+
+    const int Thread_Length  = 200000;
+    const int Thread_Count   = 4;
+    const int Thread_Portion = Thread_Length / Thread_Count;
+
+    void producer_thread(int first)
+    {
+      int value = first;
+
+      while (value < (first + Thread_Portion))
+      {
+        if (thread_queue.push(value))
+        {
+          ++value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    void consumer_thread(std::vector<int>* p_received)
+    {
+      while (int(p_received->size()) < Thread_Portion)
+      {
+        int value;
+
+        if (thread_queue.pop(value))
+        {
+          p_received->push_back(value);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    TEST(queue_threads)
+    {
+      std::vector<int> received[Thread_Count];
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < Thread_Count; ++i)
+      {
+        received[i].reserve(Thread_Portion);
+        threads.push_back(std::thread(consumer_thread, &received[i]));
+        threads.push_back(std::thread(producer_thread, i * Thread_Portion));
+      }
+
+      // Join the threads with the main thread
+      for (size_t i = 0UL; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(thread_queue.empty());
+
+      // Each consumer sees each producer's values in order.
+      bool in_order = true;
+      std::vector<int> all;
+
+      for (int i = 0; i < Thread_Count; ++i)
+      {
+        int last[Thread_Count] = { -1, -1, -1, -1 };
+
+        for (size_t j = 0UL; j < received[i].size(); ++j)
+        {
+          int producer = received[i][j] / Thread_Portion;
+          in_order = in_order && (received[i][j] > last[producer]);
+          last[producer] = received[i][j];
+        }
+
+        all.insert(all.end(), received[i].begin(), received[i].end());
+      }
+
+      CHECK(in_order);
+
+      // Every value was received exactly once.
+      std::sort(all.begin(), all.end());
+      CHECK_EQUAL(size_t(Thread_Length), all.size());
+
+      bool all_received = true;
+
+      for (int i = 0; i < Thread_Length; ++i)
+      {
+        all_received = all_received && (all[i] == i);
+      }
+
+      CHECK(all_received);
+    }
+  };
+}
+
+#endif
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <string>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -392,6 +393,299 @@ namespace
     }
 
     //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      const int input[] = { 1, 2, 3, 4, 5, 6, 7 };
+      int output[7]     = { 0, 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(5U, queue.push(etl::span<const int>(input, 7U)));
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, 7U)));
+
+      // Only as many as there are.
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3U)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(2U, queue.size());
+
+      // Across the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(etl::span<const int>(input + 4U, 3U)));
+      CHECK_EQUAL(5U, queue.size());
+
+      CHECK_EQUAL(5U, queue.pop(etl::span<int>(output, 7U)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(5, output[2]);
+      CHECK_EQUAL(6, output[3]);
+      CHECK_EQUAL(7, output[4]);
+      CHECK(queue.empty());
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 7U)));
+
+      // Mixed with single pushes and pops.
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK(queue.push(i));
+        CHECK_EQUAL(2U, queue.push(etl::span<const int>(input, 2U)));
+
+        CHECK_EQUAL(2U, queue.pop(etl::span<int>(output, 2U)));
+        CHECK_EQUAL(i, output[0]);
+        CHECK_EQUAL(1, output[1]);
+
+        int value;
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(2, value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span_non_trivial)
+    {
+      etl::queue_spsc_atomic<std::string, 4> queue;
+
+      const std::string input[] = { "1", "2", "3", "4" };
+      std::string output[4];
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK_EQUAL(3U, queue.push(etl::span<const std::string>(input, 3U)));
+        CHECK_EQUAL(2U, queue.pop(etl::span<std::string>(output, 2U)));
+        CHECK_EQUAL(3U, queue.push(etl::span<const std::string>(input + 1U, 3U)));
+        CHECK_EQUAL(4U, queue.pop(etl::span<std::string>(output, 4U)));
+
+        CHECK_EQUAL(std::string("3"), output[0]);
+        CHECK_EQUAL(std::string("2"), output[1]);
+        CHECK_EQUAL(std::string("3"), output[2]);
+        CHECK_EQUAL(std::string("4"), output[3]);
+        CHECK(queue.empty());
+      }
+
+      // The remaining values are destroyed by the queue.
+      queue.push(etl::span<const std::string>(input, 4U));
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_commit_write)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      // Move the indexes towards the end of the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.clear();
+
+      etl::span<int> reserved = queue.reserve_write();
+      CHECK_EQUAL(2U, reserved.size()); // Up to the end of the buffer.
+
+      reserved = queue.reserve_write(1U);
+      CHECK_EQUAL(1U, reserved.size());
+      reserved[0] = 1;
+      queue.commit_write(1U);
+
+      reserved = queue.reserve_write();
+      CHECK_EQUAL(1U, reserved.size());
+      reserved[0] = 2;
+      queue.commit_write(1U);
+
+      // Wrapped to the start of the buffer.
+      reserved = queue.reserve_write();
+      CHECK_EQUAL(3U, reserved.size());
+      reserved[0] = 3;
+      reserved[1] = 4;
+      reserved[2] = 5;
+      queue.commit_write(3U);
+
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.reserve_write().size());
+
+      int value;
+      for (int i = 1; i <= 5; ++i)
+      {
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_more_than_available)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      // Move the indexes towards the end of the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.clear();
+
+      queue.push(1);
+
+      // One contiguous slot left before the end of the buffer.
+      CHECK_EQUAL(1U, queue.reserve_write().size());
+      CHECK_THROW(queue.commit_write(2U), etl::queue_spsc_atomic_commit_invalid);
+      CHECK_EQUAL(1U, queue.size());
+
+      // One value in the queue.
+      CHECK_EQUAL(1U, queue.peek_read().size());
+      CHECK_THROW(queue.commit_read(2U), etl::queue_spsc_atomic_commit_invalid);
+      CHECK_EQUAL(1U, queue.size());
+
+      int value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK(queue.empty());
+
+      CHECK_THROW(queue.commit_read(1U), etl::queue_spsc_atomic_commit_invalid);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_peek_commit_read)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      CHECK_EQUAL(0U, queue.peek_read().size());
+
+      // Move the indexes towards the end of the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.clear();
+
+      for (int i = 1; i <= 5; ++i)
+      {
+        queue.push(i);
+      }
+
+      etl::span<int> peeked = queue.peek_read(1U);
+      CHECK_EQUAL(1U, peeked.size());
+      CHECK_EQUAL(1, peeked[0]);
+      queue.commit_read(1U);
+
+      peeked = queue.peek_read();
+      CHECK_EQUAL(1U, peeked.size()); // Up to the end of the buffer.
+      CHECK_EQUAL(2, peeked[0]);
+      queue.commit_read(1U);
+
+      // Wrapped to the start of the buffer.
+      peeked = queue.peek_read();
+      CHECK_EQUAL(3U, peeked.size());
+      CHECK_EQUAL(3, peeked[0]);
+      CHECK_EQUAL(4, peeked[1]);
+      CHECK_EQUAL(5, peeked[2]);
+
+      // Peeking does not remove.
+      CHECK_EQUAL(3U, queue.size());
+      queue.commit_read(2U);
+      CHECK_EQUAL(1U, queue.size());
+
+      int value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(5, value);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_peek_commit_read_non_trivial)
+    {
+      etl::queue_spsc_atomic<std::string, 4> queue;
+
+      queue.push(std::string("1"));
+      queue.push(std::string("2"));
+
+      etl::span<std::string> peeked = queue.peek_read();
+      CHECK_EQUAL(2U, peeked.size());
+      CHECK_EQUAL(std::string("1"), peeked[0]);
+      CHECK_EQUAL(std::string("2"), peeked[1]);
+
+      queue.commit_read(2U);
+      CHECK(queue.empty());
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    TEST(test_pop_wait_timeout)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int value;
+
+      // A zero timeout only tries once.
+      CHECK(!queue.pop_wait(value, 0U));
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      CHECK(!queue.pop_wait(value, 2000U));
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+      CHECK(elapsed >= std::chrono::microseconds(2000));
+
+      queue.push(1);
+      CHECK(queue.pop_wait(value, 2000U));
+      CHECK_EQUAL(1, value);
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_timeout)
+    {
+      etl::queue_spsc_atomic<int, 2> queue;
+
+      CHECK(queue.push_wait(1, 0U));
+      CHECK(queue.push_wait(2));
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      CHECK(!queue.push_wait(3, 2000U));
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+      CHECK(elapsed >= std::chrono::microseconds(2000));
+      CHECK_EQUAL(2U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_pop_wait_threads)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      const int Length = 100000;
+
+      std::thread producer([&queue]()
+      {
+        for (int i = 0; i < Length; ++i)
+        {
+          queue.push_wait(i);
+
+          // Let the consumer go to sleep now and then.
+          if ((i % 10000) == 0)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          }
+        }
+      });
+
+      bool in_order = true;
+
+      for (int i = 0; i < Length; ++i)
+      {
+        int value = -1;
+        queue.pop_wait(value);
+        in_order = in_order && (value == i);
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
+#endif
+    //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
       #define FIX_PROCESSOR_AFFINITY1 SetThreadAffinityMask(GetCurrentThread(), 1);
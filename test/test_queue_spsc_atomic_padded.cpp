@@ -0,0 +1,663 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#include "etl/queue_spsc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+      b(b_),
+      c(c_),
+      d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+      b(0),
+      c(0),
+      d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  template <typename T, size_t SIZE, size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  using QueuePadded = etl::queue_spsc_atomic<T, SIZE, MEMORY_MODEL, etl::spsc_queue_layout::PADDED>;
+
+  template <typename T>
+  using IQueuePadded = etl::iqueue_spsc_atomic<T, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_queue_layout::PADDED>;
+
+  SUITE(test_queue_spsc_atomic_padded)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      QueuePadded<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      QueuePadded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      QueuePadded<ItemM, 4, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      QueuePadded<int, 4> queue;
+
+      IQueuePadded<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      QueuePadded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_front_pop)
+    {
+      QueuePadded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(1, queue.front());
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK_EQUAL(4, queue.front());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      QueuePadded<Data, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(4U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      QueuePadded<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      QueuePadded<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      QueuePadded<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_cached_indexes_after_wrap)
+    {
+      // Exercises the refresh of the cached peer index on every lap of the buffer.
+      QueuePadded<int, 3> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 10; ++lap)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+        CHECK_EQUAL(3U, queue.size());
+
+        int value;
+
+        CHECK(queue.front(value));
+        CHECK_EQUAL(next_pop, value);
+
+        // Partially drain, so that the next lap starts part way through the buffer.
+        for (int i = 0; i < ((lap % 3) + 1); ++i)
+        {
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_layout)
+    {
+      typedef QueuePadded<int, 4> Queue;
+
+      // The producer's and consumer's data add at least three cache lines.
+      CHECK(sizeof(Queue) >= (3U * ETL_CACHE_LINE_SIZE));
+      CHECK(sizeof(Queue) >= (sizeof(etl::queue_spsc_atomic<int, 4>) + (3U * ETL_CACHE_LINE_SIZE)));
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span_cached_indexes)
+    {
+      QueuePadded<int, 5> queue;
+
+      int input[5]  = { 1, 2, 3, 4, 5 };
+      int output[5] = { 0, 0, 0, 0, 0 };
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 10; ++lap)
+      {
+        // Fill the queue, a few at a time, so that the cached read index has to be refreshed.
+        size_t pushed;
+
+        do
+        {
+          for (size_t i = 0U; i < 3U; ++i)
+          {
+            input[i] = next_push + int(i);
+          }
+
+          pushed = queue.push(etl::span<const int>(input, 3U));
+          next_push += int(pushed);
+        } while (pushed != 0U);
+
+        CHECK(queue.full());
+
+        // Drain some of it.
+        size_t popped = queue.pop(etl::span<int>(output, size_t((lap % 4) + 1)));
+        CHECK_EQUAL(size_t((lap % 4) + 1), popped);
+
+        for (size_t i = 0U; i < popped; ++i)
+        {
+          CHECK_EQUAL(next_pop, output[i]);
+          ++next_pop;
+        }
+      }
+
+      size_t popped;
+
+      while ((popped = queue.pop(etl::span<int>(output, 5U))) != 0U)
+      {
+        for (size_t i = 0U; i < popped; ++i)
+        {
+          CHECK_EQUAL(next_pop, output[i]);
+          ++next_pop;
+        }
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_peek_commit_cached_indexes)
+    {
+      QueuePadded<int, 5> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 10; ++lap)
+      {
+        // Fill the queue in place.
+        etl::span<int> reserved = queue.reserve_write();
+
+        while (!reserved.empty())
+        {
+          for (size_t i = 0U; i < reserved.size(); ++i)
+          {
+            reserved[i] = next_push++;
+          }
+
+          queue.commit_write(reserved.size());
+          reserved = queue.reserve_write();
+        }
+
+        CHECK(queue.full());
+        CHECK_THROW(queue.commit_write(1U), etl::queue_spsc_atomic_commit_invalid);
+
+        // Drain some of it in place.
+        etl::span<int> peeked = queue.peek_read(size_t((lap % 3) + 1));
+
+        CHECK(!peeked.empty());
+
+        for (size_t i = 0U; i < peeked.size(); ++i)
+        {
+          CHECK_EQUAL(next_pop, peeked[i]);
+          ++next_pop;
+        }
+
+        queue.commit_read(peeked.size());
+      }
+
+      etl::span<int> peeked = queue.peek_read();
+
+      while (!peeked.empty())
+      {
+        for (size_t i = 0U; i < peeked.size(); ++i)
+        {
+          CHECK_EQUAL(next_pop, peeked[i]);
+          ++next_pop;
+        }
+
+        queue.commit_read(peeked.size());
+        peeked = queue.peek_read();
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+      CHECK_THROW(queue.commit_read(1U), etl::queue_spsc_atomic_commit_invalid);
+    }
+
+    //*************************************************************************
+    QueuePadded<int, 10> thread_queue;
+
+    const int Thread_Length = 1000000;
+
+    void producer_thread()
+    {
+      int value = 1;
+
+      while (value <= Thread_Length)
+      {
+        if (thread_queue.push(value))
+        {
+          ++value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    TEST(queue_threads)
+    {
+      std::vector<int> received;
+      received.reserve(Thread_Length);
+
+      std::thread t1(producer_thread);
+
+      while (int(received.size()) < Thread_Length)
+      {
+        int value;
+
+        if (thread_queue.pop(value))
+        {
+          received.push_back(value);
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      // Join the thread with the main thread
+      t1.join();
+
+      CHECK_EQUAL(size_t(Thread_Length), received.size());
+      CHECK(thread_queue.empty());
+
+      bool in_order = true;
+
+      for (int i = 0; i < Thread_Length; ++i)
+      {
+        in_order = in_order && (received[i] == (i + 1));
+      }
+
+      CHECK(in_order);
+    }
+
+#if ETL_HAS_SPSC_ATOMIC_WAIT
+    //*************************************************************************
+    TEST(test_push_wait_pop_wait_threads)
+    {
+      QueuePadded<int, 4> queue;
+
+      const int Length = 100000;
+
+      std::thread producer([&queue]()
+      {
+        for (int i = 0; i < Length; ++i)
+        {
+          queue.push_wait(i);
+
+          // Let the consumer go to sleep now and then.
+          if ((i % 10000) == 0)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+          }
+        }
+      });
+
+      bool in_order = true;
+
+      for (int i = 0; i < Length; ++i)
+      {
+        int value = -1;
+        queue.pop_wait(value);
+        in_order = in_order && (value == i);
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+#endif
+  };
+}
+
+#endif
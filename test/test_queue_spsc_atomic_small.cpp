@@ -409,6 +409,56 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span_254)
+    {
+      QueueInt254 queue;
+
+      std::vector<int> input(300U);
+      std::vector<int> output(300U);
+
+      for (size_t i = 0UL; i < input.size(); ++i)
+      {
+        input[i] = int(i);
+      }
+
+      CHECK_EQUAL(254U, queue.push(etl::span<const int>(input.data(), input.size())));
+      CHECK(queue.full());
+
+      CHECK_EQUAL(200U, queue.pop(etl::span<int>(output.data(), 200U)));
+
+      // Across the end of the buffer.
+      CHECK_EQUAL(46U, queue.push(etl::span<const int>(input.data() + 254U, 46U)));
+      CHECK_EQUAL(100U, queue.size());
+
+      CHECK_EQUAL(100U, queue.pop(etl::span<int>(output.data() + 200U, 100U)));
+      CHECK(queue.empty());
+
+      for (size_t i = 0UL; i < output.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), output[i]);
+      }
+
+      // In place, across the end of the buffer.
+      etl::span<int> reserved = queue.reserve_write();
+      CHECK_EQUAL(255U - 45U, reserved.size());
+      queue.commit_write(reserved.size());
+
+      reserved = queue.reserve_write();
+      CHECK_EQUAL(44U, reserved.size());
+      queue.commit_write(reserved.size());
+      CHECK(queue.full());
+
+      etl::span<int> peeked = queue.peek_read();
+      CHECK_EQUAL(255U - 45U, peeked.size());
+      queue.commit_read(peeked.size());
+
+      peeked = queue.peek_read();
+      CHECK_EQUAL(44U, peeked.size());
+      queue.commit_read(peeked.size());
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
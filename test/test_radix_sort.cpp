@@ -0,0 +1,297 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <numeric>
+#include <cmath>
+#include <stdint.h>
+
+#include "etl/radix.h"
+#include "etl/vector.h"
+
+namespace
+{
+  std::mt19937 urng(12345);
+
+  //***************************************************************************
+  struct Record
+  {
+    uint32_t timestamp;
+    int      index;
+  };
+
+  bool operator ==(const Record& lhs, const Record& rhs)
+  {
+    return (lhs.timestamp == rhs.timestamp) && (lhs.index == rhs.index);
+  }
+
+  bool compare_timestamp(const Record& lhs, const Record& rhs)
+  {
+    return lhs.timestamp < rhs.timestamp;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_random_data(size_t size)
+  {
+    std::vector<T> data(size);
+
+    for (size_t i = 0UL; i < size; ++i)
+    {
+      uint64_t value = (uint64_t(urng()) << 32U) | urng();
+      data[i] = static_cast<T>(value);
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void check_radix_sort(const std::vector<T>& data)
+  {
+    std::vector<T> expected(data);
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<T> lsd(data);
+    std::vector<T> buffer(data.size());
+    etl::radix_sort(lsd.begin(), lsd.end(), etl::span<T>(buffer.data(), buffer.size()));
+
+    std::vector<T> msd(data);
+    etl::radix_sort_in_place(msd.begin(), msd.end());
+
+    CHECK(expected == lsd);
+    CHECK(expected == msd);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  void check_radix_sort_sizes()
+  {
+    const size_t sizes[] = { 1, 2, 31, 32, 33, 1000, 10000 };
+
+    for (size_t size : sizes)
+    {
+      check_radix_sort(make_random_data<T>(size));
+    }
+  }
+
+  SUITE(test_radix_sort)
+  {
+    //*************************************************************************
+    TEST(test_unsigned)
+    {
+      check_radix_sort_sizes<uint8_t>();
+      check_radix_sort_sizes<uint16_t>();
+      check_radix_sort_sizes<uint32_t>();
+      check_radix_sort_sizes<uint64_t>();
+    }
+
+    //*************************************************************************
+    TEST(test_signed)
+    {
+      check_radix_sort_sizes<int8_t>();
+      check_radix_sort_sizes<int16_t>();
+      check_radix_sort_sizes<int32_t>();
+      check_radix_sort_sizes<int64_t>();
+
+      std::vector<int32_t> data = { 0, -1, 1, std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(), -1000, 1000 };
+      check_radix_sort(data);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      std::uniform_real_distribution<float>  float_distribution(-1.0e6f, 1.0e6f);
+      std::uniform_real_distribution<double> double_distribution(-1.0e12, 1.0e12);
+
+      std::vector<float>  float_data(5000);
+      std::vector<double> double_data(5000);
+
+      std::generate(float_data.begin(),  float_data.end(),  [&]() { return float_distribution(urng); });
+      std::generate(double_data.begin(), double_data.end(), [&]() { return double_distribution(urng); });
+
+      float_data.push_back(0.0f);
+      float_data.push_back(std::numeric_limits<float>::infinity());
+      float_data.push_back(-std::numeric_limits<float>::infinity());
+      float_data.push_back(std::numeric_limits<float>::denorm_min());
+      float_data.push_back(-std::numeric_limits<float>::max());
+
+      check_radix_sort(float_data);
+      check_radix_sort(double_data);
+    }
+
+    //*************************************************************************
+    TEST(test_negative_zero_before_positive_zero)
+    {
+      std::vector<double> data = { 0.0, -0.0, 0.0, -0.0 };
+      std::vector<double> buffer(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<double>(buffer.data(), buffer.size()));
+
+      CHECK(std::signbit(data[0]));
+      CHECK(std::signbit(data[1]));
+      CHECK(!std::signbit(data[2]));
+      CHECK(!std::signbit(data[3]));
+    }
+
+    //*************************************************************************
+    TEST(test_patterns)
+    {
+      const size_t Size = 5000;
+
+      std::vector<uint32_t> sorted(Size);
+      std::iota(sorted.begin(), sorted.end(), 0U);
+      check_radix_sort(sorted);
+
+      std::vector<uint32_t> reversed(sorted.rbegin(), sorted.rend());
+      check_radix_sort(reversed);
+
+      std::vector<uint32_t> all_equal(Size, 0x12345678U);
+      check_radix_sort(all_equal);
+
+      std::vector<uint32_t> few_unique(Size);
+      std::generate(few_unique.begin(), few_unique.end(), [&]() { return (urng() % 4U) << 24U; });
+      check_radix_sort(few_unique);
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      std::vector<uint32_t> data;
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>());
+      etl::radix_sort_in_place(data.begin(), data.end());
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_member_key_is_stable)
+    {
+      std::vector<Record> data;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        Record record = { uint32_t(urng() % 100U) * 0x01010101U, i };
+        data.push_back(record);
+      }
+
+      std::vector<Record> expected(data);
+      std::stable_sort(expected.begin(), expected.end(), compare_timestamp);
+
+      std::vector<Record> buffer(data.size());
+      etl::radix_sort(data.begin(), data.end(), etl::span<Record>(buffer.data(), buffer.size()), &Record::timestamp);
+
+      CHECK(expected == data);
+    }
+
+    //*************************************************************************
+    TEST(test_member_key_in_place)
+    {
+      std::vector<Record> data;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        Record record = { uint32_t(urng()), i };
+        data.push_back(record);
+      }
+
+      std::vector<Record> expected(data);
+      std::stable_sort(expected.begin(), expected.end(), compare_timestamp);
+
+      etl::radix_sort_in_place(data.begin(), data.end(), &Record::timestamp);
+
+      // Keys are unique with high probability, so compare the keys only.
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin(),
+                       [](const Record& lhs, const Record& rhs) { return lhs.timestamp == rhs.timestamp; }));
+    }
+
+    //*************************************************************************
+    TEST(test_projection)
+    {
+      std::vector<Record> data;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        Record record = { uint32_t(urng()), i };
+        data.push_back(record);
+      }
+
+      // Sort descending by projecting the inverted key.
+      auto projection = [](const Record& record) { return ~record.timestamp; };
+
+      std::vector<Record> expected(data);
+      std::stable_sort(expected.begin(), expected.end(), [](const Record& lhs, const Record& rhs) { return lhs.timestamp > rhs.timestamp; });
+
+      std::vector<Record> lsd(data);
+      std::vector<Record> buffer(data.size());
+      etl::radix_sort(lsd.begin(), lsd.end(), etl::span<Record>(buffer.data(), buffer.size()), projection);
+
+      std::vector<Record> msd(data);
+      etl::radix_sort_in_place(msd.begin(), msd.end(), projection);
+
+      CHECK(expected == lsd);
+      CHECK(std::equal(expected.begin(), expected.end(), msd.begin(),
+                       [](const Record& lhs, const Record& rhs) { return lhs.timestamp == rhs.timestamp; }));
+    }
+
+    //*************************************************************************
+    TEST(test_etl_vector)
+    {
+      etl::vector<int32_t, 1000> data;
+      etl::vector<int32_t, 1000> buffer(1000);
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        data.push_back(int32_t(urng()));
+      }
+
+      std::vector<int32_t> expected(data.begin(), data.end());
+      std::sort(expected.begin(), expected.end());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<int32_t>(buffer.data(), buffer.size()));
+
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_too_small)
+    {
+      std::vector<uint32_t> data(10, 0U);
+      std::vector<uint32_t> buffer(9);
+
+      CHECK_THROW(etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(buffer.data(), buffer.size())), etl::radix_sort_buffer_too_small);
+    }
+  };
+}
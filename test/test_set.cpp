@@ -103,6 +103,42 @@ namespace
   //  return (lhs.k < rhs.k);
   //}
 
+  //***************************************************************************
+  // Gives the tests access to the tree, to check that it is balanced.
+  //***************************************************************************
+  class Sorted_Data : public etl::set<int, 64>
+  {
+  public:
+
+    // The height of the tree, or -1 if it is not balanced or a weight is wrong.
+    int height() const
+    {
+      return height(root_node);
+    }
+
+  private:
+
+    static int height(const Node* node)
+    {
+      if (node == nullptr)
+      {
+        return 0;
+      }
+
+      const int left  = height(node->children[kLeft]);
+      const int right = height(node->children[kRight]);
+
+      const uint_least8_t weight = (left > right) ? uint_least8_t(kLeft) : ((right > left) ? uint_least8_t(kRight) : uint_least8_t(kNeither));
+
+      if ((left < 0) || (right < 0) || (std::abs(left - right) > 1) || (node->weight != weight))
+      {
+        return -1;
+      }
+
+      return 1 + std::max(left, right);
+    }
+  };
+
   SUITE(test_set)
   {
     //*************************************************************************
@@ -1457,5 +1493,139 @@ namespace
       CHECK(!data.contains(99));
       CHECK(!data.contains(Key(99)));
     }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_empty_set)
+    {
+      for (int size = 0; size <= 64; ++size)
+      {
+        std::vector<int> values;
+
+        for (int i = 0; i < size; ++i)
+        {
+          values.push_back(i * 2);
+        }
+
+        Sorted_Data data;
+        data.insert_sorted(values.begin(), values.end());
+
+        CHECK_EQUAL(values.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(values.begin(), values.end(), data.begin()));
+
+        // The built tree still balances as it shrinks and grows.
+        std::set<int> compare(values.begin(), values.end());
+
+        for (int i = 0; i < size; i += 3)
+        {
+          data.erase(i * 2);
+          compare.erase(i * 2);
+        }
+
+        for (int i = 0; !data.full(); ++i)
+        {
+          data.insert((i * 2) + 1);
+          compare.insert((i * 2) + 1);
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_into_set)
+    {
+      for (int step = 1; step < 6; ++step)
+      {
+        Sorted_Data data;
+        std::set<int> compare;
+
+        for (int i = 0; i < 32; i += step)
+        {
+          data.insert(i);
+          compare.insert(i);
+        }
+
+        // Overlapping the existing values, with repeats.
+        std::vector<int> values;
+
+        for (int i = -step; i <= 40; i += step + 1)
+        {
+          values.push_back(i);
+          values.push_back(i);
+        }
+
+        data.insert_sorted(values.begin(), values.end());
+        compare.insert(values.begin(), values.end());
+
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(data.height() >= 0);
+        CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_unsorted_range)
+    {
+      Sorted_Data data;
+      data.insert(2);
+
+      std::vector<int> values = { 1, 3, 2, 0, 3, 4 };
+
+      data.insert_sorted(values.begin(), values.end());
+
+      std::set<int> compare = { 0, 1, 2, 3, 4 };
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_sorted_excess)
+    {
+      Sorted_Data data;
+      std::set<int> compare;
+
+      for (int i = 0; i < 120; i += 2)
+      {
+        data.insert(i);
+        compare.insert(i);
+      }
+
+      std::vector<int> values;
+
+      for (int i = 1; i < 20; i += 2)
+      {
+        values.push_back(i);
+      }
+
+      CHECK_THROW(data.insert_sorted(values.begin(), values.end()), etl::set_full);
+
+      // The values that fitted were inserted.
+      compare.insert(values.begin(), values.begin() + 4);
+
+      CHECK(data.full());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(compare.begin(), compare.end(), data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_assign_sorted)
+    {
+      Sorted_Data data;
+      data.insert(1);
+      data.insert(5);
+
+      std::vector<int> values = { 0, 2, 4, 6 };
+
+      data.assign_sorted(values.begin(), values.end());
+
+      CHECK_EQUAL(values.size(), data.size());
+      CHECK(data.height() >= 0);
+      CHECK(Check_Equal(values.begin(), values.end(), data.begin()));
+    }
   };
 }
@@ -188,6 +188,22 @@ namespace
       CHECK_EQUAL(1, sm1.get_reference_count());
     }
 
+    //*************************************************************************
+    TEST(test_assign_to_moved_from)
+    {
+      etl::shared_message sm1(message_pool, Message1(1));
+      etl::shared_message sm2(std::move(sm1));
+
+      sm1 = sm2;
+      CHECK_EQUAL(2, sm2.get_reference_count());
+
+      etl::shared_message sm3(std::move(sm1));
+      CHECK_EQUAL(2, sm3.get_reference_count());
+
+      sm1 = std::move(sm3);
+      CHECK_EQUAL(2, sm1.get_reference_count());
+    }
+
     //*************************************************************************
     TEST(test_default_message_constructor)
     {
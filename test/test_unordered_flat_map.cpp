@@ -0,0 +1,868 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <functional>
+#include <random>
+#include <unordered_map>
+
+#include "data.h"
+
+#include "etl/unordered_flat_map.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  // Sums the characters, so many keys share a hash.
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct constant_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 42U;
+    }
+  };
+
+  //*************************************************************************
+  // Hasher whose hash behaviour depends on provided data.
+  struct parameterized_hash
+  {
+    size_t modulus;
+
+    parameterized_hash(size_t modulus_ = 2) : modulus(modulus_){}
+
+    size_t operator()(size_t val) const
+    {
+      return val % modulus;
+    }
+  };
+
+  //*************************************************************************
+  // Equality checker whose behaviour depends on provided data.
+  struct parameterized_equal
+  {
+    size_t modulus;
+
+    parameterized_equal(size_t modulus_ = 2) : modulus(modulus_){}
+
+    bool operator()(size_t lhs, size_t rhs) const
+    {
+      return (lhs % modulus) == (rhs % modulus);
+    }
+  };
+
+  typedef TestDataDC<std::string>  DC;
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef ETL_OR_STD::pair<std::string, DC>  ElementDC;
+  typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+
+  SUITE(test_unordered_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    using ItemM = TestDataM<int>;
+    using DataM = etl::unordered_flat_map<std::string, ItemM, SIZE, std::hash<std::string>>;
+
+    typedef etl::unordered_flat_map<std::string, DC,  SIZE, simple_hash> DataDC;
+    typedef etl::unordered_flat_map<std::string, NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iunordered_flat_map<std::string, NDC, simple_hash> IDataNDC;
+
+    NDC N0 = NDC("A");
+    NDC N1 = NDC("B");
+    NDC N2 = NDC("C");
+    NDC N3 = NDC("D");
+    NDC N4 = NDC("E");
+    NDC N5 = NDC("F");
+    NDC N6 = NDC("G");
+    NDC N7 = NDC("H");
+    NDC N8 = NDC("I");
+    NDC N9 = NDC("J");
+    NDC N10 = NDC("K");
+
+    const char* K0  = "FF";
+    const char* K1  = "FG";
+    const char* K2  = "FH";
+    const char* K3  = "FI";
+    const char* K4  = "FJ";
+    const char* K5  = "FK";
+    const char* K6  = "FL";
+    const char* K7  = "FM";
+    const char* K8  = "FN";
+    const char* K9  = "FO";
+    const char* K10 = "FP";
+    const char* K11 = "GF"; // Same hash as K1.
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        ElementNDC n[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9)
+        };
+
+        ElementNDC n2[] =
+        {
+          ElementNDC(K0, N0), ElementNDC(K1, N1), ElementNDC(K2, N2), ElementNDC(K3, N3), ElementNDC(K4, N4),
+          ElementNDC(K5, N5), ElementNDC(K6, N6), ElementNDC(K7, N7), ElementNDC(K8, N8), ElementNDC(K9, N9),
+          ElementNDC(K10, N10)
+        };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_slot_count)
+    {
+      // The slot count is a power of two of at least 16, with a maximum load of 7/8.
+      CHECK_EQUAL(16U,  (etl::unordered_flat_buffer_size<1>::Slot_Count));
+      CHECK_EQUAL(16U,  (etl::unordered_flat_buffer_size<14>::Slot_Count));
+      CHECK_EQUAL(32U,  (etl::unordered_flat_buffer_size<15>::Slot_Count));
+      CHECK_EQUAL(128U, (etl::unordered_flat_buffer_size<112>::Slot_Count));
+      CHECK_EQUAL(256U, (etl::unordered_flat_buffer_size<113>::Slot_Count));
+
+      CHECK_EQUAL(etl::unordered_flat_buffer_size<113>::Slot_Count + etl::private_unordered_flat::group::Width - 1U,
+                  (etl::unordered_flat_buffer_size<113>::Control_Count));
+
+      for (size_t i = 1U; i < 1000U; ++i)
+      {
+        const size_t slots = etl::private_unordered_flat::get_slot_count(i);
+
+        CHECK((slots & (slots - 1U)) == 0U);
+        CHECK((slots - (slots / 8U)) >= i);
+      }
+
+      DataNDC data;
+      CHECK_EQUAL(16U, data.bucket_count());
+      CHECK_EQUAL(16U, data.max_bucket_count());
+      CHECK_EQUAL(16U, DataNDC::SLOT_COUNT);
+    }
+
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_cpp17_deduced_constructor)
+    {
+      etl::unordered_flat_map data{ ETL_OR_STD::pair<int, int>{0, 1}, ETL_OR_STD::pair<int, int>{2, 3}, ETL_OR_STD::pair<int, int>{4, 5} };
+      etl::unordered_flat_map<int, int, 3U> check = { {0, 1}, {2, 3}, {4, 5} };
+
+      CHECK(data == check);
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_make_unordered_flat_map)
+    {
+      auto data = etl::make_unordered_flat_map<int, int>(ETL_OR_STD::pair<int, int>{0, 1}, ETL_OR_STD::pair<int, int>{2, 3});
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.at(0));
+      CHECK_EQUAL(3, data.at(2));
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(!data.empty());
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        CHECK(data.at(initial_data[i].first) == initial_data[i].second);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other(data);
+
+      CHECK(data == other);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      DataM data1;
+
+      ItemM d1(1);
+      ItemM d2(2);
+      ItemM d3(3);
+
+      data1.insert(DataM::value_type(std::string("1"), etl::move(d1)));
+      data1.insert(DataM::value_type(std::string("2"), etl::move(d2)));
+      data1.insert(DataM::value_type(std::string("3"), etl::move(d3)));
+      data1.insert(DataM::value_type(std::string("4"), ItemM(4)));
+
+      DataM data2(std::move(data1));
+
+      CHECK(!data1.empty()); // Move does not clear the source.
+
+      CHECK_EQUAL(1, data2.at("1").value);
+      CHECK_EQUAL(2, data2.at("2").value);
+      CHECK_EQUAL(3, data2.at("3").value);
+      CHECK_EQUAL(4, data2.at("4").value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_destruct_via_iunordered_flat_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data;
+
+      other_data = data;
+
+      CHECK(data == other_data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(idata2 == idata1);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_self_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data(data);
+
+#include "etl/private/diagnostic_self_assign_overloaded_push.h"
+      other_data = other_data;
+#include "etl/private/diagnostic_pop.h"
+
+      CHECK(data == other_data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_assignment)
+    {
+      DataM data1;
+      DataM data2;
+
+      data1.insert(DataM::value_type(std::string("1"), ItemM(1)));
+      data1.insert(DataM::value_type(std::string("2"), ItemM(2)));
+      data2.insert(DataM::value_type(std::string("3"), ItemM(3)));
+
+      data2 = std::move(data1);
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(1, data2.at("1").value);
+      CHECK_EQUAL(2, data2.at("2").value);
+      CHECK_EQUAL(0U, data2.count("3"));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_empty_full)
+    {
+      DataNDC data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.available());
+
+      data.assign(initial_data.begin(), initial_data.end());
+
+      CHECK(!data.empty());
+      CHECK(data.full());
+      CHECK_EQUAL(0U, data.available());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      DataDC data;
+
+      data[K0] = DC("A");
+      data[K1] = DC("B");
+      data[K11] = DC("C");
+      data[K1] = DC("D");
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data[K0] == DC("A"));
+      CHECK(data[K1] == DC("D"));
+      CHECK(data[K11] == DC("C"));
+      CHECK(data[K2] == DC());
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      CHECK(data.at(K0) == N0);
+      CHECK(data.at(K9) == N9);
+      CHECK(cdata.at(K5) == N5);
+
+      CHECK_THROW(data.at(K10), etl::unordered_flat_map_out_of_range);
+      CHECK_THROW(cdata.at(K10), etl::unordered_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      CHECK(data.insert(DataNDC::value_type(K0,  N0)).second);  // Inserted
+      CHECK(data.insert(DataNDC::value_type(K2,  N2)).second);  // Inserted
+      CHECK(data.insert(DataNDC::value_type(K1,  N1)).second);  // Inserted
+      CHECK(data.insert(DataNDC::value_type(K11, N1)).second);  // Duplicate hash. Inserted
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(DataNDC::value_type(K1, N3)); // Duplicate key. Not inserted
+      CHECK(!result.second);
+      CHECK(result.first->second == N1);
+
+      CHECK_EQUAL(4U, data.size());
+
+      DataNDC::iterator idata = data.find(K11);
+      CHECK(idata != data.end());
+      CHECK(idata->first  == K11);
+      CHECK(idata->second == N1);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(ETL_OR_STD::make_pair(std::string(K10), N10)), etl::unordered_flat_map_full);
+
+      // An existing key does not need any space.
+      CHECK(!data.insert(ETL_OR_STD::make_pair(std::string(K0), N10)).second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        CHECK(data.find(initial_data[i].first) != data.end());
+      }
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::unordered_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moved_value)
+    {
+      DataM data;
+
+      ItemM d1(1);
+      ItemM d2(2);
+
+      data.insert(DataM::value_type(std::string("1"), etl::move(d1)));
+      data.insert(data.begin(), DataM::value_type(std::string("2"), etl::move(d2)));
+
+      CHECK(!bool(d1));
+      CHECK(!bool(d2));
+
+      CHECK_EQUAL(1, data.at("1").value);
+      CHECK_EQUAL(2, data.at("2").value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K5));
+      CHECK_EQUAL(0U, data.erase(K5));
+      CHECK_EQUAL(initial_data.size() - 1U, data.size());
+      CHECK(data.find(K5) == data.end());
+      CHECK(data.find(K4) != data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single_iterator)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator idata     = data.find(K5);
+      DataNDC::iterator iexpected = idata;
+      ++iexpected;
+      DataNDC::iterator iother    = data.find(K3);
+
+      DataNDC::iterator inext = data.erase(idata);
+
+      CHECK(inext == iexpected);
+      CHECK(data.find(K5) == data.end());
+      CHECK(iother->second == N3); // Other iterators are not invalidated.
+      CHECK_EQUAL(initial_data.size() - 1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_while_iterating)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if ((itr->first == K2) || (itr->first == K7))
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(initial_data.size() - 2U, data.size());
+      CHECK_EQUAL(data.size(), size_t(std::distance(data.begin(), data.end())));
+      CHECK_EQUAL(0U, data.count(K2));
+      CHECK_EQUAL(0U, data.count(K7));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator first = data.begin();
+      std::advance(first, 2);
+      DataNDC::iterator last = first;
+      std::advance(last, 5);
+
+      const std::string last_key = last->first;
+
+      DataNDC::iterator result = data.erase(first, last);
+
+      CHECK_EQUAL(initial_data.size() - 5U, data.size());
+      CHECK(result->first == last_key);
+
+      result = data.erase(data.begin(), data.end());
+
+      CHECK(result == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_count_key)
+    {
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.count(K0));
+      CHECK_EQUAL(0U, data.count(K10));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> result = data.equal_range(K2);
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+      CHECK(result.first->second == N2);
+
+      ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> cresult = cdata.equal_range(K10);
+      CHECK(cresult.first == cdata.end());
+      CHECK(cresult.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      std::vector<ElementNDC> shuffled(initial_data.rbegin(), initial_data.rend());
+
+      const DataNDC initial1(initial_data.begin(), initial_data.end());
+      const DataNDC initial2(shuffled.begin(), shuffled.end());
+
+      CHECK(initial1 == initial2);
+
+      DataNDC different(initial_data.begin(), initial_data.end());
+      different.at(K3) = N0;
+
+      CHECK(initial1 != different);
+
+      different.erase(K3);
+
+      CHECK(initial1 != different);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_load_factor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_CLOSE(float(initial_data.size()) / 16.0f, data.load_factor(), 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_parameterized_hash_and_equal)
+    {
+      typedef etl::unordered_flat_map<size_t, int, 4, parameterized_hash, parameterized_equal> Data;
+
+      Data data(parameterized_hash(3), parameterized_equal(3));
+
+      data[1] = 1;
+      data[4] = 4; // Same as 1 modulo 3.
+      data[2] = 2;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(4, data[7]);
+      CHECK_EQUAL(3U, data.hash_function().modulus);
+      CHECK_EQUAL(3U, data.key_eq().modulus);
+
+      Data copy(data);
+      CHECK_EQUAL(3U, copy.hash_function().modulus);
+      CHECK_EQUAL(3U, copy.key_eq().modulus);
+    }
+
+    //*************************************************************************
+    TEST(test_all_keys_collide)
+    {
+      etl::unordered_flat_map<int, int, 40, constant_hash> data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data[i] = i * 10;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 40; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL(size_t(i & 1), data.count(i));
+      }
+
+      // Refill, reusing the deleted slots.
+      for (int i = 100; i < 120; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 1; i < 40; i += 2)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      for (int i = 100; i < 120; ++i)
+      {
+        CHECK_EQUAL(i, data.at(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_insert_churn_matches_std)
+    {
+      // A small table so that deleted slots are reclaimed in place many times.
+      typedef etl::unordered_flat_map<int, int, 14> Data;
+
+      Data data;
+      std::unordered_map<int, int> compare;
+
+      std::mt19937 generator(1234U);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = int(generator() % 48U);
+
+        switch (generator() % 3U)
+        {
+          case 0:
+          {
+            if (!data.full())
+            {
+              CHECK_EQUAL(compare.insert(std::make_pair(key, i)).second, data.insert(Data::value_type(key, i)).second);
+            }
+            break;
+          }
+
+          case 1:
+          {
+            CHECK_EQUAL(compare.erase(key), data.erase(key));
+            break;
+          }
+
+          default:
+          {
+            Data::iterator itr = data.find(key);
+            std::unordered_map<int, int>::iterator citr = compare.find(key);
+
+            CHECK_EQUAL(citr == compare.end(), itr == data.end());
+
+            if ((itr != data.end()) && (citr != compare.end()))
+            {
+              CHECK_EQUAL(citr->second, itr->second);
+            }
+            break;
+          }
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+      }
+
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+
+      for (Data::const_iterator itr = data.cbegin(); itr != data.cend(); ++itr)
+      {
+        CHECK_EQUAL(compare[itr->first], itr->second);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      typedef etl::unordered_flat_map_ext<int, std::string> Data;
+      typedef etl::unordered_flat_buffer_size<20> Size;
+
+      etl::uninitialized_buffer_of<Data::value_type, Size::Slot_Count> slots;
+      int8_t control[Size::Control_Count];
+
+      etl::uninitialized_buffer_of<Data::value_type, Size::Slot_Count> slots2;
+      int8_t control2[Size::Control_Count];
+
+      Data data(&slots[0], control, 20U);
+
+      CHECK_EQUAL(20U, data.max_size());
+      CHECK_EQUAL(Size::Slot_Count, data.bucket_count());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data[i] = std::to_string(i);
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data[20], etl::unordered_flat_map_full);
+
+      Data copy(data, &slots2[0], control2, 20U);
+
+      CHECK(copy == data);
+      CHECK_EQUAL("7", copy.at(7));
+    }
+
+    //*************************************************************************
+    size_t leading_non_empty(const etl::private_unordered_flat::ctrl_t* ctrl, size_t width)
+    {
+      size_t count = 0U;
+
+      while ((count < width) && (ctrl[width - 1U - count] != etl::private_unordered_flat::Empty))
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    size_t trailing_non_empty(const etl::private_unordered_flat::ctrl_t* ctrl, size_t width)
+    {
+      size_t count = 0U;
+
+      while ((count < width) && (ctrl[count] != etl::private_unordered_flat::Empty))
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    TEST(test_groups_agree)
+    {
+      // The SSE2 and portable groups must classify control bytes identically.
+      typedef etl::private_unordered_flat::group_portable<uint64_t> portable;
+      typedef etl::private_unordered_flat::group_portable<uint32_t> portable32;
+
+      std::mt19937 generator(42U);
+
+      etl::private_unordered_flat::ctrl_t ctrl[16];
+
+      for (int test = 0; test < 1000; ++test)
+      {
+        for (size_t i = 0U; i < 16U; ++i)
+        {
+          const uint32_t r = generator() % 4U;
+          ctrl[i] = (r == 0U) ? etl::private_unordered_flat::Empty
+                  : (r == 1U) ? etl::private_unordered_flat::Deleted
+                  : etl::private_unordered_flat::ctrl_t(generator() % 4U);
+        }
+
+        const etl::private_unordered_flat::ctrl_t h2 = etl::private_unordered_flat::ctrl_t(generator() % 4U);
+
+        portable   p(ctrl);
+        portable32 p32(ctrl);
+
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          const uint64_t bit = uint64_t(0x80U) << (i * 8U);
+
+          CHECK_EQUAL(ctrl[i] == etl::private_unordered_flat::Empty, (p.match_empty().value() & bit) != 0U);
+          CHECK_EQUAL(ctrl[i] < 0, (p.match_empty_or_deleted().value() & bit) != 0U);
+          CHECK_EQUAL(ctrl[i] >= 0, (p.match_full().value() & bit) != 0U);
+
+          // The portable match may report false positives, but never misses.
+          if (ctrl[i] == h2)
+          {
+            CHECK((p.match(h2).value() & bit) != 0U);
+          }
+
+          if (i < 4U)
+          {
+            CHECK_EQUAL(ctrl[i] == etl::private_unordered_flat::Empty, (p32.match_empty().value() & uint32_t(bit)) != 0U);
+          }
+        }
+
+        CHECK_EQUAL(leading_non_empty(ctrl, 8U), p.match_empty().leading_empty());
+        CHECK_EQUAL(trailing_non_empty(ctrl, 8U), p.match_empty().trailing_empty());
+
+#if ETL_HAS_UNORDERED_FLAT_SSE2
+        etl::private_unordered_flat::group_sse2 s(ctrl);
+
+        for (size_t i = 0U; i < 16U; ++i)
+        {
+          const uint32_t bit = uint32_t(1U) << i;
+
+          CHECK_EQUAL(ctrl[i] == h2, (s.match(h2).value() & bit) != 0U);
+          CHECK_EQUAL(ctrl[i] == etl::private_unordered_flat::Empty, (s.match_empty().value() & bit) != 0U);
+          CHECK_EQUAL(ctrl[i] < 0, (s.match_empty_or_deleted().value() & bit) != 0U);
+          CHECK_EQUAL(ctrl[i] >= 0, (s.match_full().value() & bit) != 0U);
+        }
+
+        CHECK_EQUAL(leading_non_empty(ctrl, 16U), s.match_empty().leading_empty());
+        CHECK_EQUAL(trailing_non_empty(ctrl, 16U), s.match_empty().trailing_empty());
+#endif
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bit_mask)
+    {
+      typedef etl::private_unordered_flat::bit_mask<uint32_t, 16U, 0U> mask16;
+      typedef etl::private_unordered_flat::bit_mask<uint64_t, 8U, 3U>  mask8;
+
+      CHECK_EQUAL(16U, mask16(0U).leading_empty());
+      CHECK_EQUAL(16U, mask16(0U).trailing_empty());
+      CHECK_EQUAL(15U, mask16(0x0001U).leading_empty());
+      CHECK_EQUAL(0U,  mask16(0x8000U).leading_empty());
+      CHECK_EQUAL(4U,  mask16(0x0F10U).lowest());
+
+      CHECK_EQUAL(8U, mask8(0U).leading_empty());
+      CHECK_EQUAL(7U, mask8(0x80U).leading_empty());
+      CHECK_EQUAL(0U, mask8(0x80U).trailing_empty());
+      CHECK_EQUAL(2U, mask8(0x0000800000800000ULL).lowest());
+      CHECK_EQUAL(1U, mask8(0x0080000000800000ULL).leading_empty());
+
+      mask8 m(0x0000800000800000ULL);
+      m.clear_lowest();
+      CHECK_EQUAL(5U, m.lowest());
+    }
+  };
+}
@@ -0,0 +1,407 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <functional>
+#include <random>
+#include <unordered_set>
+
+#include "data.h"
+
+#include "etl/unordered_flat_set.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  // Hashes on the string contents, so many keys share a hash.
+  struct simple_hash
+  {
+    size_t operator ()(const TestDataNDC<std::string>& value) const
+    {
+      return std::accumulate(value.value.begin(), value.value.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct constant_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 7U;
+    }
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+
+  SUITE(test_unordered_flat_set)
+  {
+    static const size_t SIZE = 10;
+
+    using ItemM = TestDataM<std::string>;
+
+    struct ItemMHash
+    {
+      size_t operator ()(const ItemM& item) const
+      {
+        return std::hash<std::string>()(item.value);
+      }
+    };
+
+    using DataM = etl::unordered_flat_set<ItemM, SIZE, ItemMHash>;
+
+    typedef etl::unordered_flat_set<NDC, SIZE, simple_hash> DataNDC;
+    typedef etl::iunordered_flat_set<NDC, simple_hash> IDataNDC;
+
+    NDC N0 = NDC("FF");
+    NDC N1 = NDC("FG");
+    NDC N2 = NDC("FH");
+    NDC N3 = NDC("FI");
+    NDC N4 = NDC("FJ");
+    NDC N5 = NDC("FK");
+    NDC N6 = NDC("FL");
+    NDC N7 = NDC("FM");
+    NDC N8 = NDC("FN");
+    NDC N9 = NDC("FO");
+    NDC N10 = NDC("FP");
+    NDC N11 = NDC("GF"); // Same hash as N1.
+
+    std::vector<NDC> initial_data;
+    std::vector<NDC> excess_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        NDC n[] = { N0, N1, N2, N3, N4, N5, N6, N7, N8, N9 };
+        NDC n2[] = { N0, N1, N2, N3, N4, N5, N6, N7, N8, N9, N10 };
+
+        initial_data.assign(std::begin(n), std::end(n));
+        excess_data.assign(std::begin(n2), std::end(n2));
+      }
+    };
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(16U, data.bucket_count());
+      CHECK(data.begin() == data.end());
+    }
+
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_cpp17_deduced_constructor)
+    {
+      etl::unordered_flat_set data{ 0, 1, 2, 3 };
+      etl::unordered_flat_set<int, 4U> check = { 3, 2, 1, 0 };
+
+      CHECK(data == check);
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_make_unordered_flat_set)
+    {
+      auto data = etl::make_unordered_flat_set<int>(4, 5, 6);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1U, data.count(5));
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(data.full());
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        CHECK(data.find(initial_data[i]) != data.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_and_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC copy(data);
+      DataNDC assigned;
+
+      assigned = data;
+
+      CHECK(copy == data);
+      CHECK(assigned == data);
+
+      IDataNDC& idata = assigned;
+      idata = copy;
+
+      CHECK(idata == data);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor_and_assignment)
+    {
+      DataM data1;
+
+      data1.insert(ItemM("1"));
+      data1.insert(ItemM("2"));
+      data1.insert(ItemM("3"));
+
+      DataM data2(std::move(data1));
+
+      CHECK_EQUAL(3U, data2.size());
+      CHECK(data2.find(ItemM("2")) != data2.end());
+
+      DataM data3;
+      data3.insert(ItemM("4"));
+      data3 = std::move(data2);
+
+      CHECK_EQUAL(3U, data3.size());
+      CHECK(data3.find(ItemM("3")) != data3.end());
+      CHECK(data3.find(ItemM("4")) == data3.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_destruct_via_iunordered_flat_set)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      CHECK(data.insert(N0).second);
+      CHECK(data.insert(N1).second);
+      CHECK(data.insert(N11).second); // Duplicate hash. Inserted
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(N1); // Duplicate key. Not inserted
+      CHECK(!result.second);
+      CHECK(*result.first == N1);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(*data.insert(data.begin(), N2) == N2);
+      CHECK_EQUAL(4U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(N10), etl::unordered_flat_set_full);
+      CHECK(!data.insert(N0).second);
+
+      DataNDC data2;
+      CHECK_THROW(data2.insert(excess_data.begin(), excess_data.end()), etl::unordered_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(N3));
+      CHECK_EQUAL(0U, data.erase(N3));
+
+      DataNDC::iterator itr = data.find(N4);
+      DataNDC::iterator expected = itr;
+      ++expected;
+
+      CHECK(data.erase(itr) == expected);
+      CHECK_EQUAL(initial_data.size() - 2U, data.size());
+      CHECK_EQUAL(data.size(), size_t(std::distance(data.begin(), data.end())));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_count_and_equal_range)
+    {
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.count(N0));
+      CHECK_EQUAL(0U, data.count(N10));
+
+      ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> result = data.equal_range(N5);
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+      CHECK(*result.first == N5);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      std::vector<NDC> reversed(initial_data.rbegin(), initial_data.rend());
+
+      const DataNDC data1(initial_data.begin(), initial_data.end());
+      const DataNDC data2(reversed.begin(), reversed.end());
+
+      CHECK(data1 == data2);
+
+      DataNDC data3(data1);
+      data3.erase(N0);
+      data3.insert(N10);
+
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST(test_all_keys_collide)
+    {
+      etl::unordered_flat_set<int, 30, constant_hash> data;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        CHECK(data.insert(i).second);
+      }
+
+      for (int round = 0; round < 10; ++round)
+      {
+        for (int i = 0; i < 30; i += 3)
+        {
+          CHECK_EQUAL(1U, data.erase((i + round) % 30));
+          CHECK(data.insert(i + 1000).second);
+        }
+
+        for (int i = 0; i < 30; i += 3)
+        {
+          CHECK_EQUAL(1U, data.erase(i + 1000));
+          CHECK(data.insert((i + round) % 30).second);
+        }
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 30; ++i)
+      {
+        CHECK_EQUAL(1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_insert_churn_matches_std)
+    {
+      typedef etl::unordered_flat_set<uint32_t, 28> Data;
+
+      Data data;
+      std::unordered_set<uint32_t> compare;
+
+      std::mt19937 generator(5678U);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const uint32_t key = generator() % 64U;
+
+        if ((generator() & 1U) == 0U)
+        {
+          if (!data.full())
+          {
+            CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+      }
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(1U, compare.count(*itr));
+      }
+
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+
+    //*************************************************************************
+    TEST(test_ext)
+    {
+      typedef etl::unordered_flat_set_ext<int> Data;
+      typedef etl::unordered_flat_buffer_size<50> Size;
+
+      int    slots[Size::Slot_Count];
+      int8_t control[Size::Control_Count];
+
+      std::vector<int> values(50);
+      std::iota(values.begin(), values.end(), 100);
+
+      Data data(values.begin(), values.end(), slots, control, 50U);
+
+      CHECK(data.full());
+      CHECK_EQUAL(Size::Slot_Count, data.bucket_count());
+      CHECK_THROW(data.insert(0), etl::unordered_flat_set_full);
+
+      for (int i = 100; i < 150; ++i)
+      {
+        CHECK_EQUAL(1U, data.count(i));
+      }
+    }
+  };
+}
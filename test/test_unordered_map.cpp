@@ -1192,5 +1192,133 @@ namespace
       using Map = etl::unordered_map<int, int, 1, 1>;
       CHECK((!std::is_same_v<typename Map::const_iterator::value_type, typename Map::iterator::value_type>));
     }
+
+    //*************************************************************************
+    TEST(test_sparse_buckets)
+    {
+      // Keys map directly to buckets, so that most buckets are empty and
+      // the occupied ones move around as elements come and go.
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      using Data     = etl::unordered_map<int, int, 40, 100, identity_hash>;
+      using Actual   = std::map<int, int>;
+      using Expected = std::map<int, int>;
+
+      Data data;
+      std::map<int, int> compare;
+
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 4000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+
+        // Up to three keys per bucket.
+        const int key = int((seed >> 8) % 100U) + (int((seed >> 20) % 3U) * 100);
+
+        if ((((seed >> 4) & 1U) != 0U) && !data.full())
+        {
+          data.insert(std::make_pair(key, i));
+          compare.insert(std::make_pair(key, i));
+        }
+        else
+        {
+          data.erase(key);
+          compare.erase(key);
+        }
+
+        if ((i % 250) == 124)
+        {
+          // Erase the second half.
+          Data::iterator first = data.begin();
+          std::advance(first, data.size() / 2U);
+
+          for (Data::iterator itr = first; itr != data.end(); ++itr)
+          {
+            compare.erase(compare.find(itr->first));
+          }
+
+          data.erase(first, data.end());
+        }
+
+        if ((i % 250) == 249)
+        {
+          // Erase the first half.
+          Data::iterator last = data.begin();
+          std::advance(last, data.size() / 2U);
+
+          for (Data::iterator itr = data.begin(); itr != last; ++itr)
+          {
+            compare.erase(compare.find(itr->first));
+          }
+
+          data.erase(data.begin(), last);
+        }
+
+        if ((i % 1000) == 999)
+        {
+          data.clear();
+          compare.clear();
+
+          CHECK(data.begin() == data.end());
+        }
+
+        // Iteration visits every element once.
+        Actual actual(data.begin(), data.end());
+        CHECK_EQUAL(compare.size(), data.size());
+        CHECK(Expected(compare.begin(), compare.end()) == actual);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clear_dense_and_sparse)
+    {
+      // Keys map directly to buckets.
+      struct identity_hash
+      {
+        size_t operator ()(int key) const
+        {
+          return size_t(key);
+        }
+      };
+
+      using Data = etl::unordered_map<int, int, 40, 100, identity_hash>;
+
+      Data data;
+
+      // Enough elements that clear steps through every bucket.
+      for (int i = 0; i < 40; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      // Iteration would stop early at a bucket still marked as occupied.
+      data.insert(std::make_pair(0, 0));
+      data.insert(std::make_pair(50, 50));
+
+      CHECK_EQUAL(2U, size_t(std::distance(data.begin(), data.end())));
+
+      // Few enough elements that clear only visits the occupied buckets.
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(std::make_pair(10, 10));
+      data.insert(std::make_pair(99, 99));
+
+      CHECK_EQUAL(2U, size_t(std::distance(data.begin(), data.end())));
+    }
   };
 }
@@ -0,0 +1,370 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <vector>
+#include <set>
+#include <random>
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#include "etl/wyhash.h"
+#include "etl/hash.h"
+#include "etl/string.h"
+
+namespace
+{
+  // The reference wyhash test vectors. Seed = index.
+  const char* vector_text[] =
+  {
+    "",
+    "a",
+    "abc",
+    "message digest",
+    "abcdefghijklmnopqrstuvwxyz",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+    "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+  };
+
+  const uint64_t vector_hash[] =
+  {
+    0x93228A4DE0EEC5A2ULL,
+    0xC5BAC3DB178713C4ULL,
+    0xA97F2F7B1D9B3314ULL,
+    0x786D1F1DF3801DF4ULL,
+    0xDCA5A8138AD37C87ULL,
+    0xB9E734F117CFAF70ULL,
+    0x6CC5EAB49A92D617ULL
+  };
+
+  //***************************************************************************
+  // For each input bit, flips it in Keys random inputs and counts how often
+  // each output bit changes. Returns the worst deviation from 50%.
+  //***************************************************************************
+  template <typename THash>
+  double worst_avalanche_bias(size_t length, size_t keys)
+  {
+    const size_t Output_Bits = sizeof(typename THash::value_type) * 8U;
+
+    std::mt19937_64 rng(length);
+    std::vector<uint8_t> data(length);
+    std::vector<size_t>  flips(length * 8U * Output_Bits, 0U);
+
+    for (size_t k = 0U; k < keys; ++k)
+    {
+      for (size_t i = 0U; i < length; ++i)
+      {
+        data[i] = uint8_t(rng());
+      }
+
+      const uint64_t original = THash(data.data(), length).value();
+
+      for (size_t bit = 0U; bit < (length * 8U); ++bit)
+      {
+        data[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+        const uint64_t changed = original ^ THash(data.data(), length).value();
+        data[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+
+        for (size_t out = 0U; out < Output_Bits; ++out)
+        {
+          flips[(bit * Output_Bits) + out] += size_t((changed >> out) & 1U);
+        }
+      }
+    }
+
+    double worst = 0.0;
+
+    for (size_t i = 0U; i < flips.size(); ++i)
+    {
+      double bias = (double(flips[i]) / double(keys)) - 0.5;
+      bias = (bias < 0.0) ? -bias : bias;
+
+      worst = (bias > worst) ? bias : worst;
+    }
+
+    return worst;
+  }
+
+  //***************************************************************************
+  // Chi-squared statistic of hashes distributed into Buckets bins,
+  // taken from either the low or the high bits.
+  //***************************************************************************
+  double chi_squared(const std::vector<uint64_t>& hashes, size_t buckets, size_t shift)
+  {
+    std::vector<size_t> counts(buckets, 0U);
+
+    for (size_t i = 0U; i < hashes.size(); ++i)
+    {
+      ++counts[(hashes[i] >> shift) & (buckets - 1U)];
+    }
+
+    const double expected = double(hashes.size()) / double(buckets);
+    double chi2 = 0.0;
+
+    for (size_t i = 0U; i < buckets; ++i)
+    {
+      const double d = double(counts[i]) - expected;
+      chi2 += (d * d) / expected;
+    }
+
+    return chi2;
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_64_reference_vectors)
+    {
+      for (size_t i = 0U; i < (sizeof(vector_hash) / sizeof(vector_hash[0])); ++i)
+      {
+        uint64_t hash = etl::wyhash_64(vector_text[i], strlen(vector_text[i]), i);
+
+        CHECK_EQUAL(vector_hash[i], hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_constructor_range)
+    {
+      std::string text(vector_text[5]);
+
+      uint64_t hash1 = etl::wyhash_64(text.begin(), text.end(), 5U);
+      uint64_t hash2 = etl::wyhash_64(text.data(), text.data() + text.size(), 5U);
+      uint64_t hash3 = etl::wyhash_64::calculate(text.data(), text.size(), 5U);
+
+      CHECK_EQUAL(vector_hash[5], hash1);
+      CHECK_EQUAL(vector_hash[5], hash2);
+      CHECK_EQUAL(vector_hash[5], hash3);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_empty_range)
+    {
+      std::vector<uint8_t> data;
+
+      uint64_t hash = etl::wyhash_64(data.begin(), data.end());
+
+      CHECK_EQUAL(vector_hash[0], etl::wyhash_64(ETL_NULLPTR, 0U, 0U).value());
+      CHECK_EQUAL(vector_hash[0], hash);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_seed)
+    {
+      std::string text("The quick brown fox");
+
+      uint64_t hash1 = etl::wyhash_64(text.begin(), text.end());
+      uint64_t hash2 = etl::wyhash_64(text.begin(), text.end(), 1U);
+      uint64_t hash3 = etl::wyhash_64(text.begin(), text.end(), 1U);
+
+      CHECK(hash1 != hash2);
+      CHECK_EQUAL(hash2, hash3);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_alignment)
+    {
+      // The same bytes at each offset must hash the same.
+      uint8_t buffer[128 + 8];
+      uint8_t data[128];
+
+      for (size_t i = 0U; i < sizeof(data); ++i)
+      {
+        data[i] = uint8_t(i * 37U);
+      }
+
+      for (size_t length = 0U; length <= sizeof(data); ++length)
+      {
+        const uint64_t expected = etl::wyhash_64(data, length);
+
+        for (size_t offset = 0U; offset < 8U; ++offset)
+        {
+          memcpy(buffer + offset, data, length);
+
+          CHECK_EQUAL(expected, etl::wyhash_64(buffer + offset, length).value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_all_lengths_distinct)
+    {
+      // Prefixes of one buffer, crossing each of the 4, 8, 16 and 48 byte paths.
+      std::vector<uint8_t> data(256, 0U);
+      std::set<uint64_t>   hashes;
+
+      for (size_t length = 0U; length <= data.size(); ++length)
+      {
+        hashes.insert(etl::wyhash_64(data.data(), length).value());
+      }
+
+      CHECK_EQUAL(data.size() + 1U, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_no_collisions_short)
+    {
+      std::set<uint64_t> hashes;
+
+      // Every one and two byte key.
+      for (uint32_t i = 0U; i < 0x100UL; ++i)
+      {
+        uint8_t data[1] = { uint8_t(i) };
+
+        hashes.insert(etl::wyhash_64(data, sizeof(data)).value());
+      }
+
+      for (uint32_t i = 0U; i < 0x10000UL; ++i)
+      {
+        uint8_t data[2] = { uint8_t(i), uint8_t(i >> 8U) };
+
+        hashes.insert(etl::wyhash_64(data, sizeof(data)).value());
+      }
+
+      CHECK_EQUAL(0x100UL + 0x10000UL, hashes.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_32_fold)
+    {
+      for (size_t i = 0U; i < (sizeof(vector_hash) / sizeof(vector_hash[0])); ++i)
+      {
+        uint32_t hash = etl::wyhash_32(vector_text[i], strlen(vector_text[i]), i);
+
+        CHECK_EQUAL(uint32_t(vector_hash[i] ^ (vector_hash[i] >> 32U)), hash);
+      }
+
+      std::string text(vector_text[4]);
+
+      uint32_t hash1 = etl::wyhash_32(text.begin(), text.end(), 4U);
+      uint32_t hash2 = etl::wyhash_32::calculate(text.data(), text.size(), 4U);
+
+      CHECK_EQUAL(uint32_t(vector_hash[4] ^ (vector_hash[4] >> 32U)), hash1);
+      CHECK_EQUAL(hash1, hash2);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_avalanche)
+    {
+      // Single byte keys, of which there are only 256, are covered by test_wyhash_64_no_collisions_short.
+      const size_t lengths[] = { 2U, 3U, 4U, 7U, 8U, 12U, 16U, 17U, 33U, 48U, 64U, 100U };
+
+      for (size_t i = 0U; i < (sizeof(lengths) / sizeof(lengths[0])); ++i)
+      {
+        // 1000 keys gives a standard deviation of 1.6%.
+        const double bias64 = worst_avalanche_bias<etl::wyhash_64>(lengths[i], 1000U);
+        const double bias32 = worst_avalanche_bias<etl::wyhash_32>(lengths[i], 1000U);
+
+        if ((bias64 >= 0.1) || (bias32 >= 0.1))
+        {
+          printf("Length %u : 64 bit bias %f : 32 bit bias %f\n", unsigned(lengths[i]), bias64, bias32);
+        }
+
+        CHECK(bias64 < 0.1);
+        CHECK(bias32 < 0.1);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_bucket_bias)
+    {
+      // 64 keys per bucket. The chi-squared statistic for 1023 degrees of freedom
+      // has a mean of 1023 and a standard deviation of 45.
+      const size_t Keys    = 65536U;
+      const size_t Buckets = 1024U;
+      const double Limit   = 1023.0 + (6.0 * 45.0);
+
+      std::vector<uint64_t> sequential;
+      std::vector<uint64_t> text;
+      std::vector<uint64_t> folded;
+
+      for (uint32_t i = 0U; i < Keys; ++i)
+      {
+        uint8_t data[4] = { uint8_t(i), uint8_t(i >> 8U), uint8_t(i >> 16U), uint8_t(i >> 24U) };
+        sequential.push_back(etl::wyhash_64(data, sizeof(data)).value());
+        folded.push_back(etl::wyhash_32(data, sizeof(data)).value());
+
+        char key[32];
+        int length = snprintf(key, sizeof(key), "key_%u", unsigned(i));
+        text.push_back(etl::wyhash_64(key, size_t(length)).value());
+      }
+
+      CHECK(chi_squared(sequential, Buckets, 0U)  < Limit);
+      CHECK(chi_squared(sequential, Buckets, 54U) < Limit);
+      CHECK(chi_squared(text, Buckets, 0U)        < Limit);
+      CHECK(chi_squared(text, Buckets, 54U)       < Limit);
+      CHECK(chi_squared(folded, Buckets, 0U)      < Limit);
+      CHECK(chi_squared(folded, Buckets, 22U)     < Limit);
+    }
+
+    //*************************************************************************
+    TEST(test_hash_uses_wyhash)
+    {
+      etl::string<32> text("Hello World");
+
+      size_t hash     = etl::hash<etl::istring>()(text);
+      size_t expected = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(text.data()),
+                                                                reinterpret_cast<const uint8_t*>(text.data() + text.size()));
+
+      CHECK_EQUAL(expected, hash);
+
+#if ETL_HAS_HASH_WYHASH
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        CHECK_EQUAL(size_t(etl::wyhash_64(text.data(), text.size()).value()), hash);
+      }
+      else
+      {
+        CHECK_EQUAL(size_t(etl::wyhash_32(text.data(), text.size()).value()), hash);
+      }
+#else
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        CHECK_EQUAL(size_t(etl::fnv_1a_64(text.begin(), text.end()).value()), hash);
+      }
+#endif
+    }
+
+#if ETL_HAS_HASH_WYHASH
+    //*************************************************************************
+    TEST(test_hash_float_uses_wyhash)
+    {
+      float  value = 1.2345f;
+      size_t hash  = etl::hash<float>()(value);
+
+      if (sizeof(size_t) == sizeof(uint64_t))
+      {
+        CHECK_EQUAL(size_t(etl::wyhash_64(&value, sizeof(value)).value()), hash);
+      }
+    }
+#endif
+  };
+}